@@ -0,0 +1,127 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header for advanced hardware related properties for CPU plugin
+ *        To use in SetConfig() and GetMetric() methods of plugins
+ *
+ * @file cpu_config.hpp
+ */
+#pragma once
+
+#include "ie_plugin_config.hpp"
+
+namespace InferenceEngine {
+
+namespace Metrics {
+
+/**
+ * @def CPU_METRIC_KEY(name)
+ * @brief shortcut for defining CPU plugin metrics
+ */
+#define CPU_METRIC_KEY(name) METRIC_KEY(CPU_##name)
+#define DECLARE_CPU_METRIC_KEY(name, ...) DECLARE_METRIC_KEY(CPU_##name, __VA_ARGS__)
+
+/**
+ * @brief ExecutableNetwork metric which returns size in bytes of the intermediate tensors memory allocated
+ * for a single stream
+ */
+DECLARE_CPU_METRIC_KEY(MEMORY_WORKSPACE_SIZE, uint64_t);
+
+/**
+ * @brief ExecutableNetwork metric which returns theoretical minimum in bytes of the intermediate tensors memory
+ * for a single stream, i.e. max total size of the tensors alive at the same time
+ */
+DECLARE_CPU_METRIC_KEY(MEMORY_WORKSPACE_LOWER_BOUND, uint64_t);
+
+/**
+ * @brief ExecutableNetwork metric which returns latency statistics accumulated across all inferences when
+ * CPU_LATENCY_HISTOGRAMS is enabled.
+ * Maps the executed layer name to {count, p50, p90, p99, max}, latencies are in microseconds. The empty name stands
+ * for the whole inference of the request.
+ */
+DECLARE_CPU_METRIC_KEY(LATENCY_PERCENTILES, std::map<std::string, std::vector<double>>);
+
+/**
+ * @brief ExecutableNetwork metric which returns statistics of the memory allocated by the huge pages allocator of
+ * all streams when CPU_HUGE_PAGES is enabled, sizes are in bytes.
+ * The keys are: huge_page_size, allocations, allocated_bytes, mapped_bytes, explicit_huge_page_bytes,
+ * transparent_huge_page_bytes, small_page_bytes, tlb_entries (estimated number of TLB entries covering the allocated
+ * memory) and explicit_fallbacks (number of allocations which didn't get pages from the hugetlbfs pool).
+ */
+DECLARE_CPU_METRIC_KEY(HUGE_PAGES_STATISTICS, std::map<std::string, uint64_t>);
+
+}  // namespace Metrics
+
+/**
+ * @brief CPU plugin configuration
+ */
+namespace CPUConfigParams {
+
+/**
+ * @brief shortcut for defining configuration keys
+ */
+#define CPU_CONFIG_KEY(name) InferenceEngine::CPUConfigParams::_CONFIG_KEY(CPU_##name)
+#define DECLARE_CPU_CONFIG_KEY(name) DECLARE_CONFIG_KEY(CPU_##name)
+#define DECLARE_CPU_CONFIG_VALUE(name) DECLARE_CONFIG_VALUE(CPU_##name)
+
+/**
+ * @brief The key defines the number of execution graphs (each with its own intermediate tensors workspace and
+ * non-shared constants) which are leased by the streams on each inference.
+ * This option should be used with an unsigned integer value. 0 (default) means one graph per stream.
+ * It allows to reduce memory consumption when number of streams exceeds the number of simultaneously executed
+ * infer requests.
+ */
+DECLARE_CPU_CONFIG_KEY(WORKSPACE_POOL_SIZE);
+
+/**
+ * @brief The key defines the priority of the executable network infer requests.
+ * This option should be used with an integer value, 0 by default. Requests of the networks sharing the CPU streams
+ * are started in the order of the priority, then in the order of submission. A running request gives way to the
+ * requests with higher priority between the nodes execution.
+ * The key can be changed for the loaded network by ExecutableNetwork::SetConfig, which doesn't wait for the running
+ * requests and affects the requests started later.
+ */
+DECLARE_CPU_CONFIG_KEY(MODEL_PRIORITY);
+
+/**
+ * @brief The key enables latency histograms of each layer and of the whole inference, which are accumulated across
+ * all inferences of all streams and are available via the CPU_LATENCY_PERCENTILES metric.
+ * This option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default).
+ */
+DECLARE_CPU_CONFIG_KEY(LATENCY_HISTOGRAMS);
+
+/**
+ * @brief The key enables the huge pages for the intermediate tensors workspaces and the infer request blobs, which
+ * reduces TLB misses on the large networks. The memory is pre-faulted on the allocation.
+ * This option should be used with values:
+ *  - PluginConfigParams::NO (default) - regular pages
+ *  - CPU_TRANSPARENT - transparent huge pages requested with madvise
+ *  - CPU_EXPLICIT - huge pages from the hugetlbfs pool, falls back to the transparent ones if the pool is exhausted
+ */
+DECLARE_CPU_CONFIG_KEY(HUGE_PAGES);
+DECLARE_CPU_CONFIG_VALUE(TRANSPARENT);
+DECLARE_CPU_CONFIG_VALUE(EXPLICIT);
+
+/**
+ * @brief The key enables the removal of the pruned channels on the network loading. The output channels of
+ * Convolution, GroupConvolution and MatMul with all-zero weights are propagated through the following layers and
+ * physically removed together with the corresponding input channels of the consumers, so the structured-pruned
+ * networks are executed with fewer FLOPs and smaller intermediate tensors. Network outputs are not changed.
+ * This option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default).
+ */
+DECLARE_CPU_CONFIG_KEY(PRUNING);
+
+/**
+ * @brief The key defines the minimal fraction of zero values in the constant weights of FullyConnected layer for
+ * which the weights are compressed and multiplied by the sparse kernel instead of the dense one. Such layers don't
+ * fuse the following operations.
+ * This option should be used with a floating point value in the range [0, 1], 0.8 by default. 1 enables the sparse
+ * kernel only for the all-zero weights.
+ */
+DECLARE_CPU_CONFIG_KEY(SPARSE_WEIGHTS_DECOMPRESSION_RATE);
+
+}  // namespace CPUConfigParams
+
+}  // namespace InferenceEngine
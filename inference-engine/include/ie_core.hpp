@@ -127,6 +127,26 @@ public:
         const std::string& modelPath, const std::string& deviceName,
         const std::map<std::string, std::string>& config = {});
 
+    /**
+     * @brief Reads models and creates executable networks from IR or ONNX files concurrently
+     *
+     * Each model is read and loaded as with Core::LoadNetwork from a file, the reading, transformations and
+     *        compilation of the different models overlap on a pool of threads. It reduces the startup time of the
+     *        applications loading many models. The phases of each load are reported as ITT tasks of its thread.
+     *
+     * @param modelPaths paths to models
+     * @param deviceName Name of device to load networks to
+     * @param config Optional map of pairs: (config parameter name, config parameter value) relevant only for this load
+     * operation
+     * @param maxConcurrency Maximum number of networks loaded at the same time, 0 means the number of hardware threads
+     *
+     * @return Executable networks in the order of modelPaths. If any network fails to load, the first error is rethrown
+     * after the other networks are loaded
+     */
+    std::vector<ExecutableNetwork> LoadNetworks(
+        const std::vector<std::string>& modelPaths, const std::string& deviceName,
+        const std::map<std::string, std::string>& config = {}, size_t maxConcurrency = 0);
+
     /**
      * @brief Registers extension
      * @param extension Pointer to already loaded extension
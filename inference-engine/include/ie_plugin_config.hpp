@@ -381,6 +381,22 @@ DECLARE_CONFIG_KEY(ENFORCE_BF16);
  */
 DECLARE_CONFIG_KEY(CACHE_DIR);
 
+/**
+ * @brief The key enables memory mapping of the weights files read by Core::ReadNetwork. Possible values are "YES" or
+ * "NO", the default is "NO".
+ *
+ * The weights are read from the file only when they are accessed, so the weights of the operations which are not
+ * compiled are never loaded into memory. The file must not be modified or truncated while the networks read from it
+ * (and the executable networks sharing their weights) are alive, otherwise the access to the weights may terminate the
+ * application (e.g. with SIGBUS), so the networks must not be serialized to the file they were read from.
+ * The key is applicable to Core only:
+ *
+ * @code
+ * ie.SetConfig({{CONFIG_KEY(MMAP_WEIGHTS), CONFIG_VALUE(YES)}});
+ * @endcode
+ */
+DECLARE_CONFIG_KEY(MMAP_WEIGHTS);
+
 }  // namespace PluginConfigParams
 
 /**
@@ -40,6 +40,20 @@ static const char infer_requests_count_message[] = "Optional. Number of infer re
 /// @brief message for execution time
 static const char execution_time_message[] = "Optional. Time in seconds to execute topology.";
 
+/// @brief message for open-loop rate
+static const char qps_message[] = "Optional. Enables open-loop mode with the given rate of inference requests per second. "
+                                  "Requests are started by schedule independently of completion of the previous ones and "
+                                  "latency is measured from the scheduled start, so it includes the time spent waiting for "
+                                  "an idle infer request. Requires async API. Default value is 0 (closed loop).";
+
+/// @brief message for open-loop arrival distribution
+static const char arrival_message[] = "Optional. Distribution of request arrivals in open-loop mode: \"fixed\" (constant interval) "
+                                      "or \"poisson\" (exponential intervals). Default value is \"fixed\".";
+
+/// @brief message for warm-up time
+static const char warmup_message[] = "Optional. Time in milliseconds from the start of measurement. Requests started within this "
+                                     "time are excluded from latency and throughput statistics. Default value is 0.";
+
 /// @brief message for #threads for CPU inference
 static const char infer_num_threads_message[] = "Optional. Number of threads to use for inference on the CPU "
                                                 "(including HETERO and MULTI cases).";
@@ -95,6 +109,10 @@ static const char report_type_message[] = "Optional. Enable collecting statistic
 // @brief message for report_folder option
 static const char report_folder_message[] = "Optional. Path to a folder where statistics report is stored.";
 
+// @brief message for json_report option
+static const char json_report_message[] = "Optional. Path to a file where the results of the run (configuration, throughput, "
+                                          "latency percentiles) are stored in JSON format.";
+
 // @brief message for exec_graph_path option
 static const char exec_graph_path_message[] = "Optional. Path to a file where to store executable graph information serialized.";
 
@@ -105,6 +123,10 @@ static const char progress_message[] = "Optional. Show progress bar (can affect
 // @brief message for performance counters option
 static const char pc_message[] = "Optional. Report performance counters.";
 
+// @brief message for latency histograms option
+static const char latency_histograms_message[] = "Optional. CPU only. Collect per-layer and per-request latency histograms "
+                                                 "across all inferences and report p50/p90/p99/max latencies.";
+
 #ifdef USE_OPENCV
 // @brief message for load config option
 static const char load_config_message[] = "Optional. Path to XML/YAML/JSON file to load custom IE parameters."
@@ -182,6 +204,15 @@ DEFINE_uint32(t, 0, execution_time_message);
 /// @brief Number of infer requests in parallel
 DEFINE_uint32(nireq, 0, infer_requests_count_message);
 
+/// @brief Rate of requests per second in open-loop mode (default 0 - closed loop)
+DEFINE_double(qps, 0, qps_message);
+
+/// @brief Distribution of request arrivals in open-loop mode
+DEFINE_string(arrival, "fixed", arrival_message);
+
+/// @brief Time in milliseconds excluded from statistics
+DEFINE_uint32(warmup, 0, warmup_message);
+
 /// @brief Number of threads to use for inference on the CPU in throughput mode (also affects Hetero
 /// cases)
 DEFINE_uint32(nthreads, 0, infer_num_threads_message);
@@ -211,12 +242,18 @@ DEFINE_string(report_folder, "", report_folder_message);
 /// @brief Path to a file where to store executable graph information serialized
 DEFINE_string(exec_graph_path, "", exec_graph_path_message);
 
+/// @brief Path to a file to store results in JSON format
+DEFINE_string(json_report, "", json_report_message);
+
 /// @brief Define flag for showing progress bar <br>
 DEFINE_bool(progress, false, progress_message);
 
 /// @brief Define flag for showing performance counters <br>
 DEFINE_bool(pc, false, pc_message);
 
+/// @brief Define flag for collecting latency histograms <br>
+DEFINE_bool(latency_histograms, false, latency_histograms_message);
+
 #ifdef USE_OPENCV
 /// @brief Define flag for loading configuration file <br>
 DEFINE_string(load_config, "", load_config_message);
@@ -273,6 +310,9 @@ static void showUsage() {
     std::cout << "    -b \"<integer>\"            " << batch_size_message << std::endl;
     std::cout << "    -stream_output            " << stream_output_message << std::endl;
     std::cout << "    -t                        " << execution_time_message << std::endl;
+    std::cout << "    -qps \"<float>\"            " << qps_message << std::endl;
+    std::cout << "    -arrival \"<fixed/poisson>\" " << arrival_message << std::endl;
+    std::cout << "    -warmup \"<integer>\"       " << warmup_message << std::endl;
     std::cout << "    -progress                 " << progress_message << std::endl;
     std::cout << "    -shape                    " << shape_message << std::endl;
     std::cout << "    -layout                   " << layout_message << std::endl;
@@ -287,7 +327,9 @@ static void showUsage() {
     std::cout << "    -report_type \"<type>\"     " << report_type_message << std::endl;
     std::cout << "    -report_folder            " << report_folder_message << std::endl;
     std::cout << "    -exec_graph_path          " << exec_graph_path_message << std::endl;
+    std::cout << "    -json_report \"<path>\"     " << json_report_message << std::endl;
     std::cout << "    -pc                       " << pc_message << std::endl;
+    std::cout << "    -latency_histograms       " << latency_histograms_message << std::endl;
 #ifdef USE_OPENCV
     std::cout << "    -dump_config              " << dump_config_message << std::endl;
     std::cout << "    -load_config              " << load_config_message << std::endl;
@@ -21,7 +21,7 @@
 typedef std::chrono::high_resolution_clock Time;
 typedef std::chrono::nanoseconds ns;
 
-typedef std::function<void(size_t id, const double latency)> QueueCallbackFunction;
+typedef std::function<void(size_t id, const double latency, const Time::time_point startTime)> QueueCallbackFunction;
 
 /// @brief Wrapper class for InferenceEngine::InferRequest. Handles asynchronous callbacks and calculates execution time.
 class InferReqWrap final {
@@ -34,7 +34,7 @@ public:
         : _request(net.CreateInferRequest()), _id(id), _callbackQueue(callbackQueue) {
         _request.SetCompletionCallback([&]() {
             _endTime = Time::now();
-            _callbackQueue(_id, getExecutionTimeInMilliseconds());
+            _callbackQueue(_id, getExecutionTimeInMilliseconds(), _startTime);
         });
     }
 
@@ -43,6 +43,12 @@ public:
         _request.StartAsync();
     }
 
+    /// @brief Starts the request which was scheduled to start at the given time, the latency is counted from it
+    void startAsync(Time::time_point scheduledTime) {
+        _startTime = scheduledTime;
+        _request.StartAsync();
+    }
+
     void wait() {
         _request.Wait(InferenceEngine::InferRequest::RESULT_READY);
     }
@@ -51,7 +57,7 @@ public:
         _startTime = Time::now();
         _request.Infer();
         _endTime = Time::now();
-        _callbackQueue(_id, getExecutionTimeInMilliseconds());
+        _callbackQueue(_id, getExecutionTimeInMilliseconds(), _startTime);
     }
 
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> getPerformanceCounts() {
@@ -80,7 +86,8 @@ public:
     InferRequestsQueue(InferenceEngine::ExecutableNetwork& net, size_t nireq) {
         for (size_t id = 0; id < nireq; id++) {
             requests.push_back(
-                std::make_shared<InferReqWrap>(net, id, std::bind(&InferRequestsQueue::putIdleRequest, this, std::placeholders::_1, std::placeholders::_2)));
+                std::make_shared<InferReqWrap>(net, id, std::bind(&InferRequestsQueue::putIdleRequest, this, std::placeholders::_1, std::placeholders::_2,
+                                                                 std::placeholders::_3)));
             _idleIds.push(id);
         }
         resetTimes();
@@ -97,18 +104,27 @@ public:
     void resetTimes() {
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
+        _measurementStart = Time::time_point::min();
         _latencies.clear();
     }
 
+    /// @brief Requests started before the given time are excluded from the duration and latencies
+    void setMeasurementStart(Time::time_point measurementStart) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _measurementStart = measurementStart;
+    }
+
     double getDurationInMilliseconds() {
         return std::chrono::duration_cast<ns>(_endTime - _startTime).count() * 0.000001;
     }
 
-    void putIdleRequest(size_t id, const double latency) {
+    void putIdleRequest(size_t id, const double latency, const Time::time_point startTime) {
         std::unique_lock<std::mutex> lock(_mutex);
-        _latencies.push_back(latency);
+        if (startTime >= _measurementStart) {
+            _latencies.push_back(latency);
+            _endTime = std::max(Time::now(), _endTime);
+        }
         _idleIds.push(id);
-        _endTime = std::max(Time::now(), _endTime);
         _cv.notify_one();
     }
 
@@ -119,7 +135,7 @@ public:
         });
         auto request = requests.at(_idleIds.front());
         _idleIds.pop();
-        _startTime = std::min(Time::now(), _startTime);
+        _startTime = std::min(std::max(Time::now(), _measurementStart), _startTime);
         return request;
     }
 
@@ -142,5 +158,6 @@ private:
     std::condition_variable _cv;
     Time::time_point _startTime;
     Time::time_point _endTime;
+    Time::time_point _measurementStart;
     std::vector<double> _latencies;
 };
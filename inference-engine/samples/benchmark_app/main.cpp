@@ -4,15 +4,20 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <cpu/cpu_config.hpp>
 #include <gna/gna_config.hpp>
 #include <gpu/gpu_config.hpp>
 #include <inference_engine.hpp>
 #include <map>
 #include <memory>
+#include <numeric>
+#include <random>
 #include <samples/args_helper.hpp>
 #include <samples/common.hpp>
 #include <samples/slog.hpp>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 #include <vpu/vpu_plugin_config.hpp>
@@ -56,6 +61,18 @@ bool ParseAndCheckCommandLine(int argc, char* argv[]) {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
     }
 
+    if (FLAGS_qps < 0) {
+        throw std::logic_error("Incorrect rate. Please set -qps option to a non-negative value.");
+    }
+
+    if (FLAGS_qps > 0 && FLAGS_api != "async") {
+        throw std::logic_error("Open-loop mode (-qps option) is supported for async API only.");
+    }
+
+    if (FLAGS_arrival != "fixed" && FLAGS_arrival != "poisson") {
+        throw std::logic_error("Incorrect arrival distribution. Please set -arrival option to `fixed` or `poisson` value.");
+    }
+
     if (!FLAGS_report_type.empty() && FLAGS_report_type != noCntReport && FLAGS_report_type != averageCntReport && FLAGS_report_type != detailedCntReport) {
         std::string err = "only " + std::string(noCntReport) + "/" + std::string(averageCntReport) + "/" + std::string(detailedCntReport) +
                           " report types are supported (invalid -report_type option value)";
@@ -107,6 +124,15 @@ T getMedianValue(const std::vector<T>& vec) {
                                        : (sortedVec[sortedVec.size() / 2ULL] + sortedVec[sortedVec.size() / 2ULL - 1ULL]) / static_cast<T>(2.0);
 }
 
+/// @brief Nearest-rank percentile of the sorted values
+template <typename T>
+T getPercentileValue(const std::vector<T>& sortedVec, double percentile) {
+    if (sortedVec.empty())
+        return static_cast<T>(0);
+    size_t rank = static_cast<size_t>(std::ceil(percentile / 100.0 * sortedVec.size()));
+    return sortedVec[std::min(std::max<size_t>(rank, 1), sortedVec.size()) - 1];
+}
+
 /**
  * @brief The entry point of the benchmark application
  */
@@ -260,6 +286,9 @@ int main(int argc, char* argv[]) {
                 if (isFlagSetInCommandLine("enforcebf16"))
                     device_config[CONFIG_KEY(ENFORCE_BF16)] = FLAGS_enforcebf16 ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO);
 
+                if (FLAGS_latency_histograms)
+                    device_config[CPU_CONFIG_KEY(LATENCY_HISTOGRAMS)] = CONFIG_VALUE(YES);
+
                 if (isFlagSetInCommandLine("pin")) {
                     // set to user defined value
                     device_config[CONFIG_KEY(CPU_BIND_THREAD)] = FLAGS_pin;
@@ -473,7 +502,9 @@ int main(int argc, char* argv[]) {
 
         // Iteration limit
         uint32_t niter = FLAGS_niter;
-        if ((niter > 0) && (FLAGS_api == "async")) {
+        // open-loop mode issues exactly the requested number of requests
+        const bool openLoop = FLAGS_qps > 0;
+        if ((niter > 0) && (FLAGS_api == "async") && !openLoop) {
             niter = ((niter + nireq - 1) / nireq) * nireq;
             if (FLAGS_niter != niter) {
                 slog::warn << "Number of iterations was aligned by request number from " << FLAGS_niter << " to " << niter << " using number of requests "
@@ -503,7 +534,14 @@ int main(int argc, char* argv[]) {
                                           {"number of iterations", std::to_string(niter)},
                                           {"number of parallel infer requests", std::to_string(nireq)},
                                           {"duration (ms)", std::to_string(getDurationInMilliseconds(duration_seconds))},
+                                          {"warm-up (ms)", std::to_string(FLAGS_warmup)},
                                       });
+            if (openLoop) {
+                statistics->addParameters(StatisticsReport::Category::RUNTIME_CONFIG, {
+                                                                                          {"offered load (requests per second)", double_to_string(FLAGS_qps)},
+                                                                                          {"arrival distribution", FLAGS_arrival},
+                                                                                      });
+            }
             for (auto& nstreams : device_nstreams) {
                 std::stringstream ss;
                 ss << "number of " << nstreams.first << " streams";
@@ -533,6 +571,9 @@ int main(int argc, char* argv[]) {
                 ss << ", ";
             }
             ss << nireq << " inference requests";
+            if (openLoop) {
+                ss << " started by " << FLAGS_arrival << " schedule of " << FLAGS_qps << " requests per second";
+            }
             std::stringstream device_ss;
             for (auto& nstreams : device_nstreams) {
                 if (!device_ss.str().empty()) {
@@ -578,6 +619,13 @@ int main(int argc, char* argv[]) {
 
         auto startTime = Time::now();
         auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+        inferRequestsQueue.setMeasurementStart(startTime + std::chrono::milliseconds(FLAGS_warmup));
+
+        // open-loop schedule: the next request is started at the planned time even if the previous ones are not
+        // completed yet, so a stall of the device is reflected in the latencies of all requests planned meanwhile
+        std::mt19937_64 arrivalGenerator;
+        std::exponential_distribution<double> arrivalInterval(openLoop ? FLAGS_qps : 1.0);
+        auto nextArrival = startTime;
 
         /** Start inference & calculate performance **/
         /** to align number if iterations to guarantee that last infer requests are
@@ -585,7 +633,10 @@ int main(int argc, char* argv[]) {
         ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
 
         while ((niter != 0LL && iteration < niter) || (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
+               (FLAGS_api == "async" && !openLoop && iteration % nireq != 0)) {
+            if (openLoop) {
+                std::this_thread::sleep_until(nextArrival);
+            }
             inferRequest = inferRequestsQueue.getIdleRequest();
             if (!inferRequest) {
                 IE_THROW() << "No idle Infer Requests!";
@@ -601,7 +652,13 @@ int main(int argc, char* argv[]) {
                 // well, but as it uses just error codes it has no details like ‘what()’
                 // method of `std::exception` So, rechecking for any exceptions here.
                 inferRequest->wait();
-                inferRequest->startAsync();
+                if (openLoop) {
+                    inferRequest->startAsync(nextArrival);
+                    const double interval = FLAGS_arrival == "poisson" ? arrivalInterval(arrivalGenerator) : 1.0 / FLAGS_qps;
+                    nextArrival += std::chrono::duration_cast<Time::duration>(std::chrono::duration<double>(interval));
+                } else {
+                    inferRequest->startAsync();
+                }
             }
             iteration++;
 
@@ -624,9 +681,24 @@ int main(int argc, char* argv[]) {
         // wait the latest inference executions
         inferRequestsQueue.waitAll();
 
-        double latency = getMedianValue<double>(inferRequestsQueue.getLatencies());
+        auto latencies = inferRequestsQueue.getLatencies();
+        if (latencies.empty()) {
+            IE_THROW() << "No inferences were completed after the warm-up time, please increase the duration of the run";
+        }
+        std::sort(latencies.begin(), latencies.end());
+        double latency = getMedianValue<double>(latencies);
         double totalDuration = inferRequestsQueue.getDurationInMilliseconds();
-        double fps = (FLAGS_api == "sync") ? batchSize * 1000.0 / latency : batchSize * 1000.0 * iteration / totalDuration;
+        // requests started within the warm-up time are not counted
+        const size_t measuredIterations = latencies.size();
+        double fps = (FLAGS_api == "sync") ? batchSize * 1000.0 / latency : batchSize * 1000.0 * measuredIterations / totalDuration;
+
+        const std::vector<std::pair<std::string, double>> latencyPercentiles = {
+            {"p50", getPercentileValue(latencies, 50.0)},
+            {"p90", getPercentileValue(latencies, 90.0)},
+            {"p99", getPercentileValue(latencies, 99.0)},
+            {"p99.9", getPercentileValue(latencies, 99.9)},
+            {"max", latencies.back()},
+        };
 
         if (statistics) {
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS, {
@@ -638,6 +710,11 @@ int main(int argc, char* argv[]) {
                                                                                              {"latency (ms)", double_to_string(latency)},
                                                                                          });
             }
+            for (const auto& percentile : latencyPercentiles) {
+                statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS, {
+                                                                                             {"latency " + percentile.first + " (ms)", double_to_string(percentile.second)},
+                                                                                         });
+            }
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS, {{"throughput", double_to_string(fps)}});
         }
 
@@ -679,6 +756,18 @@ int main(int argc, char* argv[]) {
             }
         }
 
+        if (FLAGS_latency_histograms) {
+            try {
+                std::map<std::string, std::vector<double>> percentiles = exeNetwork.GetMetric(CPU_METRIC_KEY(LATENCY_PERCENTILES));
+                printLatencyPercentiles(percentiles, std::cout);
+                if (statistics) {
+                    statistics->dumpLatencyPercentiles(percentiles);
+                }
+            } catch (const std::exception& ex) {
+                slog::err << "Can't get latency percentiles: " << ex.what() << slog::endl;
+            }
+        }
+
         if (statistics)
             statistics->dump();
 
@@ -687,6 +776,45 @@ int main(int argc, char* argv[]) {
         if (device_name.find("MULTI") == std::string::npos)
             std::cout << "Latency:    " << double_to_string(latency) << " ms" << std::endl;
         std::cout << "Throughput: " << double_to_string(fps) << " FPS" << std::endl;
+        std::cout << "Latency percentiles:";
+        for (const auto& percentile : latencyPercentiles) {
+            std::cout << " " << percentile.first << " " << double_to_string(percentile.second) << " ms";
+        }
+        std::cout << std::endl;
+        if (openLoop) {
+            std::cout << "Offered load: " << double_to_string(FLAGS_qps) << " requests per second" << std::endl;
+        }
+
+        if (!FLAGS_json_report.empty()) {
+            std::vector<std::pair<std::string, std::string>> strings = {
+                {"device", device_name},
+                {"api", FLAGS_api},
+                {"mode", openLoop ? "open_loop" : "closed_loop"},
+            };
+            if (openLoop) {
+                strings.push_back({"arrival", FLAGS_arrival});
+            }
+            std::vector<std::pair<std::string, double>> numbers = {
+                {"batch_size", static_cast<double>(batchSize)},
+                {"infer_requests", static_cast<double>(nireq)},
+                {"offered_qps", FLAGS_qps},
+                {"warmup_ms", static_cast<double>(FLAGS_warmup)},
+                {"iterations", static_cast<double>(iteration)},
+                {"measured_iterations", static_cast<double>(measuredIterations)},
+                {"duration_ms", totalDuration},
+                {"throughput_fps", fps},
+                {"latency_median_ms", latency},
+                {"latency_avg_ms", std::accumulate(latencies.begin(), latencies.end(), 0.0) / latencies.size()},
+                {"latency_min_ms", latencies.front()},
+            };
+            for (const auto& percentile : latencyPercentiles) {
+                std::string key = "latency_" + percentile.first + "_ms";
+                std::replace(key.begin(), key.end(), '.', '_');
+                numbers.push_back({key, percentile.second});
+            }
+            dumpJsonReport(FLAGS_json_report, strings, numbers);
+            slog::info << "JSON report is stored to " << FLAGS_json_report << slog::endl;
+        }
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
 
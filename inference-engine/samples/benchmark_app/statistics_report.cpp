@@ -141,3 +141,28 @@ void StatisticsReport::dumpPerformanceCounters(const std::vector<PerformaceCount
     }
     slog::info << "Performance counters report is stored to " << dumper.getFilename() << slog::endl;
 }
+
+void StatisticsReport::dumpLatencyPercentiles(const std::map<std::string, std::vector<double>>& percentiles) {
+    if (percentiles.empty()) {
+        slog::info << "Latency percentiles are empty. No reports are dumped." << slog::endl;
+        return;
+    }
+    CsvDumper dumper(true, _config.report_folder + _separator + "benchmark_latency_percentiles_report.csv");
+    dumper << "layerName"
+           << "count"
+           << "p50 (ms)"
+           << "p90 (ms)"
+           << "p99 (ms)"
+           << "max (ms)";
+    dumper.endLine();
+    for (const auto& item : percentiles) {
+        const auto& stats = item.second;
+        if (stats.size() < 5)
+            continue;
+        dumper << (item.first.empty() ? "Total" : item.first) << static_cast<uint64_t>(stats[0]);
+        for (size_t i = 1; i < 5; i++)
+            dumper << std::to_string(stats[i] / 1000.0);
+        dumper.endLine();
+    }
+    slog::info << "Latency percentiles report is stored to " << dumper.getFilename() << slog::endl;
+}
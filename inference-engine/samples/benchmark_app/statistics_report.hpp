@@ -56,6 +56,9 @@ public:
 
     void dumpPerformanceCounters(const std::vector<PerformaceCounters>& perfCounts);
 
+    /// @brief Dumps {count, p50, p90, p99, max} latencies (in microseconds) of each layer, empty name is the whole inference
+    void dumpLatencyPercentiles(const std::map<std::string, std::vector<double>>& percentiles);
+
 private:
     void dumpPerformanceCountersRequest(CsvDumper& dumper, const PerformaceCounters& perfCounts);
 
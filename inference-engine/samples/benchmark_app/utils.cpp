@@ -4,6 +4,10 @@
 
 // clang-format off
 #include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <limits>
 #include <map>
 #include <regex>
 #include <samples/common.hpp>
@@ -88,6 +92,80 @@ std::vector<std::string> split(const std::string& s, char delim) {
     return result;
 }
 
+void printLatencyPercentiles(const std::map<std::string, std::vector<double>>& percentiles, std::ostream& stream) {
+    // each value is {count, p50, p90, p99, max}, the empty name is the whole inference
+    const auto flags = stream.flags();
+    const auto precision = stream.precision();
+    stream << std::fixed << std::setprecision(3);
+    stream << std::setw(30) << std::left << "layerName" << std::setw(12) << std::right << "count"
+           << std::setw(12) << "p50 (ms)" << std::setw(12) << "p90 (ms)" << std::setw(12) << "p99 (ms)"
+           << std::setw(12) << "max (ms)" << std::endl;
+    for (const auto& item : percentiles) {
+        const auto& stats = item.second;
+        if (stats.size() < 5)
+            continue;
+        std::string name = item.first.empty() ? "<inference>" : item.first;
+        if (name.length() >= 30) {
+            name = name.substr(0, 26) + "...";
+        }
+        stream << std::setw(30) << std::left << name << std::setw(12) << std::right << static_cast<uint64_t>(stats[0]);
+        for (size_t i = 1; i < 5; i++)
+            stream << std::setw(12) << stats[i] / 1000.0;
+        stream << std::endl;
+    }
+    stream.flags(flags);
+    stream.precision(precision);
+}
+
+static std::string jsonEscape(const std::string& value) {
+    std::stringstream ss;
+    for (char c : value) {
+        switch (c) {
+        case '"':
+            ss << "\\\"";
+            break;
+        case '\\':
+            ss << "\\\\";
+            break;
+        case '\n':
+            ss << "\\n";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                ss << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+            } else {
+                ss << c;
+            }
+        }
+    }
+    return ss.str();
+}
+
+void dumpJsonReport(const std::string& filename, const std::vector<std::pair<std::string, std::string>>& strings,
+                    const std::vector<std::pair<std::string, double>>& numbers) {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        throw std::runtime_error("Can't open file '" + filename + "' to dump the JSON report");
+    }
+    file << "{" << std::endl;
+    const size_t total = strings.size() + numbers.size();
+    size_t written = 0;
+    for (const auto& item : strings) {
+        file << "    \"" << jsonEscape(item.first) << "\": \"" << jsonEscape(item.second) << "\"";
+        file << (++written < total ? "," : "") << std::endl;
+    }
+    file << std::setprecision(std::numeric_limits<double>::max_digits10);
+    for (const auto& item : numbers) {
+        file << "    \"" << jsonEscape(item.first) << "\": ";
+        if (std::isfinite(item.second))
+            file << item.second;
+        else
+            file << "null";
+        file << (++written < total ? "," : "") << std::endl;
+    }
+    file << "}" << std::endl;
+}
+
 std::vector<std::string> parseDevices(const std::string& device_string) {
     std::string comma_separated_devices = device_string;
     if (comma_separated_devices.find(":") != std::string::npos) {
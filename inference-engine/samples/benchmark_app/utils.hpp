@@ -5,7 +5,9 @@
 #pragma once
 
 #include <map>
+#include <ostream>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace benchmark_app {
@@ -31,6 +33,9 @@ std::map<std::string, std::string> parseNStreamsValuePerDevice(const std::vector
 std::string getShapesString(const InferenceEngine::ICNNNetwork::InputShapes& shapes);
 size_t getBatchSize(const benchmark_app::InputsInfo& inputs_info);
 std::vector<std::string> split(const std::string& s, char delim);
+void printLatencyPercentiles(const std::map<std::string, std::vector<double>>& percentiles, std::ostream& stream);
+void dumpJsonReport(const std::string& filename, const std::vector<std::pair<std::string, std::string>>& strings,
+                    const std::vector<std::pair<std::string, double>>& numbers);
 
 template <typename T>
 std::map<std::string, std::string> parseInputParameters(const std::string parameter_string, const std::map<std::string, T>& input_info) {
@@ -12,6 +12,7 @@
 #include <blob_factory.hpp>
 
 
+#include <algorithm>
 #include <cassert>
 #include <map>
 #include <memory>
@@ -45,6 +46,32 @@ using details::CNNNetworkNGraphImpl;
 using InferenceEngine::details::CNNNetworkNGraphImpl;
 using ngraph::Function;
 
+namespace {
+
+/**
+ * Revalidates only the operations which depend on the replaced parameters. Validation of the operation depends on
+ * its producers only, so the rest of the function (including the constant subgraphs) keeps the inferred types.
+ */
+void validateAffectedNodesAndInferTypes(const std::shared_ptr<Function>& function,
+                                        const std::unordered_set<const ngraph::Node*>& changedParameters) {
+    OV_ITT_SCOPED_TASK(itt::domains::IE, "CNNNetworkNGraphImpl::reshape::InferTypes");
+
+    std::unordered_set<const ngraph::Node*> affected(changedParameters);
+    for (const auto& op : function->get_ordered_ops()) {
+        if (affected.count(op.get()) == 0) {
+            const auto inputs = op->input_values();
+            const bool dependsOnChanged = std::any_of(inputs.begin(), inputs.end(),
+                [&](const ngraph::Output<ngraph::Node>& input) { return affected.count(input.get_node()) != 0; });
+            if (!dependsOnChanged)
+                continue;
+            affected.insert(op.get());
+        }
+        op->revalidate_and_infer_types();
+    }
+}
+
+}  // namespace
+
 void CNNNetworkNGraphImpl::createDataForResult(const ::ngraph::Output<::ngraph::Node>& output, const std::string& outName,
                                                DataPtr& ptr) {
     const auto isCompatible = [](size_t size, const Layout& l) -> bool {
@@ -362,19 +389,22 @@ CNNNetworkNGraphImpl::reshape(const std::map<std::string, ngraph::PartialShape>&
 
     auto params = _ngraph_function->get_parameters();
 
-    bool parameter_replaced = false;
+    std::unordered_set<const ngraph::Node*> replacedParams;
     for (size_t i = 0; i < params.size(); i++) {
         const auto& param = params[i];
         if (inputShapes.find(param->get_friendly_name()) == inputShapes.end())
             continue;
         ::ngraph::PartialShape shape(inputShapes.at(param->get_friendly_name()));
+        // repeated reshape to the same shape leaves the dependent operations as is
+        if (param->get_partial_shape().same_scheme(shape))
+            continue;
         auto newParam = std::make_shared<::ngraph::op::Parameter>(param->get_element_type(), shape);
         newParam->set_friendly_name(param->get_friendly_name());
         _ngraph_function->replace_parameter(i, newParam);
-        parameter_replaced = true;
+        replacedParams.insert(newParam.get());
     }
-    if (parameter_replaced)
-        _ngraph_function->validate_nodes_and_infer_types();
+    if (!replacedParams.empty())
+        validateAffectedNodesAndInferTypes(_ngraph_function, replacedParams);
 
     const auto& results = _ngraph_function->get_results();
     bool outputs_are_static = all_of(
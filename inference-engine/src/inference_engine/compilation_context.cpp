@@ -7,18 +7,30 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
 #ifndef WIN32
 #include <unistd.h>
 #endif
 #include <xml_parse_utils.h>
 
 #include "ie_itt.hpp"
-#include "transformations/serialize.hpp"
+#include "ie_parallel.hpp"
 #include "cpp/ie_cnn_network.h"
 #include "details/ie_exception.hpp"
 
 #include "ngraph/variant.hpp"
 #include "ngraph/opsets/opset6.hpp"
+#include "ngraph/op/util/variable.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph_ops/framework_node.hpp"
 #include "transformations/rt_info/dequantization_attribute.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
@@ -41,27 +53,384 @@ static int32_t as_int32_t(T v) {
     return static_cast<int32_t>(v);
 }
 
-class OstreamHashWrapper final: public std::streambuf {
-    std::size_t m_res = 0;
+//////////////////////////////////////////////////
+// Hash of the network weights
+//
+// Constant buffers are hashed in place with the 64-bit xxHash algorithm. Large buffers are split into chunks which are
+// hashed in parallel, so the result does not depend on the number of threads. Hashes of large buffers are memoized
+// until the buffer is released, so repeated compilations of the same (or cloned) network do not read weights again.
+
+static constexpr uint64_t prime1 = 0x9E3779B185EBCA87ULL;
+static constexpr uint64_t prime2 = 0xC2B2AE3D27D4EB4FULL;
+static constexpr uint64_t prime3 = 0x165667B19E3779F9ULL;
+static constexpr uint64_t prime4 = 0x85EBCA77C2B2AE63ULL;
+static constexpr uint64_t prime5 = 0x27D4EB2F165667C5ULL;
+
+static inline uint64_t rotl64(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+static inline uint64_t read64(const uint8_t* p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline uint32_t read32(const uint8_t* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline uint64_t xxRound(uint64_t acc, uint64_t input) {
+    acc += input * prime2;
+    acc = rotl64(acc, 31);
+    return acc * prime1;
+}
+
+static inline uint64_t xxMergeRound(uint64_t acc, uint64_t val) {
+    acc ^= xxRound(0, val);
+    return acc * prime1 + prime4;
+}
+
+static uint64_t hashBytes(const uint8_t* p, std::size_t size, uint64_t seed) {
+    const uint8_t* const end = p + size;
+    uint64_t h;
+
+    if (size >= 32) {
+        const uint8_t* const limit = end - 32;
+        // four independent lanes, the loop is limited by the memory bandwidth rather than by the dependency chain
+        uint64_t v1 = seed + prime1 + prime2;
+        uint64_t v2 = seed + prime2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - prime1;
+        do {
+            v1 = xxRound(v1, read64(p));
+            v2 = xxRound(v2, read64(p + 8));
+            v3 = xxRound(v3, read64(p + 16));
+            v4 = xxRound(v4, read64(p + 24));
+            p += 32;
+        } while (p <= limit);
+
+        h = rotl64(v1, 1) + rotl64(v2, 7) + rotl64(v3, 12) + rotl64(v4, 18);
+        h = xxMergeRound(h, v1);
+        h = xxMergeRound(h, v2);
+        h = xxMergeRound(h, v3);
+        h = xxMergeRound(h, v4);
+    } else {
+        h = seed + prime5;
+    }
+
+    h += static_cast<uint64_t>(size);
+
+    for (; p + 8 <= end; p += 8) {
+        h ^= xxRound(0, read64(p));
+        h = rotl64(h, 27) * prime1 + prime4;
+    }
+    if (p + 4 <= end) {
+        h ^= static_cast<uint64_t>(read32(p)) * prime1;
+        h = rotl64(h, 23) * prime2 + prime3;
+        p += 4;
+    }
+    for (; p < end; p++) {
+        h ^= static_cast<uint64_t>(*p) * prime5;
+        h = rotl64(h, 11) * prime1;
+    }
+
+    h ^= h >> 33;
+    h *= prime2;
+    h ^= h >> 29;
+    h *= prime3;
+    h ^= h >> 32;
+    return h;
+}
+
+static uint64_t hashBuffer(const void* data, std::size_t size) {
+    constexpr std::size_t chunkSize = 1 << 20;
+    const auto bytes = static_cast<const uint8_t*>(data);
+    if (size <= chunkSize)
+        return hashBytes(bytes, size, 0);
+
+    const std::size_t chunks = (size + chunkSize - 1) / chunkSize;
+    std::vector<uint64_t> chunkHashes(chunks);
+    parallel_for(chunks, [&](std::size_t i) {
+        const std::size_t offset = i * chunkSize;
+        chunkHashes[i] = hashBytes(bytes + offset, std::min(chunkSize, size - offset), i);
+    });
+    return hashBytes(reinterpret_cast<const uint8_t*>(chunkHashes.data()), chunks * sizeof(uint64_t), size);
+}
+
+class ConstantHashCache final {
+    struct Entry {
+        std::weak_ptr<ngraph::runtime::AlignedBuffer> buffer;
+        uint64_t hash;
+    };
+
+    std::mutex m_mutex;
+    std::unordered_map<const ngraph::runtime::AlignedBuffer*, Entry> m_entries;
+    std::size_t m_purgeSize = 1024;
+
 public:
-    std::size_t getResult() const { return m_res; }
-    std::streamsize xsputn(const char* s, std::streamsize n) override {
-        const std::int64_t* intS = (const std::int64_t *)s;
-        std::streamsize n64 = n / sizeof(std::int64_t);
-        std::streamsize i = 0;
-        // Using 64-bit values executes much faster than char
-        while (i++ < n64) {
-            m_res += *(intS++);
+    // Smaller buffers are cheaper to hash than to look up
+    static constexpr std::size_t minSize = 1 << 16;
+
+    static ConstantHashCache& instance() {
+        static ConstantHashCache cache;
+        return cache;
+    }
+
+    bool find(const std::shared_ptr<ngraph::runtime::AlignedBuffer>& buffer, uint64_t& hash) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_entries.find(buffer.get());
+        // the address may belong to a new buffer allocated after the memoized one was released
+        if (it == m_entries.end() || it->second.buffer.lock() != buffer)
+            return false;
+        hash = it->second.hash;
+        return true;
+    }
+
+    void insert(const std::shared_ptr<ngraph::runtime::AlignedBuffer>& buffer, uint64_t hash) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_entries.size() >= m_purgeSize) {
+            for (auto it = m_entries.begin(); it != m_entries.end();) {
+                it = it->second.buffer.expired() ? m_entries.erase(it) : std::next(it);
+            }
+            m_purgeSize = std::max<std::size_t>(1024, m_entries.size() * 2);
         }
+        m_entries[buffer.get()] = {buffer, hash};
+    }
+};
+
+static uint64_t hashConstantBuffer(const std::shared_ptr<ngraph::runtime::AlignedBuffer>& buffer) {
+    if (!buffer)
+        return 0;
+    const auto size = buffer->size();
+    if (size < ConstantHashCache::minSize)
+        return hashBuffer(buffer->get_ptr(), size);
+
+    auto& cache = ConstantHashCache::instance();
+    uint64_t hash = 0;
+    if (!cache.find(buffer, hash)) {
+        hash = hashBuffer(buffer->get_ptr(), size);
+        cache.insert(buffer, hash);
+    }
+    return hash;
+}
+
+//////////////////////////////////////////////////
+// Hash of the network structure
+//
+// Walks the function in the topological order and hashes the same information as the IR serialization does: types,
+// names, connections, port precisions and shapes, and all attributes visited by the operations. Constant buffers
+// are only collected here, their contents are hashed afterwards in parallel.
+
+using ConstantBuffers = std::vector<std::shared_ptr<ngraph::runtime::AlignedBuffer>>;
+
+static void hashFunction(const ngraph::Function& function, std::size_t& seed, ConstantBuffers& buffers);
+
+class FunctionHashVisitor final : public ngraph::AttributeVisitor {
+    std::size_t& m_seed;
+    ConstantBuffers& m_buffers;
+
+    template <typename T>
+    void hashValue(const std::string& name, const T& value) {
+        m_seed = hash_combine(m_seed, name);
+        m_seed = hash_combine(m_seed, value);
+    }
+
+    template <typename T>
+    void hashValues(const std::string& name, const std::vector<T>& values) {
+        m_seed = hash_combine(m_seed, name);
+        m_seed = hash_combine(m_seed, values.size());
+        for (const auto& value : values)
+            m_seed = hash_combine(m_seed, value);
+    }
 
-        std::streamsize rest = n % sizeof(std::int64_t);
-        for (i = 0; i < rest; i++) {
-            m_res += s[n - rest + i];
+public:
+    FunctionHashVisitor(std::size_t& seed, ConstantBuffers& buffers) : m_seed(seed), m_buffers(buffers) {}
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        using InputDescriptions = std::vector<std::shared_ptr<ngraph::op::util::SubGraphOp::InputDescription>>;
+        using OutputDescriptions = std::vector<std::shared_ptr<ngraph::op::util::SubGraphOp::OutputDescription>>;
+
+        m_seed = hash_combine(m_seed, name);
+        if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter)) {
+            // only the position of the buffer is hashed here, a buffer shared by several constants is hashed once
+            const auto& buffer = a->get();
+            auto it = std::find(m_buffers.begin(), m_buffers.end(), buffer);
+            m_seed = hash_combine(m_seed, static_cast<std::size_t>(std::distance(m_buffers.begin(), it)));
+            if (it == m_buffers.end())
+                m_buffers.push_back(buffer);
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::Variable>>>(&adapter)) {
+            m_seed = hash_combine(m_seed, a->get()->get_info().variable_id);
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<InputDescriptions>>(&adapter)) {
+            for (const auto& desc : a->get()) {
+                m_seed = hash_combine(m_seed, std::string(desc->get_type_info().name));
+                m_seed = hash_combine(m_seed, desc->m_input_index);
+                m_seed = hash_combine(m_seed, desc->m_body_parameter_index);
+                if (const auto& slice = ngraph::as_type_ptr<ngraph::op::util::SubGraphOp::SliceInputDescription>(desc)) {
+                    for (auto v : {slice->m_start, slice->m_stride, slice->m_part_size, slice->m_end, slice->m_axis})
+                        m_seed = hash_combine(m_seed, v);
+                } else if (const auto& merged = ngraph::as_type_ptr<ngraph::op::util::SubGraphOp::MergedInputDescription>(desc)) {
+                    m_seed = hash_combine(m_seed, merged->m_body_value_index);
+                }
+            }
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<OutputDescriptions>>(&adapter)) {
+            for (const auto& desc : a->get()) {
+                m_seed = hash_combine(m_seed, std::string(desc->get_type_info().name));
+                m_seed = hash_combine(m_seed, desc->m_body_value_index);
+                m_seed = hash_combine(m_seed, desc->m_output_index);
+                if (const auto& concat = ngraph::as_type_ptr<ngraph::op::util::SubGraphOp::ConcatOutputDescription>(desc)) {
+                    for (auto v : {concat->m_start, concat->m_stride, concat->m_part_size, concat->m_end, concat->m_axis})
+                        m_seed = hash_combine(m_seed, v);
+                } else if (const auto& body = ngraph::as_type_ptr<ngraph::op::util::SubGraphOp::BodyOutputDescription>(desc)) {
+                    m_seed = hash_combine(m_seed, body->m_iteration);
+                }
+            }
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::op::v5::Loop::SpecialBodyPorts>>(&adapter)) {
+            m_seed = hash_combine(m_seed, a->get().current_iteration_input_idx);
+            m_seed = hash_combine(m_seed, a->get().body_condition_output_idx);
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::op::FrameworkNodeAttrs>>(&adapter)) {
+            const auto& attrs = a->get();
+            m_seed = hash_combine(m_seed, attrs.get_type_name());
+            m_seed = hash_combine(m_seed, attrs.get_opset_name());
+            // the attributes are stored in the unordered map
+            const std::map<std::string, std::string> sorted(attrs.begin(), attrs.end());
+            for (const auto& attr : sorted) {
+                m_seed = hash_combine(m_seed, attr.first);
+                m_seed = hash_combine(m_seed, attr.second);
+            }
+        } else {
+            IE_THROW() << "Unsupported attribute type for the network hash: " << name;
         }
-        return n;
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int8_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int16_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int32_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint8_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint16_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint32_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint64_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<float>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int8_t>>& adapter) override {
+        hashValues(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int16_t>>& adapter) override {
+        hashValues(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        hashValues(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        hashValues(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint8_t>>& adapter) override {
+        hashValues(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint16_t>>& adapter) override {
+        hashValues(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint32_t>>& adapter) override {
+        hashValues(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        hashValues(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override {
+        hashValues(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<double>>& adapter) override {
+        hashValues(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        hashValues(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::shared_ptr<ngraph::Function>>& adapter) override {
+        m_seed = hash_combine(m_seed, name);
+        hashFunction(*adapter.get(), m_seed, m_buffers);
     }
 };
 
+static void hashPartialShape(std::size_t& seed, const ngraph::PartialShape& shape) {
+    if (shape.rank().is_dynamic()) {
+        seed = hash_combine(seed, -1);
+        return;
+    }
+    seed = hash_combine(seed, shape.rank().get_length());
+    for (const auto& dim : shape) {
+        seed = hash_combine(seed, dim.get_min_length());
+        seed = hash_combine(seed, dim.get_max_length());
+    }
+}
+
+static void hashFunction(const ngraph::Function& function, std::size_t& seed, ConstantBuffers& buffers) {
+    seed = hash_combine(seed, function.get_friendly_name());
+
+    std::unordered_map<const ngraph::Node*, std::size_t> ids;
+    FunctionHashVisitor visitor(seed, buffers);
+    for (const auto& op : function.get_ordered_ops()) {
+        const std::size_t id = ids.size();
+        ids[op.get()] = id;
+
+        const auto& typeInfo = op->get_type_info();
+        seed = hash_combine(seed, std::string(typeInfo.name));
+        seed = hash_combine(seed, typeInfo.version);
+        seed = hash_combine(seed, op->get_friendly_name());
+
+        for (const auto& input : op->inputs()) {
+            const auto source = input.get_source_output();
+            seed = hash_combine(seed, ids.at(source.get_node()));
+            seed = hash_combine(seed, source.get_index());
+        }
+
+        for (const auto& output : op->outputs()) {
+            seed = hash_combine(seed, output.get_element_type().get_type_name());
+            hashPartialShape(seed, output.get_partial_shape());
+            const auto& names = output.get_tensor().get_names();
+            const std::set<std::string> sortedNames(names.begin(), names.end());
+            for (const auto& name : sortedNames)
+                seed = hash_combine(seed, name);
+        }
+
+        op->visit_attributes(visitor);
+    }
+
+    // order of the parameters and results defines the order of the network inputs and outputs
+    for (const auto& parameter : function.get_parameters())
+        seed = hash_combine(seed, ids.at(parameter.get()));
+    for (const auto& result : function.get_results())
+        seed = hash_combine(seed, ids.at(result.get()));
+}
+
 //////////////////////////////////////////////////
 
 std::string NetworkCompilationContext::calculateFileInfo(const std::string& filePath) {
@@ -87,29 +456,27 @@ std::string NetworkCompilationContext::calculateFileInfo(const std::string& file
 std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
                                const std::map<std::string, std::string>& compileOptions) {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IE_LT, "NetworkCompilationContext::computeHash - CNN");
-    OstreamHashWrapper xmlHash;
-    OstreamHashWrapper binHash;
-    std::ostream xml(&xmlHash);
-    std::ostream bin(&binHash);
-
     IE_ASSERT(network.getFunction());
 
-    // 1. Serialize
-    CNNNetwork net(network);
-    ngraph::pass::Serialize serializer(xml, bin,
-        ngraph::pass::Serialize::Version::IR_V10);
-    serializer.run_on_function(net.getFunction());
-
-    // 2. Compute hash on serialized data and options
+    // 1. Hash the network structure and the weights
     size_t seed = 0;
-    seed = hash_combine(seed, xmlHash.getResult());
-    seed = hash_combine(seed, binHash.getResult());
+    ConstantBuffers buffers;
+    hashFunction(*network.getFunction(), seed, buffers);
+
+    std::vector<uint64_t> buffersHashes(buffers.size());
+    parallel_for(buffers.size(), [&](size_t i) {
+        buffersHashes[i] = hashConstantBuffer(buffers[i]);
+    });
+    for (auto hash : buffersHashes) {
+        seed = hash_combine(seed, hash);
+    }
 
+    // 2. Add compile options
     for (const auto& kvp : compileOptions) {
         seed = hash_combine(seed, kvp.first + kvp.second);
     }
 
-    // 3. Add runtime information which may not be serialized
+    // 3. Add runtime information
     for (const auto& op : network.getFunction()->get_ordered_ops()) {
         const auto& rt = op->get_rt_info();
         for (const auto& rtMapData : rt) {
@@ -2,9 +2,11 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 #include <mutex>
 #include <sys/stat.h>
@@ -27,6 +29,7 @@
 #include "xml_parse_utils.h"
 #include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "cpp_interfaces/interface/ie_iexecutable_network_internal.hpp"
+#include "threading/ie_executor_manager.hpp"
 
 using namespace InferenceEngine::PluginConfigParams;
 using namespace std::placeholders;
@@ -196,6 +199,23 @@ class Core::Impl : public ICore, public std::enable_shared_from_this<ICore> {
 
                 config.erase(it);
             }
+
+            it = config.find(CONFIG_KEY(MMAP_WEIGHTS));
+            if (it != config.end()) {
+                if (it->second == CONFIG_VALUE(YES)) {
+                    _mmapWeights = true;
+                } else if (it->second == CONFIG_VALUE(NO)) {
+                    _mmapWeights = false;
+                } else {
+                    IE_THROW() << "Wrong value " << it->second << " for property key " << CONFIG_KEY(MMAP_WEIGHTS)
+                               << ". Expected only YES/NO";
+                }
+                config.erase(it);
+            }
+        }
+
+        bool mmapWeights() const {
+            return _mmapWeights;
         }
 
         // Creating thread-safe copy of config including shared_ptr to ICacheManager
@@ -207,6 +227,7 @@ class Core::Impl : public ICore, public std::enable_shared_from_this<ICore> {
     private:
         mutable std::mutex _cacheConfigMutex;
         CacheConfig _cacheConfig;
+        std::atomic<bool> _mmapWeights {false};
     };
 
     // Core settings (cache config, etc)
@@ -477,7 +498,7 @@ public:
 
     CNNNetwork ReadNetwork(const std::string& modelPath, const std::string& binPath) const override {
         OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IE_RT, "Core::Impl::ReadNetwork from file");
-        return details::ReadNetwork(modelPath, binPath, extensions);
+        return details::ReadNetwork(modelPath, binPath, extensions, coreConfig.mmapWeights());
     }
 
     CNNNetwork ReadNetwork(const std::string& model, const Blob::CPtr& weights) const override {
@@ -958,6 +979,38 @@ ExecutableNetwork Core::LoadNetwork(const std::string& modelPath, const std::str
     return { exec, exec };
 }
 
+std::vector<ExecutableNetwork> Core::LoadNetworks(const std::vector<std::string>& modelPaths,
+                                                  const std::string& deviceName,
+                                                  const std::map<std::string, std::string>& config,
+                                                  size_t maxConcurrency) {
+    OV_ITT_SCOPED_TASK(itt::domains::IE_LT, "Core::LoadNetworks");
+    const size_t hardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    if (maxConcurrency == 0)
+        maxConcurrency = hardwareThreads;
+    const size_t streams = std::min(maxConcurrency, modelPaths.size());
+
+    std::vector<ExecutableNetwork> networks(modelPaths.size());
+    // the plugins and the caches are shared by Core, so the models are loaded as independent tasks
+    std::vector<Task> loads;
+    for (size_t i = 0; i < modelPaths.size(); i++) {
+        loads.push_back([&, i] {
+            auto exec = _impl->LoadNetwork(modelPaths[i], deviceName, config);
+            networks[i] = { exec, exec };
+        });
+    }
+    if (loads.empty())
+        return networks;
+    // the cores are split between the loads, so the parallel reading, transformations and compilation of each
+    // model are not serialized by the stream arena
+    const size_t threadsPerStream = std::max<size_t>(1, hardwareThreads / streams);
+    // runAndWait rethrows the first error after all the loads are finished
+    auto executor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
+            IStreamsExecutor::Config{"CoreLoadNetworks", static_cast<int>(streams), static_cast<int>(threadsPerStream),
+                                     IStreamsExecutor::ThreadBindingType::NONE});
+    executor->runAndWait(loads);
+    return networks;
+}
+
 RemoteContext::Ptr Core::CreateContext(const std::string& deviceName, const ParamMap& params) {
     if (deviceName.find("HETERO") == 0) {
         IE_THROW() << "HETERO device does not support remote context";
@@ -4,6 +4,7 @@
 
 #include "ie_network_reader.hpp"
 #include "ie_itt.hpp"
+#include "mapped_file_allocator.hpp"
 
 #include <details/ie_so_pointer.hpp>
 #include <file_utils.h>
@@ -149,9 +150,37 @@ void assertIfIRv7LikeModel(std::istream & modelStream) {
                                                          "version of the OpenVINO to generate supported IR version.";
 }
 
+template <typename PathT>
+Blob::Ptr readWeights(const std::string& binPath, const PathT& weightsPath, bool mmapWeights) {
+    std::ifstream binStream;
+    binStream.open(weightsPath, std::ios::binary);
+    if (!binStream.is_open())
+        IE_THROW() << "Weights file " << binPath << " cannot be opened!";
+
+    binStream.seekg(0, std::ios::end);
+    size_t fileSize = binStream.tellg();
+    binStream.seekg(0, std::ios::beg);
+
+    TensorDesc desc(Precision::U8, { fileSize }, C);
+    if (mmapWeights) {
+        // the IR readers wrap the weights into Constants without copying, so the mapped weights are only read from
+        // the file when the Constants are used
+        auto weights = make_shared_blob<uint8_t>(desc, std::make_shared<MappedFileAllocator>(binPath));
+        weights->allocate();
+        if (weights->cbuffer().as<const uint8_t*>() != nullptr)
+            return weights;
+    }
+
+    auto weights = make_shared_blob<uint8_t>(desc);
+    weights->allocate();
+    binStream.read(weights->buffer(), fileSize);
+    return weights;
+}
+
 }  // namespace
 
-CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string& binPath, const std::vector<IExtensionPtr>& exts) {
+CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string& binPath, const std::vector<IExtensionPtr>& exts,
+                                bool mmapWeights) {
     // Register readers if it is needed
     registerReaders();
 
@@ -200,22 +229,10 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string&
 #else
                 std::string weights_path = bPath;
 #endif
-                std::ifstream binStream;
-                binStream.open(weights_path, std::ios::binary);
-                if (!binStream.is_open())
-                    IE_THROW() << "Weights file " << bPath << " cannot be opened!";
-
-                binStream.seekg(0, std::ios::end);
-                size_t fileSize = binStream.tellg();
-                binStream.seekg(0, std::ios::beg);
-
-                Blob::Ptr weights = make_shared_blob<uint8_t>({Precision::U8, { fileSize }, C });
-
+                Blob::Ptr weights;
                 {
                     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IE_RT, "ReadNetworkWeights");
-                    weights->allocate();
-                    binStream.read(weights->buffer(), fileSize);
-                    binStream.close();
+                    weights = readWeights(bPath, weights_path, mmapWeights);
                 }
 
                 // read model with weights
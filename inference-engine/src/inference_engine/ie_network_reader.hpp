@@ -18,9 +18,11 @@ namespace details {
  * @param binPath path to bin file, if path is empty, will try to read bin file with the same name as xml and
  * if bin file with the same name was not found, will load IR without weights.
  * @param exts vector with extensions
+ * @param mmapWeights if true, the weights file is mapped into memory instead of being read, see CONFIG_KEY(MMAP_WEIGHTS)
  * @return CNNNetwork
  */
-CNNNetwork ReadNetwork(const std::string& modelPath, const std::string& binPath, const std::vector<IExtensionPtr>& exts);
+CNNNetwork ReadNetwork(const std::string& modelPath, const std::string& binPath, const std::vector<IExtensionPtr>& exts,
+                       bool mmapWeights = false);
 /**
  * @brief Reads IR xml and bin (with the same name) files
  * @param model string with IR
@@ -0,0 +1,76 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mapped_file_allocator.hpp"
+
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace InferenceEngine {
+
+MappedFileAllocator::~MappedFileAllocator() {
+    // the weights blob unmaps the file on its deallocation, a mapping is left only if the blob was never deallocated
+    std::vector<void*> handles;
+    for (auto& mapping : _mappings)
+        handles.push_back(mapping.first);
+    for (auto handle : handles)
+        free(handle);
+}
+
+void* MappedFileAllocator::alloc(size_t size) noexcept {
+#ifndef _WIN32
+    // mmap doesn't accept empty mappings
+    if (size == 0)
+        return nullptr;
+
+    int fd = open(_path.c_str(), O_RDONLY);
+    if (fd == -1)
+        return nullptr;
+
+    struct stat info;
+    void* handle = MAP_FAILED;
+    if (fstat(fd, &info) == 0 && static_cast<size_t>(info.st_size) >= size)
+        handle = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    // the mapping keeps the file referenced
+    close(fd);
+    if (handle == MAP_FAILED)
+        return nullptr;
+
+    try {
+        std::lock_guard<std::mutex> lock(_guard);
+        _mappings.emplace(handle, size);
+    } catch (...) {
+        munmap(handle, size);
+        return nullptr;
+    }
+    return handle;
+#else
+    return nullptr;
+#endif
+}
+
+bool MappedFileAllocator::free(void* handle) noexcept {
+#ifndef _WIN32
+    size_t size = 0;
+    {
+        std::lock_guard<std::mutex> lock(_guard);
+        auto it = _mappings.find(handle);
+        if (it == _mappings.end())
+            return false;
+        size = it->second;
+        _mappings.erase(it);
+    }
+    return munmap(handle, size) == 0;
+#else
+    return false;
+#endif
+}
+
+}  // namespace InferenceEngine
@@ -0,0 +1,45 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ie_allocator.hpp"
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace InferenceEngine {
+
+/**
+ * @brief Allocator mapping the file into memory instead of allocating it
+ *
+ * The file is mapped copy-on-write, so the pages are read from the file on the first access and the writes to the
+ * memory are not propagated to the file. It allows the blobs which are wrapped by the ngraph Constants to stay backed
+ * by the file until their data is used, so the memory of the weights which are not compiled is never loaded.
+ * The file must not be truncated while the memory is mapped.
+ * alloc() returns nullptr if the file can't be mapped (e.g. on Windows or if it's smaller than the requested size),
+ * callers are expected to fall back to the regular allocation.
+ */
+class MappedFileAllocator : public IAllocator {
+public:
+    explicit MappedFileAllocator(const std::string& path) : _path(path) {}
+    ~MappedFileAllocator();
+
+    void* lock(void* handle, LockOp = LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(size_t size) noexcept override;
+    bool free(void* handle) noexcept override;
+
+private:
+    const std::string _path;
+    std::mutex _guard;
+    std::unordered_map<void*, size_t> _mappings;
+};
+
+}  // namespace InferenceEngine
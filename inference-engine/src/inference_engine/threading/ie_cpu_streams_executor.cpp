@@ -9,6 +9,10 @@
 #include <condition_variable>
 #include <thread>
 #include <queue>
+#include <deque>
+#include <map>
+#include <functional>
+#include <algorithm>
 #include <atomic>
 #include <climits>
 #include <cassert>
@@ -156,6 +160,9 @@ struct CPUStreamsExecutor::Impl {
         int _numaNodeId = 0;
         bool _execute = false;
         std::queue<Task> _taskQueue;
+        // priorities and owners of the tasks from the shared queue which are running on the stream thread,
+        // the last one is the innermost preempting task
+        std::vector<std::pair<int, const void*>> _runningTasks;
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
         std::unique_ptr<custom::task_arena> _taskArena;
         std::unique_ptr<Observer>           _observer;
@@ -198,16 +205,15 @@ struct CPUStreamsExecutor::Impl {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
                 for (bool stopped = false; !stopped;) {
-                    Task task;
+                    QueuedTask task{};
                     {
                         std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] { return !_taskQueue.empty() || (stopped = _isStopped); });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
+                        _queueCondVar.wait(lock, [&] { return !_taskQueues.empty() || (stopped = _isStopped); });
+                        if (!_taskQueues.empty()) {
+                            task = Pop(_taskQueues.begin(), _taskQueues.begin()->second.begin());
                         }
                     }
-                    if (task) {
+                    if (task._task) {
                         Execute(task, *(_streams.local()));
                     }
                 }
@@ -215,14 +221,84 @@ struct CPUStreamsExecutor::Impl {
         }
     }
 
-    void Enqueue(Task task) {
+    struct QueuedTask {
+        Task        _task;
+        int         _priority;
+        const void* _owner;
+    };
+    // queues of the tasks with the same priority, the highest priority first
+    using TaskQueues = std::map<int, std::deque<QueuedTask>, std::greater<int>>;
+
+    void Enqueue(Task task, int priority = 0, const void* owner = nullptr) {
         {
             std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            _taskQueues[priority].push_back({std::move(task), priority, owner});
+            _maxQueuedPriority = _taskQueues.begin()->first;
         }
         _queueCondVar.notify_one();
     }
 
+    // must be called under the _mutex
+    QueuedTask Pop(TaskQueues::iterator queue, std::deque<QueuedTask>::iterator it) {
+        QueuedTask task = std::move(*it);
+        queue->second.erase(it);
+        if (queue->second.empty()) {
+            _taskQueues.erase(queue);
+        }
+        _maxQueuedPriority = _taskQueues.empty() ? INT_MIN : _taskQueues.begin()->first;
+        return task;
+    }
+
+    void Execute(const QueuedTask& task, Stream& stream) {
+        stream._runningTasks.emplace_back(task._priority, task._owner);
+        try {
+            Execute(task._task, stream);
+        } catch (...) {
+            stream._runningTasks.pop_back();
+            throw;
+        }
+        stream._runningTasks.pop_back();
+    }
+
+    bool RunPreemptingTasks() {
+        if (_maxQueuedPriority.load(std::memory_order_relaxed) == INT_MIN) {
+            return false;
+        }
+        auto& stream = *(_streams.local());
+        if (stream._runningTasks.empty()) {
+            return false;
+        }
+        bool executed = false;
+        for (;;) {
+            const int priority = stream._runningTasks.back().first;
+            if (_maxQueuedPriority.load(std::memory_order_relaxed) <= priority) {
+                break;
+            }
+            QueuedTask task{};
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                for (auto queue = _taskQueues.begin(); queue != _taskQueues.end() && queue->first > priority; ++queue) {
+                    // the owner's resources may be locked by the tasks running on this thread
+                    auto it = std::find_if(queue->second.begin(), queue->second.end(), [&](const QueuedTask& queued) {
+                        return queued._owner != nullptr &&
+                               std::none_of(stream._runningTasks.begin(), stream._runningTasks.end(),
+                                            [&](const std::pair<int, const void*>& running) { return running.second == queued._owner; });
+                    });
+                    if (it != queue->second.end()) {
+                        task = Pop(queue, it);
+                        break;
+                    }
+                }
+            }
+            if (!task._task) {
+                break;
+            }
+            Execute(task, stream);
+            executed = true;
+        }
+        return executed;
+    }
+
     void Execute(const Task& task, Stream& stream) {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
         auto& arena = stream._taskArena;
@@ -258,7 +334,8 @@ struct CPUStreamsExecutor::Impl {
     std::vector<std::thread>                _threads;
     std::mutex                              _mutex;
     std::condition_variable                 _queueCondVar;
-    std::queue<Task>                        _taskQueue;
+    TaskQueues                              _taskQueues;
+    std::atomic<int>                        _maxQueuedPriority{INT_MIN};
     bool                                    _isStopped = false;
     std::vector<int>                        _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>>    _streams;
@@ -312,4 +389,16 @@ void CPUStreamsExecutor::run(Task task) {
     }
 }
 
+void CPUStreamsExecutor::run(Task task, int priority, const void* owner) {
+    if (0 == _impl->_config._streams) {
+        _impl->Defer(std::move(task));
+    } else {
+        _impl->Enqueue(std::move(task), priority, owner);
+    }
+}
+
+bool CPUStreamsExecutor::RunPreemptingTasks() {
+    return _impl->RunPreemptingTasks();
+}
+
 }  // namespace InferenceEngine
@@ -22,4 +22,9 @@ class ngraph::pass::low_precision::MarkupCanBeQuantized : public ngraph::pass::F
 public:
     NGRAPH_RTTI_DECLARATION;
     bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+    /**
+     * @brief Marks up a single operation, allows to combine several markup passes in one function traversal
+     */
+    void markup(const std::shared_ptr<Node>& node);
 };
@@ -39,6 +39,15 @@ public:
     explicit MarkupPerTensorQuantization(const std::vector<OperationPerTensorQuantizationRestriction>& restrictions = {});
     bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
 
+    /**
+     * @brief Marks up a single operation, allows to combine several markup passes in one function traversal
+     */
+    void markup(const std::shared_ptr<Node>& node);
+
 private:
+    const std::vector<size_t>* getRestrictedPorts(const NodeTypeInfo& typeInfo);
+
     std::unordered_map<std::string, PerTensorQuantization> restrictionsByOperation;
+    // restricted ports resolved for the operation type, nullptr if the type is not restricted
+    std::unordered_map<const NodeTypeInfo*, const std::vector<size_t>*> restrictedPortsByType;
 };
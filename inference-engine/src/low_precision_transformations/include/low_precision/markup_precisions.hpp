@@ -6,6 +6,7 @@
 
 #include <memory>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 #include <ngraph/pass/pass.hpp>
@@ -40,8 +41,21 @@ public:
     explicit MarkupPrecisions(const std::vector<OperationPrecisionRestriction>& restrictions = {});
     bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
 
+    /**
+     * @brief Marks up a single operation, allows to combine several markup passes in one function traversal
+     */
+    void markup(const std::shared_ptr<Node>& node);
+
 private:
+    // restrictions resolved for the operation type: the type name and the version are looked up once per type
+    struct TypeRestriction {
+        bool supported;
+        const std::vector<std::pair<size_t, std::vector<ngraph::element::Type>>>* precisionsByPort;
+    };
+
+    const TypeRestriction& getTypeRestriction(const std::shared_ptr<Node>& node);
     static bool isPrecisionPreserved(const std::shared_ptr<Node>& node);
     static bool isSupported(const std::shared_ptr<Node>& node);
     std::unordered_map<std::string, Restriction> restrictionsByOperation;
+    std::unordered_map<const NodeTypeInfo*, TypeRestriction> restrictionsByType;
 };
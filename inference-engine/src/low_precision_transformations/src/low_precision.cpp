@@ -13,6 +13,7 @@
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/opsets/opset4.hpp>
 #include <ngraph/opsets/opset6.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
 #include <transformations/utils/utils.hpp>
 #include <low_precision/markup_per_tensor_quantization.hpp>
 #include <low_precision/lpt_itt.hpp>
@@ -93,11 +94,9 @@ template <typename BaseOp>
 void make_matcher_type_relaxed(ngraph::pass::GraphRewrite* transformation) {
     using namespace ngraph;
 
-    auto is_op_type = [](std::shared_ptr<Node> n) {
-        return !!as_type_ptr<BaseOp>(n);
-    };
-
-    auto p_node = std::make_shared<pattern::op::Label>(element::f32, Shape{}, is_op_type);
+    // the type based root allows GraphRewrite to dispatch the nodes to the matchers by the node type
+    // instead of trying each matcher on each node
+    auto p_node = pattern::wrap_type<BaseOp>();
 
     ngraph::graph_rewrite_callback callback = [](ngraph::pattern::Matcher& m) {
         auto l_node = std::dynamic_pointer_cast<BaseOp>(m.get_match_root());
@@ -164,21 +163,61 @@ MarkupOptimizations::MarkupOptimizations(
     precisionRestrictions(precisionRestrictions),
     quantizationRestrictions(quantizationRestrictions) {}
 
+namespace {
+template <typename T, class... Args>
+std::shared_ptr<T> makeMarkup(const std::shared_ptr<ngraph::pass::PassConfig>& passConfig, Args&&... args) {
+    if (passConfig->is_disabled<T>()) {
+        return nullptr;
+    }
+    auto pass = std::make_shared<T>(std::forward<Args>(args)...);
+    pass->set_pass_config(passConfig);
+    return pass;
+}
+} // namespace
+
 bool ngraph::pass::low_precision::MarkupOptimizations::run_on_function(std::shared_ptr<ngraph::Function> f) {
-    ngraph::pass::Manager markup(get_pass_config());
-    markup.set_per_pass_validation(false);
-    markup.register_pass<low_precision::MarkupCanBeQuantized>();
+    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::LPT_LT, "MarkupOptimizations", "Markup");
+
+    const auto passConfig = get_pass_config();
+
+    // operation markup depends on the operation only, so the markup passes share one function traversal
+    // which also collects the operation types required for the propagation
+    const auto canBeQuantized = makeMarkup<low_precision::MarkupCanBeQuantized>(passConfig);
+    std::shared_ptr<low_precision::MarkupPrecisions> precisions;
     if (!precisionRestrictions.empty()) {
-        markup.register_pass<low_precision::MarkupPrecisions>(precisionRestrictions);
+        precisions = makeMarkup<low_precision::MarkupPrecisions>(passConfig, precisionRestrictions);
     }
+    std::shared_ptr<low_precision::MarkupPerTensorQuantization> perTensorQuantization;
     if (!quantizationRestrictions.empty()) {
-        markup.register_pass<low_precision::MarkupPerTensorQuantization>(quantizationRestrictions);
+        perTensorQuantization = makeMarkup<low_precision::MarkupPerTensorQuantization>(passConfig, quantizationRestrictions);
     }
-    if (ngraph::op::util::has_op_with_type<ngraph::opset1::AvgPool>(f)) {
+
+    bool hasAvgPool = false;
+    bool hasConcat = false;
+    for (const std::shared_ptr<Node>& node : f->get_ordered_ops()) {
+        hasAvgPool = hasAvgPool || is_type<opset1::AvgPool>(node);
+        hasConcat = hasConcat || is_type<opset1::Concat>(node);
+
+        if (canBeQuantized != nullptr) {
+            canBeQuantized->markup(node);
+        }
+        if (precisions != nullptr) {
+            precisions->markup(node);
+        }
+        if (perTensorQuantization != nullptr) {
+            perTensorQuantization->markup(node);
+        }
+    }
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "Propagation");
+
+    ngraph::pass::Manager markup(passConfig);
+    markup.set_per_pass_validation(false);
+    if (hasAvgPool) {
         markup.register_pass<low_precision::MarkupAvgPoolPrecisionPreserved>();
     }
     markup.register_pass<low_precision::PropagatePrecisions>();
-    if (ngraph::op::util::has_op_with_type<ngraph::opset1::Concat>(f)) {
+    if (hasConcat) {
         markup.register_pass<low_precision::AlignQuantizationIntervals>();
         markup.register_pass<low_precision::AlignQuantizationParameters>();
     }
@@ -187,22 +226,29 @@ bool ngraph::pass::low_precision::MarkupOptimizations::run_on_function(std::shar
 }
 
 bool ngraph::pass::low_precision::LowPrecision::run_on_function(std::shared_ptr<ngraph::Function> f) {
-    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::LPT_LT, "LowPrecision");
+    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::LPT_LT, "LowPrecision", "Prerequisites");
 
+    // each stage runs with its own manager to report the stage time
     auto passConfig = get_pass_config();
-    ngraph::pass::Manager manager(passConfig);
-
-    auto prerequisites = manager.register_pass<ngraph::pass::GraphRewrite>();
+    ngraph::pass::Manager prerequisitesManager(passConfig);
+    auto prerequisites = prerequisitesManager.register_pass<ngraph::pass::GraphRewrite>();
     const std::vector<ngraph::element::Type> supportedTypes = {ngraph::element::i8, ngraph::element::u8};
     prerequisites->add_matcher<PullReshapeThroughDequantization>(supportedTypes);
     prerequisites->add_matcher<PullTransposeThroughDequantization>(supportedTypes);
     prerequisites->add_matcher<ngraph::pass::LinOpSequenceFusion>();
+    prerequisitesManager.register_pass<TypeRelaxedReplacer>();
+    prerequisitesManager.run_passes(f);
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "Markup");
 
-    manager.register_pass<TypeRelaxedReplacer>();
+    ngraph::pass::Manager markupManager(passConfig);
+    markupManager.register_pass<ngraph::pass::low_precision::MarkupOptimizations>(precisionRestrictions, quantizationRestrictions);
+    markupManager.run_passes(f);
 
-    manager.register_pass<ngraph::pass::low_precision::MarkupOptimizations>(precisionRestrictions, quantizationRestrictions);
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "Common");
 
-    std::shared_ptr<ngraph::pass::GraphRewrite> common = manager.register_pass<ngraph::pass::GraphRewrite>();
+    ngraph::pass::Manager commonManager(passConfig);
+    std::shared_ptr<ngraph::pass::GraphRewrite> common = commonManager.register_pass<ngraph::pass::GraphRewrite>();
     common->add_matcher<ngraph::pass::low_precision::AddTransformation>(params);
     common->add_matcher<ngraph::pass::low_precision::AvgPoolTransformation>(params);
     common->add_matcher<ngraph::pass::low_precision::ClampTransformation>(params);
@@ -233,8 +279,12 @@ bool ngraph::pass::low_precision::LowPrecision::run_on_function(std::shared_ptr<
     common->add_matcher<ngraph::pass::low_precision::TransposeTransformation>(params);
     common->add_matcher<ngraph::pass::low_precision::UnsqueezeTransformation>(params);
     common->add_matcher<ngraph::pass::low_precision::VariadicSplitTransformation>(params);
+    commonManager.run_passes(f);
 
-    std::shared_ptr<ngraph::pass::GraphRewrite> cleanup = manager.register_pass<ngraph::pass::GraphRewrite>();
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "Cleanup");
+
+    ngraph::pass::Manager cleanupManager(passConfig);
+    std::shared_ptr<ngraph::pass::GraphRewrite> cleanup = cleanupManager.register_pass<ngraph::pass::GraphRewrite>();
     cleanup->add_matcher<ngraph::pass::low_precision::FoldConvertTransformation>(params);
     cleanup->add_matcher<ngraph::pass::low_precision::FuseConvertTransformation>(params);
     cleanup->add_matcher<ngraph::pass::low_precision::FuseSubtractToFakeQuantizeTransformation>(params);
@@ -243,11 +293,10 @@ bool ngraph::pass::low_precision::LowPrecision::run_on_function(std::shared_ptr<
     cleanup->add_matcher<ngraph::pass::low_precision::MultiplyToGroupConvolutionTransformation>(
         params,
         OperationPrecisionRestriction::getPrecisionsByOperationType<opset1::GroupConvolution>(precisionRestrictions));
-    manager.register_pass<ngraph::pass::low_precision::SubtractMultiplyToMultiplyAddTransformation>(params);
-    manager.register_pass<ngraph::pass::low_precision::FoldFakeQuantizeTransformation>(params);
-    manager.register_pass<ngraph::pass::ConstantFolding>();
-
-    manager.run_passes(f);
+    cleanupManager.register_pass<ngraph::pass::low_precision::SubtractMultiplyToMultiplyAddTransformation>(params);
+    cleanupManager.register_pass<ngraph::pass::low_precision::FoldFakeQuantizeTransformation>(params);
+    cleanupManager.register_pass<ngraph::pass::ConstantFolding>();
+    cleanupManager.run_passes(f);
     return false;
 }
 
@@ -17,43 +17,49 @@ using namespace ngraph;
 
 NGRAPH_RTTI_DEFINITION(ngraph::pass::low_precision::MarkupCanBeQuantized, "MarkupCanBeQuantized", 0);
 
-bool ngraph::pass::low_precision::MarkupCanBeQuantized::run_on_function(std::shared_ptr<ngraph::Function> f) {
-    auto setEmptyPrecisions = [](const std::shared_ptr<ngraph::Node>& node) {
-        for (auto& input : node->inputs()) {
-            auto& rt = input.get_rt_info();
+namespace {
+void setEmptyPrecisions(const std::shared_ptr<ngraph::Node>& node) {
+    for (auto& input : node->inputs()) {
+        auto& rt = input.get_rt_info();
 
-            auto attribute = ngraph::pass::low_precision::make_shared_attribute<PrecisionsAttribute>(std::vector<element::Type>());
-            auto attributeWrapper = std::make_shared<ngraph::VariantWrapper<std::shared_ptr<PrecisionsAttribute>>>(attribute);
+        auto attribute = ngraph::pass::low_precision::make_shared_attribute<PrecisionsAttribute>(std::vector<element::Type>());
+        auto attributeWrapper = std::make_shared<ngraph::VariantWrapper<std::shared_ptr<PrecisionsAttribute>>>(attribute);
 
-            rt.emplace(
-                    ngraph::VariantWrapper<std::shared_ptr<PrecisionsAttribute>>::type_info.name,
-                    attributeWrapper);
-        }
-    };
+        rt.emplace(
+                ngraph::VariantWrapper<std::shared_ptr<PrecisionsAttribute>>::type_info.name,
+                attributeWrapper);
+    }
+}
+} // namespace
 
+bool ngraph::pass::low_precision::MarkupCanBeQuantized::run_on_function(std::shared_ptr<ngraph::Function> f) {
     for (const std::shared_ptr<Node>& node : f->get_ordered_ops()) {
-        if (node->get_input_size() == 0 || transformation_callback(node)) {
-            continue;
-        }
+        markup(node);
+    }
+    return true;
+}
+
+void ngraph::pass::low_precision::MarkupCanBeQuantized::markup(const std::shared_ptr<Node>& node) {
+    if (node->get_input_size() == 0 || transformation_callback(node)) {
+        return;
+    }
 
-        if (const auto convolution = std::dynamic_pointer_cast<ngraph::opset1::Convolution>(node)) {
-            if (!ConvolutionTransformation::isQuantizedStatic(convolution)) {
-                setEmptyPrecisions(convolution);
-            }
-            continue;
+    if (const auto convolution = std::dynamic_pointer_cast<ngraph::opset1::Convolution>(node)) {
+        if (!ConvolutionTransformation::isQuantizedStatic(convolution)) {
+            setEmptyPrecisions(convolution);
         }
-        if (const auto convolutionBackpropData = std::dynamic_pointer_cast<ngraph::opset1::ConvolutionBackpropData>(node)) {
-            if (!ConvolutionBackpropDataTransformation::isQuantizedStatic(convolutionBackpropData)) {
-                setEmptyPrecisions(convolutionBackpropData);
-            }
-            continue;
+        return;
+    }
+    if (const auto convolutionBackpropData = std::dynamic_pointer_cast<ngraph::opset1::ConvolutionBackpropData>(node)) {
+        if (!ConvolutionBackpropDataTransformation::isQuantizedStatic(convolutionBackpropData)) {
+            setEmptyPrecisions(convolutionBackpropData);
         }
-        if (const auto groupConvolution = std::dynamic_pointer_cast<ngraph::opset1::GroupConvolution>(node)) {
-            if (!GroupConvolutionTransformation::isQuantizedStatic(groupConvolution)) {
-                setEmptyPrecisions(groupConvolution);
-            }
-            continue;
+        return;
+    }
+    if (const auto groupConvolution = std::dynamic_pointer_cast<ngraph::opset1::GroupConvolution>(node)) {
+        if (!GroupConvolutionTransformation::isQuantizedStatic(groupConvolution)) {
+            setEmptyPrecisions(groupConvolution);
         }
+        return;
     }
-    return true;
 }
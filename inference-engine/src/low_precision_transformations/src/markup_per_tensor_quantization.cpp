@@ -28,58 +28,70 @@ ngraph::pass::low_precision::MarkupPerTensorQuantization::MarkupPerTensorQuantiz
     }
 }
 
-bool ngraph::pass::low_precision::MarkupPerTensorQuantization::run_on_function(std::shared_ptr<ngraph::Function> f) {
-    auto setRestriction = [](const std::shared_ptr<Node>& node, const std::vector<size_t>& restrictedPorts) {
-        auto createAttribute = [](Input<Node>& input){
-            auto &rt = input.get_rt_info();
-            rt.emplace(
-                    ngraph::VariantWrapper<PerTensorQuantizationAttribute>::type_info.name,
-                    std::make_shared<::ngraph::VariantWrapper<PerTensorQuantizationAttribute>>(PerTensorQuantizationAttribute()));
-        };
+namespace {
+void setRestriction(const std::shared_ptr<Node>& node, const std::vector<size_t>& restrictedPorts) {
+    auto createAttribute = [](Input<Node>& input){
+        auto &rt = input.get_rt_info();
+        rt.emplace(
+                ngraph::VariantWrapper<PerTensorQuantizationAttribute>::type_info.name,
+                std::make_shared<::ngraph::VariantWrapper<PerTensorQuantizationAttribute>>(PerTensorQuantizationAttribute()));
+    };
 
-        if (restrictedPorts.empty()) {
-            // markup all ports
-            for (size_t item = 0ul; item < node->get_input_size(); item++) {
-                Input<Node> input = node->input(item);
-                createAttribute(input);
-            }
-        } else {
-            // markup specific ports
-            for (const size_t item : restrictedPorts) {
-                Input<Node> input = node->input(item);
-                createAttribute(input);
-            }
+    if (restrictedPorts.empty()) {
+        // markup all ports
+        for (size_t item = 0ul; item < node->get_input_size(); item++) {
+            Input<Node> input = node->input(item);
+            createAttribute(input);
         }
-    };
+    } else {
+        // markup specific ports
+        for (const size_t item : restrictedPorts) {
+            Input<Node> input = node->input(item);
+            createAttribute(input);
+        }
+    }
+}
+} // namespace
 
+bool ngraph::pass::low_precision::MarkupPerTensorQuantization::run_on_function(std::shared_ptr<ngraph::Function> f) {
     for (const std::shared_ptr<Node>& node : f->get_ordered_ops()) {
-        if (node->get_input_size() == 0) {
-            continue;
-        }
+        markup(node);
+    }
+    return true;
+}
 
-        const auto typeIt = restrictionsByOperation.find(node->get_type_info().name);
-        if (typeIt == restrictionsByOperation.end()) {
-            continue;
-        }
+void ngraph::pass::low_precision::MarkupPerTensorQuantization::markup(const std::shared_ptr<Node>& node) {
+    if (node->get_input_size() == 0) {
+        return;
+    }
 
-        const auto& restriction = typeIt->second;
-        if (restriction.portsByVersion.empty()) {
-            continue;
-        }
+    const std::vector<size_t>* restrictedPorts = getRestrictedPorts(node->get_type_info());
+    if (restrictedPorts != nullptr) {
+        setRestriction(node, *restrictedPorts);
+    }
+}
 
+const std::vector<size_t>* ngraph::pass::low_precision::MarkupPerTensorQuantization::getRestrictedPorts(const NodeTypeInfo& typeInfo) {
+    const auto cached = restrictedPortsByType.find(&typeInfo);
+    if (cached != restrictedPortsByType.end()) {
+        return cached->second;
+    }
+
+    const std::vector<size_t>* restrictedPorts = nullptr;
+    const auto typeIt = restrictionsByOperation.find(typeInfo.name);
+    if ((typeIt != restrictionsByOperation.end()) && !typeIt->second.portsByVersion.empty()) {
+        const auto& restriction = typeIt->second;
         if (restriction.versionIsRequired) {
-            const auto it2 = restriction.portsByVersion.find(node->get_type_info().version);
-            if (it2 == restriction.portsByVersion.end()) {
-                continue;
+            const auto it2 = restriction.portsByVersion.find(typeInfo.version);
+            if (it2 != restriction.portsByVersion.end()) {
+                restrictedPorts = &it2->second;
             }
-
-            const std::vector<size_t>& restrictedPorts = it2->second;
-            setRestriction(node, restrictedPorts);
         } else {
             assert(restriction.portsByVersion.size() == 1ul);
-            const std::vector<size_t>& restrictedPorts = restriction.portsByVersion.begin()->second;
-            setRestriction(node, restrictedPorts);
+            restrictedPorts = &restriction.portsByVersion.begin()->second;
         }
     }
-    return true;
+
+    restrictedPortsByType.emplace(&typeInfo, restrictedPorts);
+    return restrictedPorts;
 }
@@ -9,6 +9,7 @@
 #include <algorithm>
 
 #include "ie_plugin_config.hpp"
+#include "cpu/cpu_config.hpp"
 #include "ie_common.h"
 #include "ie_parallel.hpp"
 #include "ie_system_conf.h"
@@ -62,6 +63,57 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             // zero and any negative value will be treated
             // as default batch size
             batchLimit = std::max(val_i, 0);
+        } else if (key == CPUConfigParams::KEY_CPU_WORKSPACE_POOL_SIZE) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_WORKSPACE_POOL_SIZE
+                                    << ". Expected only non-negative integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_WORKSPACE_POOL_SIZE
+                                    << ". Expected only non-negative integer numbers";
+            workspacePoolSize = val_i;
+        } else if (key == CPUConfigParams::KEY_CPU_MODEL_PRIORITY) {
+            try {
+                modelPriority = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_MODEL_PRIORITY
+                                    << ". Expected only integer numbers";
+            }
+        } else if (key == CPUConfigParams::KEY_CPU_LATENCY_HISTOGRAMS) {
+            if (val == PluginConfigParams::YES) latencyHistograms = true;
+            else if (val == PluginConfigParams::NO) latencyHistograms = false;
+            else
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_LATENCY_HISTOGRAMS
+                                   << ". Expected only YES/NO";
+        } else if (key == CPUConfigParams::KEY_CPU_HUGE_PAGES) {
+            if (val == PluginConfigParams::NO) hugePages = HugePagesMode::Off;
+            else if (val == CPUConfigParams::CPU_TRANSPARENT) hugePages = HugePagesMode::Transparent;
+            else if (val == CPUConfigParams::CPU_EXPLICIT) hugePages = HugePagesMode::Explicit;
+            else
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_HUGE_PAGES
+                                   << ". Expected only NO/" << CPUConfigParams::CPU_TRANSPARENT << "/"
+                                   << CPUConfigParams::CPU_EXPLICIT;
+        } else if (key == CPUConfigParams::KEY_CPU_PRUNING) {
+            if (val == PluginConfigParams::YES) pruning = true;
+            else if (val == PluginConfigParams::NO) pruning = false;
+            else
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_PRUNING
+                                   << ". Expected only YES/NO";
+        } else if (key == CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE) {
+            float val_f = -1.f;
+            try {
+                val_f = std::stof(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE
+                                   << ". Expected only float numbers in the range [0, 1]";
+            }
+            if (!(val_f >= 0.f && val_f <= 1.f))
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE
+                                   << ". Expected only float numbers in the range [0, 1]";
+            fcSparseWeightsDecompressionRate = val_f;
         } else if (key == PluginConfigParams::KEY_PERF_COUNT) {
             if (val == PluginConfigParams::YES) collectPerfCounters = true;
             else if (val == PluginConfigParams::NO) collectPerfCounters = false;
@@ -149,6 +201,23 @@ void Config::updateProperties() {
             _config.insert({ PluginConfigParams::KEY_DYN_BATCH_ENABLED, PluginConfigParams::NO });
 
         _config.insert({ PluginConfigParams::KEY_DYN_BATCH_LIMIT, std::to_string(batchLimit) });
+        _config.insert({ CPUConfigParams::KEY_CPU_WORKSPACE_POOL_SIZE, std::to_string(workspacePoolSize) });
+        _config.insert({ CPUConfigParams::KEY_CPU_MODEL_PRIORITY, std::to_string(modelPriority) });
+        _config.insert({ CPUConfigParams::KEY_CPU_LATENCY_HISTOGRAMS,
+                         latencyHistograms ? PluginConfigParams::YES : PluginConfigParams::NO });
+        switch (hugePages) {
+            case HugePagesMode::Off:
+                _config.insert({ CPUConfigParams::KEY_CPU_HUGE_PAGES, PluginConfigParams::NO });
+            break;
+            case HugePagesMode::Transparent:
+                _config.insert({ CPUConfigParams::KEY_CPU_HUGE_PAGES, CPUConfigParams::CPU_TRANSPARENT });
+            break;
+            case HugePagesMode::Explicit:
+                _config.insert({ CPUConfigParams::KEY_CPU_HUGE_PAGES, CPUConfigParams::CPU_EXPLICIT });
+            break;
+        }
+        _config.insert({ CPUConfigParams::KEY_CPU_PRUNING, pruning ? PluginConfigParams::YES : PluginConfigParams::NO });
+        _config.insert({ CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE, std::to_string(fcSparseWeightsDecompressionRate) });
         _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(streamExecutorConfig._streams) });
         _config.insert({ PluginConfigParams::KEY_CPU_THREADS_NUM, std::to_string(streamExecutorConfig._threads) });
         IE_SUPPRESS_DEPRECATED_START
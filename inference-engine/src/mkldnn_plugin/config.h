@@ -20,11 +20,23 @@ struct Config {
         On,
     };
 
+    enum class HugePagesMode {
+        Off,
+        Transparent,
+        Explicit,
+    };
+
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
     std::string dumpToDot = "";
     int batchLimit = 0;
+    int workspacePoolSize = 0;
+    int modelPriority = 0;
+    bool latencyHistograms = false;
+    HugePagesMode hugePages = HugePagesMode::Off;
+    bool pruning = false;
+    float fcSparseWeightsDecompressionRate = 0.8f;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
 
 #if defined(__arm__) || defined(__aarch64__)
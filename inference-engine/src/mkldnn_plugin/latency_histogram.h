@@ -0,0 +1,114 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Log-linear histogram of latencies in nanoseconds.
+ *
+ * Values below 32 are counted exactly, each next power of two range is split into 16 buckets, so the relative error
+ * of the percentiles is below 1/16. The histogram has the single writer (the graph is executed by one stream at a
+ * time), so the counters are updated without read-modify-write operations and may be read by other threads at any
+ * moment.
+ */
+class LatencyHistogram {
+public:
+    static constexpr int subBucketsBits = 4;
+    static constexpr int subBuckets = 1 << subBucketsBits;
+    static constexpr int exactBits = subBucketsBits + 1;
+    static constexpr int maxBits = 44;  // larger values (~4.9 hours) are counted by the last bucket
+    static constexpr int bucketsNum = (1 << exactBits) + (maxBits - exactBits) * subBuckets;
+
+    void add(uint64_t value) {
+        auto& counter = counts[bucketIndex(value)];
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        if (value > maxValue.load(std::memory_order_relaxed))
+            maxValue.store(value, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Adds counts of this histogram to the merged ones
+     * @param merged bucketsNum counters
+     */
+    void accumulate(std::vector<uint64_t>& merged, uint64_t& mergedMax) const {
+        for (int i = 0; i < bucketsNum; i++)
+            merged[i] += counts[i].load(std::memory_order_relaxed);
+        const auto max = maxValue.load(std::memory_order_relaxed);
+        if (max > mergedMax)
+            mergedMax = max;
+    }
+
+    /**
+     * @brief Computes the statistics of the merged histogram
+     * @return {count, p50, p90, p99, max}, latencies are in microseconds
+     */
+    static std::vector<double> percentiles(const std::vector<uint64_t>& merged, uint64_t max) {
+        uint64_t total = 0;
+        for (auto count : merged)
+            total += count;
+
+        std::vector<double> result = {static_cast<double>(total)};
+        for (auto p : {50, 90, 99}) {
+            // rank of the percentile, 1-based
+            const uint64_t rank = (total * p + 99) / 100;
+            uint64_t value = 0;
+            uint64_t seen = 0;
+            for (int i = 0; i < bucketsNum && total > 0; i++) {
+                seen += merged[i];
+                if (seen >= rank) {
+                    // the last bucket is unbounded, so only the maximum is known there
+                    value = i == bucketsNum - 1 ? max : bucketUpperBound(i);
+                    break;
+                }
+            }
+            result.push_back(static_cast<double>(value < max ? value : max) / 1000.);
+        }
+        result.push_back(static_cast<double>(max) / 1000.);
+        return result;
+    }
+
+private:
+    static int highestBit(uint64_t value) {
+        int bit = 0;
+        for (int shift = 32; shift > 0; shift >>= 1) {
+            if (value >> shift) {
+                value >>= shift;
+                bit += shift;
+            }
+        }
+        return bit;
+    }
+
+    static int bucketIndex(uint64_t value) {
+        if (value < (1u << exactBits))
+            return static_cast<int>(value);
+        const int bit = highestBit(value);
+        if (bit >= maxBits)
+            return bucketsNum - 1;
+        const int shift = bit - subBucketsBits;
+        const int sub = static_cast<int>((value >> shift) & (subBuckets - 1));
+        return (1 << exactBits) + (bit - exactBits) * subBuckets + sub;
+    }
+
+    static uint64_t bucketUpperBound(int index) {
+        if (index < (1 << exactBits))
+            return static_cast<uint64_t>(index);
+        const int bit = exactBits + (index - (1 << exactBits)) / subBuckets;
+        const int sub = (index - (1 << exactBits)) % subBuckets;
+        const int shift = bit - subBucketsBits;
+        return (static_cast<uint64_t>(subBuckets + sub + 1) << shift) - 1;
+    }
+
+    std::array<std::atomic<uint32_t>, bucketsNum> counts{};
+    std::atomic<uint64_t> maxValue{0};
+};
+
+}  // namespace MKLDNNPlugin
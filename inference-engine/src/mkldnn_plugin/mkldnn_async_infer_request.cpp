@@ -9,7 +9,11 @@ MKLDNNPlugin::MKLDNNAsyncInferRequest::MKLDNNAsyncInferRequest(const InferenceEn
                                                                const InferenceEngine::ITaskExecutor::Ptr& taskExecutor,
                                                                const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor)
     : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor) {
-    static_cast<MKLDNNInferRequest*>(inferRequest.get())->SetAsyncRequest(this);
+    auto syncRequest = static_cast<MKLDNNInferRequest*>(inferRequest.get());
+    syncRequest->SetAsyncRequest(this);
+    if (std::dynamic_pointer_cast<InferenceEngine::CPUStreamsExecutor>(taskExecutor)) {
+        _pipeline = {{std::make_shared<PriorityExecutor>(syncRequest), [syncRequest] { syncRequest->InferImpl(); }}};
+    }
 }
 
 MKLDNNPlugin::MKLDNNAsyncInferRequest::~MKLDNNAsyncInferRequest() {
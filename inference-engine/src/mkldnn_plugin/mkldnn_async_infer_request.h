@@ -17,6 +17,16 @@ public:
                             const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
                             const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
     ~MKLDNNAsyncInferRequest();
+
+private:
+    // puts the inference stage to the shared queue of the streams executor according to the network priority
+    struct PriorityExecutor : public InferenceEngine::ITaskExecutor {
+        explicit PriorityExecutor(MKLDNNInferRequest* request) : _request{request} {}
+        void run(InferenceEngine::Task task) override {
+            _request->RunPrioritized(std::move(task));
+        }
+        MKLDNNInferRequest* _request;
+    };
 };
 
 }  // namespace MKLDNNPlugin
@@ -3,6 +3,7 @@
 //
 
 #include <ie_metric_helpers.hpp>
+#include <cpu/cpu_config.hpp>
 #include <precision_utils.h>
 #include "mkldnn_exec_network.h"
 
@@ -11,6 +12,7 @@
 #include "mkldnn_memory_state.h"
 #include "mkldnn_itt.h"
 #include "nodes/mkldnn_memory_node.hpp"
+#include "utils/graph_pool.hpp"
 #include <threading/ie_executor_manager.hpp>
 
 #include <threading/ie_cpu_streams_executor.hpp>
@@ -42,6 +44,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
     _name{network.getName()},
     _numaNodesWeights(numaNodesWeights),
         _network(network) {
+    _priority = _cfg.modelPriority;
     auto function = network.getFunction();
     if (function == nullptr) {
         IE_THROW() << "CPU plug-in doesn't support not ngraph-based model!";
@@ -79,7 +82,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
 
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
     std::vector<Task> tasks; tasks.resize(streams);
-    _graphs.resize(streams);
+    _graphs.resize(_cfg.workspacePoolSize > 0 ? std::min(streams, _cfg.workspacePoolSize) : streams);
     if (_cfg.streamExecutorConfig._streams != 0) {
         for (auto&& task : tasks) {
             task = [this] {
@@ -94,20 +97,19 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
     // Save all MemoryLayer data tensors. Will use insight about mechanics
     // of MemoryLayer implementation. It uses output edge of MemoryLayer
     // producer as storage for tensor to keep it between infer calls.
-    if (_graphs.size() == 1) {
-        for (auto &node : GetGraph()._graph.GetNodes()) {
-            if (node->getType() == MemoryInput) {
-                auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-                auto state_store = memoryNode->getStore();
-                auto state_name = memoryNode->getId();
-
-                // Remove suffix with pair ID. Internal information.
-                auto suffix_idx = state_name.find("/id=");
-                if (suffix_idx != std::string::npos)
-                    state_name = state_name.substr(0, suffix_idx);
-
-                memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
-            }
+    // The states are owned by infer requests and bound to the graph of any stream on each inference.
+    for (auto &node : GetGraph()._graph.GetNodes()) {
+        if (node->getType() == MemoryInput) {
+            auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
+            auto state_store = memoryNode->getStore();
+            auto state_name = memoryNode->getId();
+
+            // Remove suffix with pair ID. Internal information.
+            auto suffix_idx = state_name.find("/id=");
+            if (suffix_idx != std::string::npos)
+                state_name = state_name.substr(0, suffix_idx);
+
+            memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
         }
     }
 }
@@ -120,7 +122,8 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
         streamId = streamsExecutor->GetStreamId();
         numaNodeId = streamsExecutor->GetNumaNodeId();
     }
-    auto graphLock = Graph::Lock(_graphs[streamId % _graphs.size()]);
+    const size_t graphId = streamId % _graphs.size();
+    auto graphLock = _cfg.workspacePoolSize > 0 ? leaseGraph(_graphs, graphId, numaNodeId) : Graph::Lock(_graphs[graphId]);
     if (!graphLock._graph.IsReady()) {
         std::exception_ptr exception;
         auto makeGraph = [&] {
@@ -129,7 +132,9 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
                     graphLock._graph.setConfig(_cfg);
                 }
+                graphLock._graph.setNumaNodeId(numaNodeId);
                 graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId]);
+                graphLock._graph._created.store(true, std::memory_order_release);
             } catch(...) {
                 exception = std::current_exception();
             }
@@ -159,6 +164,21 @@ void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &pr
     }
 }
 
+void MKLDNNExecNetwork::SetConfig(const std::map<std::string, Parameter> &config) {
+    std::map<std::string, std::string> properties;
+    for (const auto& item : config) {
+        if (item.first != CPUConfigParams::KEY_CPU_MODEL_PRIORITY) {
+            IE_THROW(NotImplemented) << "Config key " << item.first << " can not be changed for the loaded network";
+        }
+        properties[item.first] = item.second.is<std::string>() ? item.second.as<std::string>()
+                                                               : std::to_string(item.second.as<int>());
+    }
+    // the graphs keep the config the network was loaded with, the priority is taken on each request start
+    std::lock_guard<std::mutex> lock{_cfgMutex};
+    _cfg.readProperties(properties);
+    _priority = _cfg.modelPriority;
+}
+
 InferenceEngine::IInferRequestInternal::Ptr MKLDNNExecNetwork::CreateInferRequest() {
     return CreateAsyncInferRequestFromSync<MKLDNNAsyncInferRequest>();
 }
@@ -173,7 +193,11 @@ InferenceEngine::CNNNetwork MKLDNNExecNetwork::GetExecGraphInfo() {
 Parameter MKLDNNExecNetwork::GetConfig(const std::string &name) const {
     if (_graphs.size() == 0)
         IE_THROW() << "No graph was found";
-    Config engConfig = const_cast<MKLDNNExecNetwork*>(this)->GetGraph()._graph.getProperty();
+    Config engConfig;
+    {
+        std::lock_guard<std::mutex> lock{_cfgMutex};
+        engConfig = _cfg;
+    }
     auto option = engConfig._config.find(name);
     if (option != engConfig._config.end()) {
         return option->second;
@@ -195,6 +219,10 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(CPU_METRIC_KEY(MEMORY_WORKSPACE_SIZE));
+        metrics.push_back(CPU_METRIC_KEY(MEMORY_WORKSPACE_LOWER_BOUND));
+        metrics.push_back(CPU_METRIC_KEY(LATENCY_PERCENTILES));
+        metrics.push_back(CPU_METRIC_KEY(HUGE_PAGES_STATISTICS));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -209,6 +237,49 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == CPU_METRIC_KEY(MEMORY_WORKSPACE_SIZE)) {
+        const auto size = const_cast<MKLDNNExecNetwork*>(this)->GetGraph()._graph.GetWorkspaceSize();
+        IE_SET_METRIC_RETURN(CPU_MEMORY_WORKSPACE_SIZE, static_cast<uint64_t>(size));
+    } else if (name == CPU_METRIC_KEY(MEMORY_WORKSPACE_LOWER_BOUND)) {
+        const auto size = const_cast<MKLDNNExecNetwork*>(this)->GetGraph()._graph.GetWorkspaceLowerBound();
+        IE_SET_METRIC_RETURN(CPU_MEMORY_WORKSPACE_LOWER_BOUND, static_cast<uint64_t>(size));
+    } else if (name == CPU_METRIC_KEY(LATENCY_PERCENTILES)) {
+        // histograms have the single writer, so they are merged without waiting for the running requests
+        std::map<std::string, std::pair<std::vector<uint64_t>, uint64_t>> merged;
+        auto accumulate = [&](const std::string& counterName, const PerfCount& counter) {
+            if (!counter.getHistogram())
+                return;
+            auto& entry = merged[counterName];
+            entry.first.resize(LatencyHistogram::bucketsNum);
+            counter.getHistogram()->accumulate(entry.first, entry.second);
+        };
+        for (auto& graph : _graphs) {
+            if (!graph._created.load(std::memory_order_acquire))
+                continue;
+            accumulate({}, graph.InferPerfCounter());
+            for (auto& node : graph.GetNodes())
+                accumulate(node->getName(), node->PerfCounter());
+        }
+        std::map<std::string, std::vector<double>> percentiles;
+        for (auto& entry : merged) {
+            auto stats = LatencyHistogram::percentiles(entry.second.first, entry.second.second);
+            // nodes which are not executed on inference, e.g. constant ones
+            if (stats[0] == 0 && !entry.first.empty())
+                continue;
+            percentiles.emplace(entry.first, std::move(stats));
+        }
+        IE_SET_METRIC_RETURN(CPU_LATENCY_PERCENTILES, percentiles);
+    } else if (name == CPU_METRIC_KEY(HUGE_PAGES_STATISTICS)) {
+        std::map<std::string, uint64_t> statistics;
+        for (auto& graph : _graphs) {
+            if (!graph._created.load(std::memory_order_acquire) || !graph.GetAllocator())
+                continue;
+            for (auto& entry : graph.GetAllocator()->getStatistics())
+                statistics[entry.first] += entry.second;
+        }
+        if (!statistics.empty())
+            statistics["huge_page_size"] = HugePagesAllocator::hugePageSize();
+        IE_SET_METRIC_RETURN(CPU_HUGE_PAGES_STATISTICS, statistics);
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric: " << name;
     }
@@ -229,11 +300,11 @@ bool MKLDNNExecNetwork::CanProcessDynBatch(const InferenceEngine::CNNNetwork &ne
     for (auto op : ops) {
         auto type = TypeFromName(op->get_type_name());
         if (type == Tile) {
-            const auto tile = std::dynamic_pointer_cast<const ngraph::opset1::Tile>(op);
-            const auto repeatsNode = std::dynamic_pointer_cast<const ngraph::opset1::Constant>(tile->get_input_node_shared_ptr(1));
+            const auto repeatsNode = std::dynamic_pointer_cast<const ngraph::opset1::Constant>(op->get_input_node_shared_ptr(1));
             if (!repeatsNode)
                 return false;
-            if (tile && repeatsNode->cast_vector<int64_t>()[0] == 1)
+            const auto repeats = repeatsNode->cast_vector<int64_t>();
+            if (!repeats.empty() && repeats[0] == 1)
                 continue;
         }
 
@@ -242,6 +313,29 @@ bool MKLDNNExecNetwork::CanProcessDynBatch(const InferenceEngine::CNNNetwork &ne
                 continue;
         }
 
+        // Permutation based nodes process batch as the outermost loop when it is not moved by the permutation
+        if (type == Transpose) {
+            const auto orderNode = std::dynamic_pointer_cast<const ngraph::opset1::Constant>(op->get_input_node_shared_ptr(1));
+            if (!orderNode)
+                return false;
+            // empty order means reversed axes, so the batch is moved for any input except 1D one
+            const auto order = orderNode->cast_vector<int64_t>();
+            if (order.empty() ? op->get_input_shape(0).size() > 1 : order[0] != 0)
+                return false;
+            continue;
+        }
+
+        if (type == ShuffleChannels) {
+            const auto shuffle = std::dynamic_pointer_cast<const ngraph::opset1::ShuffleChannels>(op);
+            if (!shuffle)
+                return false;
+            const auto rank = static_cast<int64_t>(op->get_input_shape(0).size());
+            const auto axis = shuffle->get_axis() < 0 ? shuffle->get_axis() + rank : shuffle->get_axis();
+            if (axis == 0)
+                return false;
+            continue;
+        }
+
         if (type != Input &&
             type != Output &&
             type != Convolution &&
@@ -253,6 +347,9 @@ bool MKLDNNExecNetwork::CanProcessDynBatch(const InferenceEngine::CNNNetwork &ne
             type != Softmax &&
             type != Split &&
             type != Concatenation &&
+            type != DepthToSpace &&
+            type != SpaceToDepth &&
+            type != Convert &&
                 type != Eltwise) {
             return false;
         }
@@ -34,6 +34,12 @@ public:
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
+    /**
+     * Only CPU_MODEL_PRIORITY may be changed. The graphs are not locked, so the call doesn't wait for the running
+     * requests, the new priority affects the requests started later.
+     */
+    void SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config) override;
+
     InferenceEngine::Parameter GetConfig(const std::string &name) const override;
 
     InferenceEngine::Parameter GetMetric(const std::string &name) const override;
@@ -48,14 +54,21 @@ protected:
     MKLDNNExtensionManager::Ptr extensionManager;
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> memoryStates;
     const InferenceEngine::CNNNetwork           _network;
-    std::mutex                                  _cfgMutex;
+    mutable std::mutex                          _cfgMutex;
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
+    std::atomic_int                             _priority = {0};
     std::string                                 _name;
     struct Graph : public MKLDNNGraph {
         std::mutex  _mutex;
+        // set once the graph is created, its nodes may be read without the lock afterwards
+        std::atomic<bool> _created = {false};
+        bool IsCreated() const {
+            return _created.load(std::memory_order_acquire);
+        }
         struct Lock : public std::unique_lock<std::mutex> {
             explicit Lock(Graph& graph) : std::unique_lock<std::mutex>(graph._mutex), _graph(graph) {}
+            Lock(Graph& graph, std::try_to_lock_t) : std::unique_lock<std::mutex>(graph._mutex, std::try_to_lock), _graph(graph) {}
             Graph&                          _graph;
         };
     };
@@ -66,6 +79,9 @@ protected:
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
      *       even from main thread
+     * NOTE: If the workspace pool is enabled, there may be less graphs than streams. In that case the stream leases
+     *       an idle graph preferring the ones created on its NUMA node, and waits only for a graph of the same node
+     *       (see leaseGraph()).
      */
     Graph::Lock GetGraph();
 
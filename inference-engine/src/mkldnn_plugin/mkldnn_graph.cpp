@@ -25,6 +25,7 @@
 #include <nodes/mkldnn_input_node.h>
 #include <nodes/mkldnn_reorder_node.h>
 #include <nodes/mkldnn_convert_node.h>
+#include <nodes/mkldnn_fullyconnected_node.h>
 
 #include <ie_algorithm.hpp>
 #include <blob_factory.hpp>
@@ -39,6 +40,7 @@
 #include "utils/node_dumper.h"
 #include "utils/ngraph_utils.hpp"
 #include "utils/cpu_utils.hpp"
+#include "utils/numa_utils.h"
 
 #include <ngraph/node.hpp>
 #include <ngraph/function.hpp>
@@ -79,6 +81,12 @@ void MKLDNNGraph::CreateGraph(NET &net, const MKLDNNExtensionManager::Ptr& extMg
     Replicate(net, extMgr);
     InitGraph();
 
+    if (config.latencyHistograms) {
+        inferPerfCounter.enableHistogram();
+        for (auto &node : graphNodes)
+            node->PerfCounter().enableHistogram();
+    }
+
     status = Ready;
 
     ENABLE_CPU_DEBUG_CAP(serialize(*this));
@@ -322,6 +330,13 @@ void MKLDNNGraph::Replicate(const CNNNetwork &network, const MKLDNNExtensionMana
 void MKLDNNGraph::InitGraph() {
     MKLDNNGraphOptimizer optimizer;
 
+    for (auto &node : graphNodes) {
+        if (node->getType() == FullyConnected) {
+            std::static_pointer_cast<MKLDNNFullyConnectedNode>(node)->setSparseWeightsDecompressionRate(
+                    config.fcSparseWeightsDecompressionRate);
+        }
+    }
+
     SortTopologically();
     InitNodes();
 
@@ -338,6 +353,8 @@ void MKLDNNGraph::InitGraph() {
     optimizer.ApplyImplSpecificGraphOptimizations(*this);
     SortTopologically();
 
+    InitInvariantNodes();
+
     Allocate();
 
     CreatePrimitives();
@@ -631,6 +648,8 @@ void MKLDNNGraph::AllocateWithReuse() {
             isConst  |= isConstOutput(edge);
             isOutput |= edge->getChild()->getType() == Output;
             isInput  |= edge->getParent()->getType() == Input;
+            // Outputs of invariant nodes are computed once and read by the following Infer() calls
+            isConst  |= isInvariantNode(edge->getParent());
         }
 
         if (reuse_io_tensors) {
@@ -649,8 +668,40 @@ void MKLDNNGraph::AllocateWithReuse() {
     MemorySolver memSolver(boxes);
     size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
 
-    memWorkspace = std::make_shared<MKLDNNMemory>(eng);
-    memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)));
+    workspaceSize = total_size;
+    workspaceLowerBound = static_cast<size_t>(std::max<int64_t>(memSolver.maxDepth(), 0)) * alignment;
+
+    if (config.hugePages != Config::HugePagesMode::Off && !allocator) {
+        allocator = std::make_shared<HugePagesAllocator>(config.hugePages == Config::HugePagesMode::Explicit ?
+                                                         HugePagesAllocator::Mode::Explicit : HugePagesAllocator::Mode::Transparent,
+                                                         numaNodeId);
+    }
+
+    if (!numaAllocator && canPlaceOnNumaNode(numaNodeId))
+        numaAllocator = std::make_shared<NumaAllocator>(numaNodeId);
+
+    MKLDNNMemoryDesc workspaceDesc(TensorDesc(Precision::I8, {total_size}, Layout::C));
+    auto workspace = std::make_shared<MKLDNNMemory>(eng);
+    std::shared_ptr<void> holder;
+    // the smaller workspace would be taken from the heap with less alignment than the default one
+    std::shared_ptr<InferenceEngine::IAllocator> workspaceAllocator;
+    const auto hugePageSize = HugePagesAllocator::hugePageSize();
+    if (allocator && hugePageSize != 0 && total_size >= hugePageSize)
+        workspaceAllocator = allocator;
+    else if (numaAllocator && total_size >= NumaAllocator::minPlacedSize())
+        workspaceAllocator = numaAllocator;
+
+    if (workspaceAllocator) {
+        auto handle = workspaceAllocator->alloc(total_size);
+        if (handle == nullptr)
+            IE_THROW() << "Cannot allocate " << total_size << " bytes of the workspace for graph " << GetName();
+        holder.reset(handle, [workspaceAllocator](void* ptr) { workspaceAllocator->free(ptr); });
+        workspace->Create(workspaceDesc, handle);
+    } else {
+        workspace->Create(workspaceDesc);
+    }
+    memWorkspace = workspace;
+    workspaceHolder = holder;
 
     if (edge_clusters.empty())
         return;
@@ -679,6 +730,72 @@ void MKLDNNGraph::AllocateWithReuse() {
     }
 }
 
+void MKLDNNGraph::InitInvariantNodes() {
+    invariantNodes.clear();
+    if (invariantInputs.empty())
+        return;
+
+    auto isInvariantOrConst = [&](const MKLDNNNodePtr& node) {
+        return node->isConstant() || invariantNodes.count(node.get());
+    };
+
+    // graphNodes are sorted topologically, so all parents are visited before a node
+    for (auto &node : graphNodes) {
+        if (node->isConstant())
+            continue;
+
+        if (node->getType() == Input) {
+            if (invariantInputs.count(node->getName()))
+                invariantNodes.insert(node.get());
+            continue;
+        }
+
+        if (one_of(node->getType(), Output, MemoryInput, MemoryOutput) || node->getParentEdges().empty())
+            continue;
+
+        bool isInvariant = true;
+        for (size_t i = 0; isInvariant && i < node->getParentEdges().size(); i++)
+            isInvariant = isInvariantOrConst(node->getParentEdgeAt(i)->getParent());
+
+        if (isInvariant)
+            invariantNodes.insert(node.get());
+    }
+
+    // A variant node which works in-place would overwrite the result of its invariant parent,
+    // so such parents have to be recomputed on each Infer() call.
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (auto &node : graphNodes) {
+            if (!invariantNodes.count(node.get()) || node->getType() == Input)
+                continue;
+
+            for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+                auto child = node->getChildEdgeAt(i)->getChild();
+                if (!invariantNodes.count(child.get()) && child->isInplace()) {
+                    invariantNodes.erase(node.get());
+                    changed = true;
+                    break;
+                }
+            }
+        }
+
+        // nodes which lost all invariant parents are variant as well
+        for (auto &node : graphNodes) {
+            if (!invariantNodes.count(node.get()) || node->getType() == Input)
+                continue;
+
+            for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+                if (!isInvariantOrConst(node->getParentEdgeAt(i)->getParent())) {
+                    invariantNodes.erase(node.get());
+                    changed = true;
+                    break;
+                }
+            }
+        }
+    }
+}
+
 void MKLDNNGraph::Allocate() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::Allocate");
 
@@ -770,7 +887,6 @@ void MKLDNNGraph::PullOutputData(const BlobMap &out) {
 
         int MB = intr_blob.GetDims()[0];
         int MB_to_process = node->batchToProcess();
-        // TODO: Should we support InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT???
         if (config.batchLimit)
             MB_to_process = std::min<int>(config.batchLimit, MB_to_process);
         size_t size_to_copy = intr_blob.GetElementsCount() * MB_to_process / MB;
@@ -802,6 +918,14 @@ void MKLDNNGraph::PullOutputData(const BlobMap &out) {
 }
 
 void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
+    InferNodes(request, batch, false);
+}
+
+void MKLDNNGraph::InferVariantPart(MKLDNNInferRequest* request, int batch) {
+    InferNodes(request, batch, true);
+}
+
+void MKLDNNGraph::InferNodes(MKLDNNInferRequest* request, int batch, bool skipInvariant) {
     if (!IsReady()) {
         IE_THROW() << "Wrong state. Topology is not ready.";
     }
@@ -813,8 +937,12 @@ void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
     for (int i = 0; i < graphNodes.size(); i++) {
         if (request != nullptr) {
             request->ThrowIfCanceled();
+            request->YieldToHigherPriority();
         }
 
+        if (skipInvariant && isInvariantNode(graphNodes[i]))
+            continue;
+
         PERF(graphNodes[i]);
 
         if (batch > 0)
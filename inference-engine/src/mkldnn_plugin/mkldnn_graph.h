@@ -10,11 +10,14 @@
 #include "normalize_preprocess.h"
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
+#include "utils/huge_pages_allocator.h"
+#include "utils/numa_utils.h"
 #include <map>
 #include <string>
 #include <vector>
 #include <memory>
 #include <atomic>
+#include <unordered_set>
 
 namespace MKLDNNPlugin {
 class MKLDNNInferRequest;
@@ -44,6 +47,17 @@ public:
     void setProperty(const std::map<std::string, std::string> &properties);
     Config getProperty() const;
 
+    /**
+     * @brief Sets the NUMA node the graph memory is placed on. Must be called before CreateGraph().
+     */
+    void setNumaNodeId(int id) {
+        numaNodeId = id;
+    }
+
+    int getNumaNodeId() const {
+        return numaNodeId;
+    }
+
     void getInputBlobs(InferenceEngine::BlobMap &in_map);
     void getOutputBlobs(InferenceEngine::BlobMap &out_map);
 
@@ -61,6 +75,25 @@ public:
 
     void Infer(MKLDNNInferRequest* request = nullptr, int batch = -1);
 
+    /**
+     * @brief Sets names of the inputs which keep the same data between consecutive Infer() calls
+     * (e.g. loop invariant inputs of the TensorIterator body). Must be called before CreateGraph().
+     * Nodes which depend only on such inputs and constants get their output memory reserved for the whole graph lifetime.
+     */
+    void SetInvariantInputs(const std::unordered_set<std::string>& names) {
+        invariantInputs = names;
+    }
+
+    /**
+     * @brief Executes the graph skipping the nodes which depend only on invariant inputs and constants.
+     * Outputs of these nodes are kept from the previous Infer() call.
+     */
+    void InferVariantPart(MKLDNNInferRequest* request = nullptr, int batch = -1);
+
+    bool isInvariantNode(const MKLDNNNodePtr& node) const {
+        return invariantNodes.count(node.get()) != 0;
+    }
+
     const std::vector<MKLDNNNodePtr>& GetNodes() const {
         return graphNodes;
     }
@@ -99,6 +132,44 @@ public:
 
     void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
 
+    /**
+     * @brief Size in bytes of the memory workspace shared by the non-constant edges
+     */
+    size_t GetWorkspaceSize() const {
+        return workspaceSize;
+    }
+
+    /**
+     * @brief Lower bound of the workspace size in bytes: max total size of simultaneously alive tensors
+     */
+    size_t GetWorkspaceLowerBound() const {
+        return workspaceLowerBound;
+    }
+
+    /**
+     * @brief Allocator of the workspace and the infer request blobs, nullptr if CPU_HUGE_PAGES is disabled
+     */
+    const HugePagesAllocator::Ptr& GetAllocator() const {
+        return allocator;
+    }
+
+    /**
+     * @brief Allocator placing the memory on the NUMA node of the graph, nullptr if the memory is not placed explicitly
+     */
+    const NumaAllocator::Ptr& GetNumaAllocator() const {
+        return numaAllocator;
+    }
+
+    /**
+     * @brief Counter of the whole inference, updated by the infer request which holds the graph
+     */
+    PerfCount& InferPerfCounter() {
+        return inferPerfCounter;
+    }
+    const PerfCount& InferPerfCounter() const {
+        return inferPerfCounter;
+    }
+
     void RemoveDroppedNodes();
     void RemoveDroppedEdges();
     void RemoveEdge(MKLDNNEdgePtr& edge);
@@ -183,6 +254,7 @@ protected:
         outputNodesMap.clear();
         graphNodes.clear();
         graphEdges.clear();
+        invariantNodes.clear();
         _normalizePreprocMap.clear();
     }
     Status status { NotReady };
@@ -194,7 +266,21 @@ protected:
 
     bool reuse_io_tensors = true;
 
+    std::unordered_set<std::string> invariantInputs;
+    std::unordered_set<const MKLDNNNode*> invariantNodes;
+
+    PerfCount inferPerfCounter;
+
+    // NUMA node of the stream executing the graph, negative if the memory is not placed explicitly
+    int numaNodeId = -1;
+
+    HugePagesAllocator::Ptr allocator;
+    NumaAllocator::Ptr numaAllocator;
+    // keeps the workspace memory allocated by the allocator, must outlive memWorkspace
+    std::shared_ptr<void> workspaceHolder;
     MKLDNNMemoryPtr memWorkspace;
+    size_t workspaceSize = 0;
+    size_t workspaceLowerBound = 0;
 
     std::map<std::string, MKLDNNNodePtr> inputNodesMap;
     std::map<std::string, MKLDNNNodePtr> outputNodesMap;
@@ -219,6 +305,8 @@ protected:
     void AllocateWithReuse();
     void CreatePrimitives();
     void ExecuteConstantNodesOnly();
+    void InitInvariantNodes();
+    void InferNodes(MKLDNNInferRequest* request, int batch, bool skipInvariant);
 
     friend class MKLDNNInferRequest;
     friend class MKLDNNGraphlessInferRequest;
@@ -10,6 +10,8 @@
 #include <ngraph/variant.hpp>
 #include "ngraph/ngraph.hpp"
 #include "utils/debug_capabilities.h"
+#include "utils/general_utils.h"
+#include "utils/numa_utils.h"
 
 #include <vector>
 #include <string>
@@ -25,6 +27,8 @@ void serializeToXML(const MKLDNNGraph &graph, const std::string& path);
 
 namespace {
 
+const char MEMORY_NUMA_NODE[] = "memoryNumaNode";
+
 std::map<std::string, std::string> extract_node_metadata(const MKLDNNNodePtr &node) {
     std::map<std::string, std::string> serialization_info;
 
@@ -107,6 +111,16 @@ std::map<std::string, std::string> extract_node_metadata(const MKLDNNNodePtr &no
 
     serialization_info[ExecGraphInfoSerialization::RUNTIME_PRECISION] = node->getRuntimePrecision().name();
 
+    // NUMA node of the output memory, reported only on the systems with several NUMA nodes
+    if (!node->getChildEdges().empty()) {
+        auto edge = node->getChildEdgeAt(0);
+        if (one_of(edge->getStatus(), MKLDNNEdge::Status::Allocated, MKLDNNEdge::Status::Validated) && edge->getMemoryPtr()) {
+            const int numaNode = getNumaNodeOf(edge->getMemoryPtr()->GetData());
+            if (numaNode >= 0)
+                serialization_info[MEMORY_NUMA_NODE] = std::to_string(numaNode);
+        }
+    }
+
     return serialization_info;
 }
 
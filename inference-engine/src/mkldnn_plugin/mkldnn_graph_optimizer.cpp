@@ -17,6 +17,7 @@
 #include <nodes/mkldnn_transpose_node.h>
 #include "nodes/mkldnn_interpolate_node.h"
 #include "nodes/mkldnn_input_node.h"
+#include "nodes/mkldnn_softmax_node.h"
 #include "nodes/common/cpu_convert.h"
 
 #include "mkldnn/ie_mkldnn.h"
@@ -55,6 +56,10 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseConvolutionAndBias(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseSoftmaxAndScaleMask");
+    FuseSoftmaxAndScaleMask(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseMultiplyAndAdd");
     FuseMultiplyAndAdd(graph);
     graph.RemoveDroppedNodes();
@@ -127,6 +132,10 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseNormalizeL2AndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseSoftmaxAndSimpleOperation");
+    FuseSoftmaxAndSimpleOperation(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseEltwiseAndSimple");
     FuseEltwiseAndSimple(graph);
     graph.RemoveDroppedNodes();
@@ -1257,6 +1266,152 @@ void MKLDNNGraphOptimizer::FuseNormalizeL2AndSimpleOperation(MKLDNNGraph &graph)
     }
 }
 
+void MKLDNNGraphOptimizer::FuseSoftmaxAndScaleMask(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSutableSoftmaxNode = [](MKLDNNNodePtr node) {
+        return node->getType() == Softmax && node->getParentEdges().size() == 1 && node->getFusedWith().empty();
+    };
+
+    auto isSutablePreOp = [](MKLDNNNodePtr node) {
+        return node->getType() == Eltwise && node->getParentEdges().size() == 2 && node->getChildEdges().size() == 1 &&
+               node->getFusedWith().empty();
+    };
+
+    auto getScalarValue = [](MKLDNNNodePtr node, float &value) {
+        if (node->getType() != Input || !node->isConstant())
+            return false;
+        auto* inputNode = dynamic_cast<MKLDNNInputNode*>(node.get());
+        if (inputNode == nullptr)
+            return false;
+        auto constMemory = inputNode->getMemoryPtr();
+        if (!constMemory || constMemory->GetElementsCount() != 1)
+            return false;
+        cpu_convert(constMemory->GetPtr(), &value, MKLDNNExtensionUtils::DataTypeToIEPrecision(constMemory->GetDataType()), Precision::FP32, 1);
+        return true;
+    };
+
+    // Absorbs parent Eltwise node which has 'dataPort' input connected to the data flow and removes the edge on the other port
+    auto absorbParent = [&](MKLDNNNodePtr eltwise, size_t dataPort) {
+        auto otherEdge = eltwise->getParentEdgesAtPort(1 - dataPort)[0];
+        graph.RemoveEdge(otherEdge);
+        graph.DropNode(eltwise);
+    };
+
+    for (auto &node : graphNodes) {
+        if (!isSutableSoftmaxNode(node))
+            continue;
+
+        auto softmaxNode = std::dynamic_pointer_cast<MKLDNNSoftMaxNode>(node);
+        if (!softmaxNode)
+            continue;
+
+        const auto dataDims = softmaxNode->getParentEdgeAt(0)->getDims().ToSizeVector();
+
+        // additive mask: Softmax(x + mask), mask is broadcastable to x
+        auto parent = softmaxNode->getParentEdgeAt(0)->getParent();
+        if (isSutablePreOp(parent) && parent->getAlgorithm() == EltwiseAdd) {
+            const auto in0Dims = parent->getParentEdgesAtPort(0)[0]->getDims().ToSizeVector();
+            const auto in1Dims = parent->getParentEdgesAtPort(1)[0]->getDims().ToSizeVector();
+            const size_t dataPort = in0Dims == dataDims ? 0 : (in1Dims == dataDims ? 1 : 2);
+            const auto maskDims = dataPort == 0 ? in1Dims : in0Dims;
+
+            bool isBroadcastable = dataPort != 2 && maskDims.size() <= dataDims.size();
+            if (isBroadcastable) {
+                const auto normMaskDims = getNormalizedDimsBySize(maskDims, dataDims.size());
+                for (size_t i = 0; i < dataDims.size(); i++)
+                    isBroadcastable = isBroadcastable && one_of(normMaskDims[i], static_cast<size_t>(1), dataDims[i]);
+
+                // the softmax kernel loads the mask along the dimensions after the axis either as a scalar or as a dense vector
+                const auto axis = softmaxNode->getAxis();
+                const bool isInnerBroadcasted = std::all_of(normMaskDims.begin() + axis + 1, normMaskDims.end(),
+                                                            [](size_t dim) { return dim == 1; });
+                const bool isInnerDense = std::equal(normMaskDims.begin() + axis + 1, normMaskDims.end(), dataDims.begin() + axis + 1);
+                isBroadcastable = isBroadcastable && (isInnerBroadcasted || isInnerDense);
+            }
+
+            if (isBroadcastable) {
+                auto maskEdge = parent->getParentEdgesAtPort(1 - dataPort)[0];
+                auto maskParent = maskEdge->getParent();
+                const int maskInNum = maskEdge->getInputNum();
+                const auto maskPrecision = parent->getOriginalInputPrecisionAtPort(1 - dataPort);
+
+                absorbParent(parent, dataPort);
+
+                MKLDNNEdgePtr newEdge(new MKLDNNEdge(maskParent, softmaxNode, maskInNum, MKLDNNSoftMaxNode::MASK));
+                graph.GetEdges().push_back(newEdge);
+                maskParent->addEdge(newEdge);
+
+                node->inDims.push_back(maskParent->outDims[maskInNum]);
+                softmaxNode->addOriginalInputPrecision(maskPrecision);
+                softmaxNode->addOriginalLayer(parent->getOriginalLayers());
+                softmaxNode->fuseMask();
+            }
+        }
+
+        // scale: Softmax(x * s) or Softmax(x / s), s is a scalar constant
+        parent = softmaxNode->getParentEdgeAt(MKLDNNSoftMaxNode::DATA)->getParent();
+        if (parent->getType() == Eltwise && parent->getAlgorithm() == EltwisePowerStatic && parent->getChildEdges().size() == 1 &&
+                parent->getFusedWith().empty()) {
+            auto eltwiseNode = std::dynamic_pointer_cast<MKLDNNEltwiseNode>(parent);
+            if (eltwiseNode && eltwiseNode->getAlpha() == 1.f && eltwiseNode->getGamma() == 0.f) {
+                graph.DropNode(parent);
+                softmaxNode->addOriginalLayer(parent->getOriginalLayers());
+                softmaxNode->fuseScale(eltwiseNode->getBeta());
+            }
+        } else if (isSutablePreOp(parent) && one_of(parent->getAlgorithm(), EltwiseMultiply, EltwiseDivide)) {
+            const size_t constPort = parent->getAlgorithm() == EltwiseDivide ? 1 :
+                                     parent->getParentEdgesAtPort(1)[0]->getParent()->isConstant() ? 1 : 0;
+            float value = 0.f;
+            if (getScalarValue(parent->getParentEdgesAtPort(constPort)[0]->getParent(), value) &&
+                    parent->getParentEdgesAtPort(1 - constPort)[0]->getDims().ToSizeVector() == dataDims &&
+                    (parent->getAlgorithm() == EltwiseMultiply || value != 0.f)) {
+                absorbParent(parent, 1 - constPort);
+                softmaxNode->addOriginalLayer(parent->getOriginalLayers());
+                softmaxNode->fuseScale(parent->getAlgorithm() == EltwiseDivide ? 1.f / value : value);
+            }
+        }
+    }
+}
+
+void MKLDNNGraphOptimizer::FuseSoftmaxAndSimpleOperation(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSutableParentNode = [](MKLDNNNodePtr node) {
+        return node->getType() == Softmax && node->getChildEdges().size() == 1;
+    };
+
+    auto parent = graphNodes.begin();
+    while (parent != graphNodes.end()) {
+        auto parentNode = *parent;
+        if (!isSutableParentNode(parentNode)) {
+            parent++;
+            continue;
+        }
+
+        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
+        if (!parentNode->canFuse(childNode)) {
+            parent++;
+            continue;
+        }
+
+        childNode->fuseInto(parentNode);
+
+        if (childNode->getType() == FakeQuantize || childNode->getType() == Eltwise) {
+            auto parentEdges = childNode->parentEdges;
+            for (auto &parentEdge : parentEdges) {
+                auto p_edge = parentEdge.lock();
+                if (p_edge->getParent()->getType() == Softmax)
+                    continue;
+
+                graph.RemoveEdge(p_edge);
+            }
+        }
+
+        graph.DropNode(childNode);
+    }
+}
+
 void MKLDNNGraphOptimizer::FuseEltwiseAndSimple(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
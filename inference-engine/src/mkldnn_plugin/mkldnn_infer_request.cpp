@@ -23,6 +23,25 @@
 #include "utils/general_utils.h"
 #include "utils/cpu_utils.hpp"
 
+namespace {
+// Removes suffix with pair ID from the memory node id. Internal information.
+std::string getStateName(const std::string& id) {
+    auto suffix_idx = id.find("/id=");
+    return suffix_idx != std::string::npos ? id.substr(0, suffix_idx) : id;
+}
+
+// The large blobs are backed with huge pages if the graph has the allocator, otherwise they are placed on the NUMA
+// node of the graph if it has one
+InferenceEngine::Blob::Ptr allocateBlob(const InferenceEngine::TensorDesc& desc, const MKLDNNPlugin::MKLDNNGraph& graph) {
+    std::shared_ptr<InferenceEngine::IAllocator> allocator = graph.GetAllocator();
+    if (!allocator)
+        allocator = graph.GetNumaAllocator();
+    auto blob = allocator ? make_blob_with_precision(desc, allocator) : make_blob_with_precision(desc);
+    blob->allocate();
+    return blob;
+}
+}  // namespace
+
 MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsDataMap     networkInputs,
                                                      InferenceEngine::OutputsDataMap    networkOutputs,
                                                      MKLDNNExecNetwork::Ptr             execNetwork_)
@@ -35,6 +54,11 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
         IE_THROW() << "No graph was found";
     graph = &(execNetwork->GetGraph()._graph);
 
+    _streamsExecutor = dynamic_cast<InferenceEngine::CPUStreamsExecutor*>(execNetwork->_taskExecutor.get());
+    // requests leasing graphs from the workspace pool may wait for the graph locked by the preempted request
+    if (execNetwork->_cfg.workspacePoolSize == 0)
+        _priorityOwner = execNetwork.get();
+
     // Allocate all input blobs
     for (const auto& it : _networkInputs) {
         MKLDNNInferRequest::GetBlob(it.first);
@@ -53,12 +77,7 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
             if (node->getType() == MemoryInput) {
                 auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
                 auto state_store = memoryNode->getStore();
-                auto state_name = memoryNode->getId();
-
-                // Remove suffix with pair ID. Internal information.
-                auto suffix_idx = state_name.find("/id=");
-                if (suffix_idx != std::string::npos)
-                    state_name = state_name.substr(0, suffix_idx);
+                auto state_name = getStateName(memoryNode->getId());
 
                 memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
            }
@@ -67,6 +86,9 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
         memoryStates = execNetwork->QueryState();
     }
     IE_SUPPRESS_DEPRECATED_END
+
+    for (const auto& state : memoryStates)
+        memoryStatesMap[state->GetName()] = state;
 }
 
 MKLDNNPlugin::MKLDNNInferRequest::~MKLDNNInferRequest() {
@@ -127,19 +149,24 @@ void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::PushStates() {
+    // Each request owns its state blobs, so the graph state storage is just pointed to them and Assign writes
+    // the new state directly into the request's blob. Copy is used only if the storage has padded layout.
     for (auto &node : graph->GetNodes()) {
         if (node->getType() == MemoryInput) {
             auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
-                }
+            auto state = memoryStatesMap.find(getStateName(cur_node->getId()));
+            if (state == memoryStatesMap.end())
+                continue;
+
+            auto cur_state_mem = cur_node->getStore();
+            auto data_ptr = state->second->GetState()->cbuffer().as<void*>();
+            auto data_size = state->second->GetState()->byteSize();
+
+            if (data_size == cur_state_mem->GetSize()) {
+                cur_node->bindStore(data_ptr);
+            } else {
+                cur_node->unbindStore();
+                cpu_memcpy(cur_state_mem->GetPtr(), data_ptr, data_size);
             }
         }
     }
@@ -149,27 +176,27 @@ void MKLDNNPlugin::MKLDNNInferRequest::PullStates() {
     for (auto &node : graph->GetNodes()) {
         if (node->getType() == MemoryInput) {
             auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
-                }
-            }
+            auto state = memoryStatesMap.find(getStateName(cur_node->getId()));
+            if (state == memoryStatesMap.end())
+                continue;
+
+            auto cur_state_mem = cur_node->getStore();
+            auto data_ptr = state->second->GetState()->cbuffer().as<void*>();
+            // bound storage already contains the new state
+            if (cur_state_mem->GetData() != data_ptr)
+                cpu_memcpy(data_ptr, cur_state_mem->GetPtr(), state->second->GetState()->byteSize());
+            // the graph is shared by the requests, so it must not keep a pointer to the blob of this one
+            cur_node->unbindStore();
         }
     }
 }
 
-
 void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     using namespace openvino::itt;
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, profilingTask);
     auto graphLock = execNetwork->GetGraph();
     graph = &(graphLock._graph);
+    PerfHelper inferPerfHelper(graph->InferPerfCounter());
 
     ThrowIfCanceled();
 
@@ -185,7 +212,14 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
         PushStates();
     }
 
-    graph->Infer(this, m_curBatch);
+    try {
+        graph->Infer(this, m_curBatch);
+    } catch (...) {
+        if (memoryStates.size() != 0) {
+            PullStates();
+        }
+        throw;
+    }
 
     if (memoryStates.size() != 0) {
         PullStates();
@@ -233,8 +267,7 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
                 desc = InferenceEngine::TensorDesc(p, dims, l);
             }
 
-            _inputs[name] = make_blob_with_precision(desc);
-            _inputs[name]->allocate();
+            _inputs[name] = allocateBlob(desc, *graph);
             if (blobs[name]->getTensorDesc() == desc &&
                 graph->_normalizePreprocMap.find(name) == graph->_normalizePreprocMap.end() && !graph->getProperty().batchLimit) {
                 externalPtr[name] = _inputs[name]->buffer();
@@ -272,8 +305,7 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
                 auto currBlockDesc = InferenceEngine::BlockingDesc(desc.getBlockingDesc().getBlockDims(), desc.getBlockingDesc().getOrder());
                 desc = InferenceEngine::TensorDesc(desc.getPrecision(), desc.getDims(), currBlockDesc);
 
-                data = make_blob_with_precision(desc);
-                data->allocate();
+                data = allocateBlob(desc, *graph);
             } else {
                 const auto& expectedTensorDesc = blobs[name]->getTensorDesc();
 
@@ -521,3 +553,14 @@ void MKLDNNPlugin::MKLDNNInferRequest::ThrowIfCanceled() const {
         _asyncRequest->ThrowIfCanceled();
     }
 }
+
+void MKLDNNPlugin::MKLDNNInferRequest::RunPrioritized(InferenceEngine::Task task) {
+    IE_ASSERT(_streamsExecutor != nullptr);
+    _streamsExecutor->run(std::move(task), execNetwork->_priority, _priorityOwner);
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::YieldToHigherPriority() const {
+    if (_streamsExecutor != nullptr) {
+        _streamsExecutor->RunPreemptingTasks();
+    }
+}
@@ -8,7 +8,9 @@
 #include <memory>
 #include <string>
 #include <map>
+#include <unordered_map>
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
+#include <threading/ie_cpu_streams_executor.hpp>
 
 namespace MKLDNNPlugin {
 
@@ -47,6 +49,17 @@ public:
      */
     void ThrowIfCanceled() const;
 
+    /**
+     * @brief Enqueues the inference task to the streams executor with the priority of the executable network
+     */
+    void RunPrioritized(InferenceEngine::Task task);
+
+    /**
+     * @brief Preemption point between the nodes execution: if the request is started by the streams executor,
+     * executes the queued requests with higher priority in place
+     */
+    void YieldToHigherPriority() const;
+
 private:
     void PushInputData();
     void PushStates();
@@ -60,6 +73,10 @@ private:
     std::map<std::string, void*>        externalPtr;
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
+    std::unordered_map<std::string, std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStatesMap;
     MKLDNNAsyncInferRequest*            _asyncRequest = nullptr;
+    InferenceEngine::CPUStreamsExecutor* _streamsExecutor = nullptr;
+    // owner of the prioritized tasks, null if the request may not be executed in place of the preempted one
+    const void*                         _priorityOwner = nullptr;
 };
 }  // namespace MKLDNNPlugin
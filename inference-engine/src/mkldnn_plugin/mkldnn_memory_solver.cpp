@@ -8,6 +8,9 @@
 
 
 #include <algorithm>
+#include <functional>
+#include <limits>
+#include <numeric>
 #include <vector>
 #include <map>
 
@@ -46,55 +49,116 @@ MemorySolver::MemorySolver(const std::vector<Box>& boxes) : _boxes(boxes) {
     _time_duration = ts_f - rm_ts_f;
 }
 
-inline bool popupTogetherWith(MemorySolver::Box &box_new, const MemorySolver::Box &box_old) {
-    if (box_new.id+box_new.size > box_old.id &&
-        box_old.id+box_old.size > box_new.id) {
-        // Move the new one up. There is an intersection
-        box_new.id = box_old.id + box_old.size;
-        return true;
-    } else {
-        return false;
+namespace {
+
+/**
+ * Puts boxes one by one in specified order. Each box is placed into the smallest free gap between already placed
+ * boxes with intersected live time (best fit) or into the lowest one (first fit). If there is no suitable gap
+ * the box is put on top.
+ *
+ * @return required memory size or -1 if it exceeds the limit
+ */
+int64_t placeBoxes(const std::vector<MemorySolver::Box> &boxes, const std::vector<size_t> &order, bool bestFit,
+                   int64_t limit, std::vector<int64_t> &offsets) {
+    std::vector<size_t> placed;
+    placed.reserve(order.size());
+    std::vector<std::pair<int64_t, int64_t>> busy;  // [begin, end) of memory used by intersected boxes
+
+    int64_t min_required = 0;
+    for (size_t idx : order) {
+        const auto &box = boxes[idx];
+
+        busy.clear();
+        for (size_t p : placed) {
+            const auto &other = boxes[p];
+            if (other.start <= box.finish && box.start <= other.finish)
+                busy.emplace_back(offsets[p], offsets[p] + other.size);
+        }
+        std::sort(busy.begin(), busy.end());
+
+        int64_t offset = -1;
+        int64_t best_gap = std::numeric_limits<int64_t>::max();
+        int64_t cur = 0;
+        for (const auto &range : busy) {
+            const int64_t gap = range.first - cur;
+            if (gap >= box.size && gap < best_gap) {
+                offset = cur;
+                best_gap = gap;
+                if (!bestFit)
+                    break;
+            }
+            cur = std::max(cur, range.second);
+        }
+        if (offset == -1)
+            offset = cur;
+
+        offsets[idx] = offset;
+        placed.push_back(idx);
+
+        min_required = std::max(min_required, offset + box.size);
+        if (min_required >= limit)
+            return -1;
     }
+
+    return min_required;
 }
 
-int64_t MemorySolver::solve() {
-    maxTopDepth();  // at first make sure that we no need more for boxes sorted by box.start
-    std::vector<std::vector<const Box*>> time_slots(_time_duration);
-    for (auto & slot : time_slots) slot.reserve(_top_depth);  // 2D array [_time_duration][_top_depth]
-
-    // Sort be box size. First is biggest
-    // Comment this line to check other order of box putting
-    std::sort(_boxes.begin(), _boxes.end(), [](const Box& l, const Box& r)
-        { return l.size > r.size; });
-
-    int64_t _min_required = 0;
-
-    for (Box& box : _boxes) {
-        // start from bottom and will lift it up if intersect with other present
-        int64_t id = box.id;
-        box.id = 0;  // id will be used as a temp offset storage
-        bool popped_up;
-        do {
-            popped_up = false;
-            for (int i_slot = box.start; i_slot <= box.finish; i_slot++) {
-                for (auto *box_in_slot : time_slots[i_slot]) {
-                    // intersect with already stored boxes for all covered time slots
-                    // and move up the new one if needed
-                    popped_up |= popupTogetherWith(box, *box_in_slot);
-                }
-            }
-        } while (popped_up);
+// Exhaustive search over placement orders is affordable only for the very small number of boxes
+constexpr size_t exhaustiveSearchLimit = 8;
 
-        // add current box to covered time slot
-        for (int i_slot = box.start; i_slot <= box.finish; i_slot++)
-            time_slots[i_slot].push_back(&box);
+}  // namespace
 
-        // store the max top bound for each box
-        _min_required = std::max(_min_required, box.id + box.size);
-        _offsets[id] = box.id;  // TODO: move to constructor (use .insert instead of [])
+int64_t MemorySolver::solve() {
+    // Sum of sizes of simultaneously alive boxes. No solution can be better.
+    const int64_t lower_bound = maxDepth();
+
+    using Comparator = std::function<bool(const Box&, const Box&)>;
+    const auto duration = [](const Box& b) { return static_cast<int64_t>(b.finish - b.start + 1); };
+    const std::vector<std::pair<Comparator, bool>> strategies = {
+        // biggest first
+        {[&](const Box& l, const Box& r) { return l.size > r.size || (l.size == r.size && duration(l) > duration(r)); }, true},
+        {[&](const Box& l, const Box& r) { return l.size > r.size || (l.size == r.size && duration(l) > duration(r)); }, false},
+        // biggest area (size * live time) first
+        {[&](const Box& l, const Box& r) { return l.size * duration(l) > r.size * duration(r); }, true},
+        // longest living first
+        {[&](const Box& l, const Box& r) { return duration(l) > duration(r) || (duration(l) == duration(r) && l.size > r.size); }, true},
+        // in execution order
+        {[&](const Box& l, const Box& r) { return l.start < r.start || (l.start == r.start && l.size > r.size); }, true},
+    };
+
+    std::vector<size_t> order(_boxes.size());
+    std::vector<int64_t> offsets(_boxes.size());
+    std::vector<int64_t> best_offsets;
+    int64_t best = std::numeric_limits<int64_t>::max();
+
+    auto tryOrder = [&](bool bestFit) {
+        const int64_t required = placeBoxes(_boxes, order, bestFit, best, offsets);
+        if (required != -1 && required < best) {
+            best = required;
+            best_offsets = offsets;
+        }
+    };
+
+    for (const auto &strategy : strategies) {
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](size_t l, size_t r) { return strategy.first(_boxes[l], _boxes[r]); });
+        tryOrder(strategy.second);
+        if (best == lower_bound)
+            break;
     }
 
-    return _min_required;
+    if (best > lower_bound && _boxes.size() <= exhaustiveSearchLimit) {
+        std::iota(order.begin(), order.end(), 0);
+        do {
+            tryOrder(false);
+        } while (best > lower_bound && std::next_permutation(order.begin(), order.end()));
+    }
+
+    _offsets.clear();
+    for (size_t i = 0; i < _boxes.size(); i++)
+        _offsets[_boxes[i].id] = best_offsets[i];
+
+    return best;
 }
 
 int64_t MemorySolver::maxDepth() {
@@ -10,6 +10,7 @@
 #include "nodes/common/cpu_memcpy.h"
 
 #include <string>
+#include <cstring>
 
 namespace MKLDNNPlugin {
 
@@ -19,7 +20,9 @@ public:
             InferenceEngine::IVariableStateInternal{name} {
         state = make_blob_with_precision(MKLDNNMemoryDesc(storage->GetDescriptor()));
         state->allocate();
-        cpu_memcpy(state->buffer(), storage->GetData(), storage->GetSize());
+        // default memory state is zero filled. Don't read the storage since it may be bound to the state of
+        // another infer request
+        std::memset(state->buffer(), 0, state->byteSize());
     }
 
     void Reset() override;
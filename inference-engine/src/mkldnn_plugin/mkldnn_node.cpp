@@ -1144,24 +1144,29 @@ int MKLDNNNode::getMaxBatch() {
 void MKLDNNNode::setDynamicBatchLim(int lim) {
     dynBatchLim = lim;
 
-    auto setDynamicBatch = [this](int argType, int newBatch) {
-        auto param = primArgs.find(argType);
-        if (param != primArgs.end()) {
-            auto oldMem = param->second;
-            mkldnn::memory::desc newMemDesc(oldMem.get_desc());
+    if (primArgs.empty())
+        return;
+
+    // Arguments created for the max batch share data handles with the edges memory, so the arguments for the
+    // smaller batch are always derived from them to pick up the actual data pointers.
+    if (maxBatchPrimArgs.empty())
+        maxBatchPrimArgs = primArgs;
+
+    const int newBatch = batchToProcess();
+    for (int argType : {DNNL_ARG_SRC, DNNL_ARG_DST, DNNL_ARG_DIFF_SRC, DNNL_ARG_DIFF_DST}) {
+        auto param = maxBatchPrimArgs.find(argType);
+        if (param == maxBatchPrimArgs.end())
+            continue;
+
+        const auto &maxBatchMem = param->second;
+        if (newBatch == getMaxBatch()) {
+            primArgs[argType] = maxBatchMem;
+        } else {
+            mkldnn::memory::desc newMemDesc(maxBatchMem.get_desc());
             newMemDesc.data.dims[0] = newBatch;
             newMemDesc.data.padded_dims[0] = newBatch;
-            mkldnn::memory newMem(newMemDesc, oldMem.get_engine(), oldMem.get_data_handle());
-            primArgs.at(argType) = newMem;
+            primArgs[argType] = mkldnn::memory(newMemDesc, maxBatchMem.get_engine(), maxBatchMem.get_data_handle());
         }
-    };
-
-    if (!primArgs.empty()) {
-        int newBatch = batchToProcess();
-        setDynamicBatch(DNNL_ARG_SRC, newBatch);
-        setDynamicBatch(DNNL_ARG_DST, newBatch);
-        setDynamicBatch(DNNL_ARG_DIFF_SRC, newBatch);
-        setDynamicBatch(DNNL_ARG_DIFF_DST, newBatch);
     }
 }
 
@@ -691,6 +691,7 @@ protected:
     std::vector<MKLDNNMemoryPtr> internalBlobMemory;
     std::vector<PrimitiveDescInfo> supportedPrimitiveDescriptors;
     std::unordered_map<int, mkldnn::memory> primArgs;
+    std::unordered_map<int, mkldnn::memory> maxBatchPrimArgs;
     MKLDNNPrimitive prim;
     std::vector<MKLDNNDescriptor> descs;
 
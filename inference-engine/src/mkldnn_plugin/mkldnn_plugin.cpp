@@ -62,6 +62,7 @@
 #include <transformations/rt_info/fused_names_attribute.hpp>
 #include <transformations/op_conversions/fq_decomposition.hpp>
 #include <transformations/utils/utils.hpp>
+#include <pruning.hpp>
 
 #include <ngraph/opsets/opset2.hpp>
 #include <ngraph/opsets/opset3.hpp>
@@ -117,6 +118,9 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
 
     ngraph::pass::Manager manager;
     manager.register_pass<ngraph::pass::InitNodeInfo>();
+    // the masks are propagated through the original operations, so it goes before the other transformations
+    if (conf.pruning)
+        manager.register_pass<ngraph::pass::Pruning>();
 
     const bool useLpt =
         (conf.lpTransformsMode == Config::LPTransformsMode::On) &&
@@ -3,6 +3,7 @@
 //
 
 #include "mkldnn_weights_cache.hpp"
+#include "nodes/common/cpu_memcpy.h"
 
 #include <ie_system_conf.h>
 #include <memory>
@@ -11,6 +12,36 @@ namespace MKLDNNPlugin {
 
 const SimpleDataHash MKLDNNWeightsSharing::simpleCRC;
 
+MKLDNNWeightsSharing::MKLDNNWeightsSharing(int numaNodeId) : numaNodeId(numaNodeId) {
+    if (canPlaceOnNumaNode(numaNodeId))
+        allocator = std::make_shared<NumaAllocator>(numaNodeId);
+}
+
+MKLDNNMemoryPtr MKLDNNWeightsSharing::moveToNumaNode(const MKLDNNMemoryPtr& memory) const {
+    const auto desc = memory->GetDescriptor();
+    const size_t size = desc.get_size();
+    if (!allocator || size < NumaAllocator::minPlacedSize())
+        return memory;
+    auto handle = allocator->alloc(size);
+    if (handle == nullptr)
+        return memory;
+
+    // the placed data lives as long as the memory object pointing to it
+    struct PlacedMemory {
+        PlacedMemory(std::shared_ptr<void> holder, const mkldnn::engine& eng) : holder(std::move(holder)), memory(eng) {}
+        std::shared_ptr<void> holder;
+        MKLDNNMemory memory;
+    };
+    auto placedAllocator = allocator;
+    auto placed = std::make_shared<PlacedMemory>(std::shared_ptr<void>(handle, [placedAllocator](void* ptr) {
+                                                     placedAllocator->free(ptr);
+                                                 }),
+                                                 memory->GetPrimitive().get_engine());
+    placed->memory.Create(desc, handle, false);
+    cpu_memcpy(handle, memory->GetData(), size);
+    return MKLDNNMemoryPtr(placed, &placed->memory);
+}
+
 MKLDNNWeightsSharing::MKLDNNSharedMemory::MKLDNNSharedMemory(
         std::unique_lock<std::mutex> && lock,
         const MKLDNNMemoryInfo::Ptr & memory,
@@ -45,6 +76,9 @@ MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::findOrCreate
     if (found == sharedWeights.end()
         || !((ptr = found->second) && (newPtr = ptr->sharedMemory.lock()))) {
         newPtr = create();
+        // the creators allocate the memory on the heap, so it is copied to the memory mapped on the node
+        if (newPtr)
+            newPtr = moveToNumaNode(newPtr);
         ptr = std::make_shared<MKLDNNMemoryInfo>(newPtr, valid);
         sharedWeights[key] = ptr;
     }
@@ -72,7 +106,7 @@ MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::get(const st
 
 NumaNodesWeights::NumaNodesWeights() {
     for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
-        _cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>();
+        _cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>(numa_id);
 }
 
 MKLDNNWeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) {
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <mkldnn_memory.h>
+#include "utils/numa_utils.h"
 
 #include <unordered_map>
 #include <functional>
@@ -69,6 +70,11 @@ class MKLDNNWeightsSharing {
 public:
     typedef std::shared_ptr<MKLDNNWeightsSharing> Ptr;
 
+    /**
+     * @param numaNodeId NUMA node the created memory is placed on, negative values mean no explicit placement
+     */
+    explicit MKLDNNWeightsSharing(int numaNodeId = -1);
+
     class MKLDNNSharedMemory {
     public:
         typedef std::shared_ptr<MKLDNNSharedMemory> Ptr;
@@ -95,7 +101,16 @@ public:
 
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
+    int getNumaNodeId() const {
+        return numaNodeId;
+    }
+
 protected:
+    // copies the memory to the one placed on the NUMA node, returns the memory as is if it can't be placed
+    MKLDNNMemoryPtr moveToNumaNode(const MKLDNNMemoryPtr& memory) const;
+
+    const int numaNodeId;
+    NumaAllocator::Ptr allocator;
     mutable std::mutex guard;
     std::unordered_map<std::string, MKLDNNMemoryInfo::Ptr> sharedWeights;
     static const SimpleDataHash simpleCRC;
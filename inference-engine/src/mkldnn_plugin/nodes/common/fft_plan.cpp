@@ -0,0 +1,301 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fft_plan.h"
+
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+
+#include "ie_parallel.hpp"
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+constexpr double PI = 3.141592653589793238462643;
+// Generic radix butterfly is O(radix^2), so larger prime factors are handled by Bluestein algorithm
+constexpr size_t maxGenericRadix = 13;
+
+inline void complexMul(float lhsReal, float lhsImag, float rhsReal, float rhsImag, float& real, float& imag) {
+    real = lhsReal * rhsReal - lhsImag * rhsImag;
+    imag = lhsReal * rhsImag + lhsImag * rhsReal;
+}
+
+std::vector<size_t> factorize(size_t n) {
+    std::vector<size_t> factors;
+    while (n % 4 == 0) {
+        factors.push_back(4);
+        n /= 4;
+    }
+    for (size_t p = 2; p * p <= n; p += (p == 2 ? 1 : 2)) {
+        while (n % p == 0) {
+            factors.push_back(p);
+            n /= p;
+        }
+    }
+    if (n > 1)
+        factors.push_back(n);
+    return factors;
+}
+
+/*
+ * Butterflies of one stage for the fixed pidx and range of q:
+ *   a_r = src[q + stride * (pidx + r * butterflies)]
+ *   dst[q + stride * (radix * pidx + t)] = W_n^(pidx * t) * sum_r(a_r * W_radix^(r * t))
+ * Radix == 0 means generic radix.
+ */
+template <size_t Radix>
+void stageKernel(size_t radix, size_t butterflies, size_t stride, const float* twiddles, const float* radixTwiddles,
+                 float sign, const float* src, float* dst, size_t pidx, size_t qBegin, size_t qEnd) {
+    constexpr size_t maxRadix = Radix == 0 ? maxGenericRadix : Radix;
+    const size_t p = Radix == 0 ? radix : Radix;
+    const float* tw = twiddles + 2 * pidx * (p - 1);
+
+    for (size_t q = qBegin; q < qEnd; q++) {
+        float aReal[maxRadix] = {}, aImag[maxRadix] = {};
+        for (size_t r = 0; r < p; r++) {
+            const float* a = src + 2 * (q + stride * (pidx + r * butterflies));
+            aReal[r] = a[0];
+            aImag[r] = a[1];
+        }
+
+        float bReal[maxRadix] = {}, bImag[maxRadix] = {};
+        if (Radix == 2) {
+            bReal[0] = aReal[0] + aReal[1];
+            bImag[0] = aImag[0] + aImag[1];
+            bReal[1] = aReal[0] - aReal[1];
+            bImag[1] = aImag[0] - aImag[1];
+        } else if (Radix == 3) {
+            const float c = 0.866025403784438646763723f * sign;  // sin(2pi/3)
+            const float sReal = aReal[1] + aReal[2], sImag = aImag[1] + aImag[2];
+            const float dReal = aReal[1] - aReal[2], dImag = aImag[1] - aImag[2];
+            const float mReal = aReal[0] - 0.5f * sReal, mImag = aImag[0] - 0.5f * sImag;
+            bReal[0] = aReal[0] + sReal;
+            bImag[0] = aImag[0] + sImag;
+            bReal[1] = mReal + c * dImag;
+            bImag[1] = mImag - c * dReal;
+            bReal[2] = mReal - c * dImag;
+            bImag[2] = mImag + c * dReal;
+        } else if (Radix == 4) {
+            const float s02Real = aReal[0] + aReal[2], s02Imag = aImag[0] + aImag[2];
+            const float d02Real = aReal[0] - aReal[2], d02Imag = aImag[0] - aImag[2];
+            const float s13Real = aReal[1] + aReal[3], s13Imag = aImag[1] + aImag[3];
+            const float d13Real = (aReal[1] - aReal[3]) * sign, d13Imag = (aImag[1] - aImag[3]) * sign;
+            bReal[0] = s02Real + s13Real;
+            bImag[0] = s02Imag + s13Imag;
+            bReal[1] = d02Real + d13Imag;
+            bImag[1] = d02Imag - d13Real;
+            bReal[2] = s02Real - s13Real;
+            bImag[2] = s02Imag - s13Imag;
+            bReal[3] = d02Real - d13Imag;
+            bImag[3] = d02Imag + d13Real;
+        } else if (Radix == 5) {
+            const float c1 = 0.309016994374947424102293f;               // cos(2pi/5)
+            const float c2 = -0.809016994374947424102293f;              // cos(4pi/5)
+            const float s1 = 0.951056516295153572116439f * sign;        // sin(2pi/5)
+            const float s2 = 0.587785252292473129168706f * sign;        // sin(4pi/5)
+            const float s14Real = aReal[1] + aReal[4], s14Imag = aImag[1] + aImag[4];
+            const float d14Real = aReal[1] - aReal[4], d14Imag = aImag[1] - aImag[4];
+            const float s23Real = aReal[2] + aReal[3], s23Imag = aImag[2] + aImag[3];
+            const float d23Real = aReal[2] - aReal[3], d23Imag = aImag[2] - aImag[3];
+
+            const float m1Real = aReal[0] + c1 * s14Real + c2 * s23Real, m1Imag = aImag[0] + c1 * s14Imag + c2 * s23Imag;
+            const float m2Real = aReal[0] + c2 * s14Real + c1 * s23Real, m2Imag = aImag[0] + c2 * s14Imag + c1 * s23Imag;
+            // multiplied by -i
+            const float n1Real = s1 * d14Imag + s2 * d23Imag, n1Imag = -(s1 * d14Real + s2 * d23Real);
+            const float n2Real = s2 * d14Imag - s1 * d23Imag, n2Imag = -(s2 * d14Real - s1 * d23Real);
+
+            bReal[0] = aReal[0] + s14Real + s23Real;
+            bImag[0] = aImag[0] + s14Imag + s23Imag;
+            bReal[1] = m1Real + n1Real;
+            bImag[1] = m1Imag + n1Imag;
+            bReal[4] = m1Real - n1Real;
+            bImag[4] = m1Imag - n1Imag;
+            bReal[2] = m2Real + n2Real;
+            bImag[2] = m2Imag + n2Imag;
+            bReal[3] = m2Real - n2Real;
+            bImag[3] = m2Imag - n2Imag;
+        } else {
+            for (size_t t = 0; t < p; t++) {
+                float sumReal = 0.f, sumImag = 0.f;
+                for (size_t r = 0; r < p; r++) {
+                    const size_t k = (r * t) % p;
+                    float real, imag;
+                    complexMul(aReal[r], aImag[r], radixTwiddles[2 * k], radixTwiddles[2 * k + 1], real, imag);
+                    sumReal += real;
+                    sumImag += imag;
+                }
+                bReal[t] = sumReal;
+                bImag[t] = sumImag;
+            }
+        }
+
+        float* b = dst + 2 * (q + stride * p * pidx);
+        b[0] = bReal[0];
+        b[1] = bImag[0];
+        for (size_t t = 1; t < p; t++) {
+            complexMul(bReal[t], bImag[t], tw[2 * (t - 1)], tw[2 * (t - 1) + 1], b[2 * stride * t], b[2 * stride * t + 1]);
+        }
+    }
+}
+
+}  // namespace
+
+FFTPlan::FFTPlan(size_t length, bool inverse) : length(length), inverse(inverse) {
+    const double sign = inverse ? 1.0 : -1.0;
+    const auto factors = factorize(length);
+    if (!factors.empty() && factors.back() > maxGenericRadix) {
+        useBluestein = true;
+
+        size_t convLength = 1;
+        while (convLength < 2 * length - 1)
+            convLength *= 2;
+
+        convForward.reset(new FFTPlan(convLength, false));
+        convInverse.reset(new FFTPlan(convLength, true));
+
+        chirp.resize(2 * length);
+        for (size_t k = 0; k < length; k++) {
+            // k^2 mod 2n keeps the angle precise for large k
+            const double angle = sign * PI * static_cast<double>((k * k) % (2 * length)) / length;
+            chirp[2 * k] = static_cast<float>(std::cos(angle));
+            chirp[2 * k + 1] = static_cast<float>(std::sin(angle));
+        }
+
+        chirpFFT.assign(2 * convLength, 0.f);
+        for (size_t k = 0; k < length; k++) {
+            chirpFFT[2 * k] = chirp[2 * k];
+            chirpFFT[2 * k + 1] = -chirp[2 * k + 1];
+            if (k != 0) {
+                chirpFFT[2 * (convLength - k)] = chirp[2 * k];
+                chirpFFT[2 * (convLength - k) + 1] = -chirp[2 * k + 1];
+            }
+        }
+        std::vector<float> scratch(convForward->getScratchSize());
+        convForward->execute(chirpFFT.data(), scratch.data());
+        return;
+    }
+
+    size_t transformLength = length;
+    size_t stride = 1;
+    for (size_t radix : factors) {
+        Stage stage;
+        stage.radix = radix;
+        stage.butterflies = transformLength / radix;
+        stage.stride = stride;
+
+        stage.twiddles.resize(2 * stage.butterflies * (radix - 1));
+        for (size_t pidx = 0; pidx < stage.butterflies; pidx++) {
+            for (size_t t = 1; t < radix; t++) {
+                const double angle = sign * 2.0 * PI * static_cast<double>(pidx * t) / transformLength;
+                stage.twiddles[2 * (pidx * (radix - 1) + t - 1)] = static_cast<float>(std::cos(angle));
+                stage.twiddles[2 * (pidx * (radix - 1) + t - 1) + 1] = static_cast<float>(std::sin(angle));
+            }
+        }
+
+        if (radix > 5) {
+            stage.radixTwiddles.resize(2 * radix);
+            for (size_t k = 0; k < radix; k++) {
+                const double angle = sign * 2.0 * PI * static_cast<double>(k) / radix;
+                stage.radixTwiddles[2 * k] = static_cast<float>(std::cos(angle));
+                stage.radixTwiddles[2 * k + 1] = static_cast<float>(std::sin(angle));
+            }
+        }
+
+        stages.push_back(std::move(stage));
+        transformLength /= radix;
+        stride *= radix;
+    }
+}
+
+size_t FFTPlan::getScratchSize() const {
+    if (useBluestein)
+        return 2 * convForward->getLength() + convForward->getScratchSize();
+    return 2 * length;
+}
+
+void FFTPlan::execute(float* data, float* scratch, bool parallel) const {
+    if (useBluestein)
+        executeBluestein(data, scratch, parallel);
+    else
+        executeMixedRadix(data, scratch, parallel);
+}
+
+void FFTPlan::executeStage(const Stage& stage, const float* src, float* dst, bool parallel) const {
+    const float sign = inverse ? -1.f : 1.f;
+    auto kernel = [&](size_t pidx, size_t qBegin, size_t qEnd) {
+        switch (stage.radix) {
+            case 2: stageKernel<2>(2, stage.butterflies, stage.stride, stage.twiddles.data(), nullptr, sign, src, dst, pidx, qBegin, qEnd);
+                break;
+            case 3: stageKernel<3>(3, stage.butterflies, stage.stride, stage.twiddles.data(), nullptr, sign, src, dst, pidx, qBegin, qEnd);
+                break;
+            case 4: stageKernel<4>(4, stage.butterflies, stage.stride, stage.twiddles.data(), nullptr, sign, src, dst, pidx, qBegin, qEnd);
+                break;
+            case 5: stageKernel<5>(5, stage.butterflies, stage.stride, stage.twiddles.data(), nullptr, sign, src, dst, pidx, qBegin, qEnd);
+                break;
+            default: stageKernel<0>(stage.radix, stage.butterflies, stage.stride, stage.twiddles.data(), stage.radixTwiddles.data(),
+                                    sign, src, dst, pidx, qBegin, qEnd);
+        }
+    };
+
+    if (!parallel) {
+        for (size_t pidx = 0; pidx < stage.butterflies; pidx++)
+            kernel(pidx, 0, stage.stride);
+    } else if (stage.butterflies >= stage.stride) {
+        InferenceEngine::parallel_for(stage.butterflies, [&](size_t pidx) {
+            kernel(pidx, 0, stage.stride);
+        });
+    } else {
+        InferenceEngine::parallel_for(stage.stride, [&](size_t q) {
+            for (size_t pidx = 0; pidx < stage.butterflies; pidx++)
+                kernel(pidx, q, q + 1);
+        });
+    }
+}
+
+void FFTPlan::executeMixedRadix(float* data, float* scratch, bool parallel) const {
+    float* src = data;
+    float* dst = scratch;
+    for (const auto& stage : stages) {
+        executeStage(stage, src, dst, parallel);
+        std::swap(src, dst);
+    }
+
+    if (src != data)
+        std::memcpy(data, src, 2 * length * sizeof(float));
+
+    if (inverse) {
+        const float scale = 1.f / length;
+        for (size_t i = 0; i < 2 * length; i++)
+            data[i] *= scale;
+    }
+}
+
+void FFTPlan::executeBluestein(float* data, float* scratch, bool parallel) const {
+    const size_t convLength = convForward->getLength();
+    float* conv = scratch;
+    float* convScratch = scratch + 2 * convLength;
+
+    for (size_t k = 0; k < length; k++)
+        complexMul(data[2 * k], data[2 * k + 1], chirp[2 * k], chirp[2 * k + 1], conv[2 * k], conv[2 * k + 1]);
+    std::fill(conv + 2 * length, conv + 2 * convLength, 0.f);
+
+    convForward->execute(conv, convScratch, parallel);
+    for (size_t k = 0; k < convLength; k++) {
+        const float real = conv[2 * k], imag = conv[2 * k + 1];
+        complexMul(real, imag, chirpFFT[2 * k], chirpFFT[2 * k + 1], conv[2 * k], conv[2 * k + 1]);
+    }
+    convInverse->execute(conv, convScratch, parallel);
+
+    const float scale = inverse ? 1.f / length : 1.f;
+    for (size_t k = 0; k < length; k++) {
+        float real, imag;
+        complexMul(conv[2 * k], conv[2 * k + 1], chirp[2 * k], chirp[2 * k + 1], real, imag);
+        data[2 * k] = real * scale;
+        data[2 * k + 1] = imag * scale;
+    }
+}
+
+}  // namespace MKLDNNPlugin
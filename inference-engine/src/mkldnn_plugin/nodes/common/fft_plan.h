@@ -0,0 +1,67 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Precomputed complex FFT of the fixed length.
+ *
+ * Lengths which are decomposed into the small prime factors are computed by the mixed-radix (2, 3, 4, 5 and generic
+ * small prime) Stockham algorithm. Other lengths are computed by the Bluestein algorithm via the power of two FFT.
+ * All twiddle factors are computed on the plan creation.
+ * Data is the array of interleaved complex numbers (real, imaginary). Inverse transform is normalized by the length.
+ */
+class FFTPlan {
+public:
+    FFTPlan(size_t length, bool inverse);
+
+    /**
+     * @brief In-place transform
+     * @param data length complex numbers
+     * @param scratch buffer of getScratchSize() floats
+     * @param parallel use threads inside the transform (makes sense for the single long signal only)
+     */
+    void execute(float* data, float* scratch, bool parallel = false) const;
+
+    size_t getScratchSize() const;
+    size_t getLength() const {
+        return length;
+    }
+
+private:
+    /**
+     * Decimation in frequency step: splits each of 'stride' transforms of length radix * butterflies into
+     * 'radix' transforms of length 'butterflies'.
+     */
+    struct Stage {
+        size_t radix;
+        size_t butterflies;
+        size_t stride;
+        std::vector<float> twiddles;       // butterflies x (radix - 1) complex numbers
+        std::vector<float> radixTwiddles;  // radix complex roots of unity for the generic radix
+    };
+
+    void executeMixedRadix(float* data, float* scratch, bool parallel) const;
+    void executeBluestein(float* data, float* scratch, bool parallel) const;
+    void executeStage(const Stage& stage, const float* src, float* dst, bool parallel) const;
+
+    size_t length;
+    bool inverse;
+
+    std::vector<Stage> stages;
+
+    bool useBluestein = false;
+    std::unique_ptr<FFTPlan> convForward;
+    std::unique_ptr<FFTPlan> convInverse;
+    std::vector<float> chirp;     // exp(-+i * pi * k^2 / length)
+    std::vector<float> chirpFFT;  // FFT of the zero padded conjugated chirp
+};
+
+}  // namespace MKLDNNPlugin
@@ -7,53 +7,36 @@
 #include <ie_parallel.hpp>
 #include <cpu/x64/jit_generator.hpp>
 #include <cpu/x64/jit_uni_eltwise_injector.hpp>
+#include <cpu/x64/jit_uni_depthwise_injector.hpp>
+#include <cpu/x64/jit_uni_quantization_injector.hpp>
 #include <mkldnn.hpp>  // TODO: just to replace mkldnn->dnnl via macros
 #include "utils/bfloat16.hpp"
-#include "emitters/jit_bf16_emitters.hpp"
+#include "emitters/jit_load_store_emitters.hpp"
 
 #include <algorithm>
 #include <cassert>
+#include <limits>
 #include <vector>
 
 using namespace InferenceEngine;
 using namespace MKLDNNPlugin;
 using namespace mkldnn;
+using namespace mkldnn::impl;
 using namespace mkldnn::impl::cpu;
 using namespace mkldnn::impl::cpu::x64;
 using namespace mkldnn::impl::utils;
 
 #define GET_OFF(field) offsetof(jit_args_softmax, field)
 
-struct jit_args_softmax {
-    const void* src;
-    void* dst;
-    size_t src_stride;
-    size_t dst_stride;
-    size_t work_amount;
-};
-
-struct jit_softmax_config_params {
-    Precision src_dt;
-    Precision dst_dt;
-};
-
-
-struct jit_uni_softmax_kernel {
-    void (*ker_)(const jit_args_softmax *);
-
-    void operator()(const jit_args_softmax *args) { assert(ker_); ker_(args); }
-
-    jit_uni_softmax_kernel() : ker_(nullptr) {}
-    virtual ~jit_uni_softmax_kernel() {}
-
-    virtual void create_ker() = 0;
-};
-
+// Softmax(x * scale + mask) followed by post ops. The input is read three times (max, sum of exponents and
+// the final result) instead of keeping the exponents in dst: dst may be of an integer type and the result
+// is rounded only once.
 template <cpu_isa_t isa>
 struct jit_uni_softmax_kernel_f32 : public jit_uni_softmax_kernel, public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_softmax_kernel_f32)
 
-    jit_uni_softmax_kernel_f32(jit_softmax_config_params jcp) : jcp_(jcp), jit_uni_softmax_kernel(), jit_generator() {}
+    jit_uni_softmax_kernel_f32(jit_softmax_config_params jcp, const mkldnn_primitive_attr &attr)
+        : jit_uni_softmax_kernel(jcp, attr), jit_generator() {}
 
     void create_ker() override {
         jit_generator::create_kernel();
@@ -63,171 +46,309 @@ struct jit_uni_softmax_kernel_f32 : public jit_uni_softmax_kernel, public jit_ge
     void generate() override {
         exp_injector.reset(new jit_uni_eltwise_injector_f32<isa>(this, mkldnn::impl::alg_kind::eltwise_exp, 0.f, 0.f, 1.0f));
 
-        if (!mayiuse(avx512_core_bf16) && mayiuse(avx512_core))
-            emu_vcvtneps2bf16.reset(new jit_emu_vcvtneps2bf16(this, isa, nullptr));
+        const auto &p = attr_.post_ops_;
+        for (int i = 0; i < p.len(); i++) {
+            auto &post_op = p.entry_[i];
+            if (post_op.is_eltwise()) {
+                eltwise_injectors.push_back(std::make_shared<jit_uni_eltwise_injector_f32<isa>>(
+                        this, post_op.eltwise.alg, post_op.eltwise.alpha, post_op.eltwise.beta, post_op.eltwise.scale));
+            } else if (post_op.is_depthwise()) {
+                depthwise_injectors.push_back(std::make_shared<jit_uni_depthwise_injector_f32<isa>>(
+                        this, post_op.depthwise.alg));
+            } else if (post_op.is_quantization()) {
+                quantization_injectors.push_back(std::make_shared<jit_uni_quantization_injector_f32<isa>>(
+                        this, post_op, vmm_d_weights, vmm_d_bias, reg_d_weights, reg_d_bias));
+            }
+        }
 
-        this->preamble();
+        load_emitter.reset(new jit_load_emitter(this, isa, nullptr));
+        store_emitter.reset(new jit_store_emitter(this, isa, nullptr));
 
+        load_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx()), static_cast<size_t>(reg_load_table.getIdx())};
+        store_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx())};
+        store_pool_vec_idxs = {static_cast<size_t>(vmm_store_aux.getIdx())};
+
+        this->preamble();
 
-        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
-        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
         mov(reg_src_stride, ptr[reg_params + GET_OFF(src_stride)]);
         mov(reg_dst_stride, ptr[reg_params + GET_OFF(dst_stride)]);
-        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        if (jcp_.with_mask)
+            mov(reg_mask_stride, ptr[reg_params + GET_OFF(mask_stride)]);
 
-        Xbyak::Label max_loop_label;
-        Xbyak::Label max_loop_end_label;
-        Xbyak::Label exp_loop_label;
-        Xbyak::Label exp_loop_end_label;
-        Xbyak::Label div_loop_label;
-        Xbyak::Label div_loop_end_label;
-
-        mov(aux_reg_work_amount, reg_work_amount);
-        mov(aux_reg_src, reg_src);
-        load_vector(vmm_max, ptr[aux_reg_src], jcp_.src_dt);
-        L(max_loop_label); {
-            cmp(aux_reg_work_amount, 0);
-            jle(max_loop_end_label, T_NEAR);
-
-            load_vector(vmm_val, ptr[aux_reg_src], jcp_.src_dt);
-
-            if (isa == x64::sse41) {
-                uni_vmovups(vmm_mask, vmm_val);
-                uni_vcmpgtps(vmm_mask, vmm_mask, vmm_max);
-            } else if (isa == x64::avx2) {
-                uni_vcmpgtps(vmm_mask, vmm_val, vmm_max);
-            } else {
-                vcmpps(k_mask, vmm_val, vmm_max, _cmp_nle_us);
-            }
+        if (jcp_.with_scale)
+            broadcast_value(vmm_scale, jcp_.scale);
 
-            if (isa == x64::avx512_common) {
-                vptestmd(k_mask, vmm_mask, vmm_mask);
-                vblendmps(vmm_max | k_mask, vmm_max, vmm_val);
-            } else {
-                uni_vblendvps(vmm_max, vmm_max, vmm_val, vmm_mask);
-            }
+        broadcast_value(vmm_max, -std::numeric_limits<float>::infinity());
+        worker(pass_type::max);
 
-            add(aux_reg_src, reg_src_stride);
-            sub(aux_reg_work_amount, 1);
+        uni_vpxor(vmm_sum, vmm_sum, vmm_sum);
+        worker(pass_type::sum);
 
-            jmp(max_loop_label, T_NEAR);
-        }
+        broadcast_value(vmm_aux, 1.f);
+        uni_vdivps(vmm_aux, vmm_aux, vmm_sum);
+        uni_vmovups(vmm_sum, vmm_aux);
+        worker(pass_type::dst);
 
-        L(max_loop_end_label);
+        this->postamble();
 
-        mov(aux_reg_work_amount, reg_work_amount);
-        mov(aux_reg_src, reg_src);
-        mov(aux_reg_dst, reg_dst);
-        uni_vpxor(vmm_exp_sum, vmm_exp_sum, vmm_exp_sum);
-        L(exp_loop_label); {
-            cmp(aux_reg_work_amount, 0);
-            jle(exp_loop_end_label, T_NEAR);
+        load_emitter->emit_data();
+        store_emitter->emit_data();
 
-            load_vector(vmm_val, ptr[aux_reg_src], jcp_.src_dt);
+        exp_injector->prepare_table();
+        for (auto& inj : eltwise_injectors)
+            inj->prepare_table();
+    }
 
-            uni_vsubps(vmm_val, vmm_val, vmm_max);
-            exp_injector->compute_vector_range(vmm_val.getIdx(), vmm_val.getIdx() + 1);
-            uni_vaddps(vmm_exp_sum, vmm_exp_sum, vmm_val);
+private:
+    using Vmm = typename conditional3<isa == x64::sse41, Xbyak::Xmm, isa == x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int step = vlen / sizeof(float);
 
-            store_vector(ptr[aux_reg_dst], vmm_val, jcp_.dst_dt);
+    enum class pass_type { max, sum, dst };
 
-            add(aux_reg_src, reg_src_stride);
-            add(aux_reg_dst, reg_dst_stride);
-            sub(aux_reg_work_amount, 1);
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_mask = r10;
+    Xbyak::Reg64 reg_work_amount = r11;
+    Xbyak::Reg64 reg_oc_off = r12;
+    Xbyak::Reg64 reg_src_stride = r13;
+    Xbyak::Reg64 reg_dst_stride = r14;
+    Xbyak::Reg64 reg_mask_stride = r15;
+    Xbyak::Reg64 reg_params = abi_param1;
 
-            jmp(exp_loop_label, T_NEAR);
-        }
+    Xbyak::Reg64 reg_d_weights = rbx;
+    Xbyak::Reg64 reg_d_bias = rdx;
+    Xbyak::Reg64 reg_load_table = rsi;
+    Xbyak::Reg64 reg_load_store_mask = rbp;
+    Xbyak::Reg64 reg_aux = rax;
 
-        L(exp_loop_end_label);
+    Vmm vmm_aux = Vmm(0);
+    Vmm vmm_val = Vmm(1);
+    Vmm vmm_max = Vmm(2);
+    Vmm vmm_sum = Vmm(3);
+    Vmm vmm_scale = Vmm(4);
+    Vmm vmm_d_weights = Vmm(5);
+    Vmm vmm_d_bias = Vmm(6);
+    Vmm vmm_store_aux = Vmm(7);
+    Xbyak::Xmm xmm_aux = Xbyak::Xmm(0);
 
-        mov(aux_reg_work_amount, reg_work_amount);
-        mov(aux_reg_dst, reg_dst);
-        L(div_loop_label); {
-            cmp(aux_reg_work_amount, 0);
-            jle(div_loop_end_label, T_NEAR);
+    const Xbyak::Opmask k_mask = Xbyak::Opmask(7);
 
-            load_vector(vmm_val, ptr[aux_reg_dst], jcp_.dst_dt);
+    std::unique_ptr<jit_load_emitter> load_emitter = nullptr;
+    std::unique_ptr<jit_store_emitter> store_emitter = nullptr;
 
-            uni_vdivps(vmm_val, vmm_val, vmm_exp_sum);
+    std::vector<size_t> store_pool_gpr_idxs;
+    std::vector<size_t> store_pool_vec_idxs;
+    std::vector<size_t> load_pool_gpr_idxs;
 
-            store_vector(ptr[aux_reg_dst], vmm_val, jcp_.dst_dt);
+    std::shared_ptr<jit_uni_eltwise_injector_f32<isa>> exp_injector;
 
-            add(aux_reg_dst, reg_dst_stride);
-            sub(aux_reg_work_amount, 1);
+    std::vector<std::shared_ptr<jit_uni_eltwise_injector_f32<isa>>> eltwise_injectors;
+    std::vector<std::shared_ptr<jit_uni_depthwise_injector_f32<isa>>> depthwise_injectors;
+    std::vector<std::shared_ptr<jit_uni_quantization_injector_f32<isa>>> quantization_injectors;
 
-            jmp(div_loop_label, T_NEAR);
+    inline void worker(pass_type pass) {
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        if (jcp_.with_mask)
+            mov(reg_mask, ptr[reg_params + GET_OFF(mask)]);
+        if (pass == pass_type::dst) {
+            mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+            mov(reg_oc_off, ptr[reg_params + GET_OFF(oc_off)]);
         }
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
 
-        L(div_loop_end_label);
+        const int elt_num = jcp_.along_axis || jcp_.tail == 0 ? step : jcp_.tail;
 
-        this->postamble();
+        Xbyak::Label loop_label;
+        Xbyak::Label loop_end_label;
+        L(loop_label); {
+            cmp(reg_work_amount, 0);
+            jle(loop_end_label, T_NEAR);
 
-        if (!mayiuse(avx512_core_bf16) && mayiuse(avx512_core))
-            emu_vcvtneps2bf16->emit_data();
+            worker_step(pass, elt_num);
 
-        exp_injector->prepare_table();
+            add(reg_src, reg_src_stride);
+            if (jcp_.with_mask)
+                add(reg_mask, reg_mask_stride);
+            if (pass == pass_type::dst) {
+                add(reg_dst, reg_dst_stride);
+                if (jcp_.channel_along_axis)
+                    add(reg_oc_off, jcp_.along_axis ? vlen : static_cast<int>(sizeof(float)));
+            }
+            sub(reg_work_amount, 1);
+
+            jmp(loop_label, T_NEAR);
+        }
+        L(loop_end_label);
+
+        if (jcp_.along_axis) {
+            if (jcp_.tail != 0)
+                worker_step(pass, jcp_.tail);
+
+            if (pass == pass_type::max)
+                horiz_reduce(vmm_max, pass);
+            else if (pass == pass_type::sum)
+                horiz_reduce(vmm_sum, pass);
+        }
     }
 
-private:
-    using Vmm = typename conditional3<isa == x64::sse41, Xbyak::Xmm, isa == x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
-    size_t vlen = cpu_isa_traits<isa>::vlen;
+    inline void worker_step(pass_type pass, int elt_num) {
+        // lanes beyond elt_num must not affect horizontal reductions
+        const bool fill_tail = jcp_.along_axis && elt_num != step;
 
-    Xbyak::Reg64 reg_src = r8;
-    Xbyak::Reg64 aux_reg_src = r13;
-    Xbyak::Reg64 reg_dst = r9;
-    Xbyak::Reg64 aux_reg_dst = r15;
-    Xbyak::Reg64 reg_work_amount = r11;
-    Xbyak::Reg64 aux_reg_work_amount = r12;
-    Xbyak::Reg64 reg_src_stride = r14;
-    Xbyak::Reg64 reg_dst_stride = r10;
-    Xbyak::Reg64 reg_params = abi_param1;
+        load_value(elt_num);
 
-    Vmm vmm_mask = Vmm(0);
-    Vmm vmm_val = Vmm(1);
-    Vmm vmm_max = Vmm(2);
-    Vmm vmm_exp_sum = Vmm(3);
+        if (pass == pass_type::max) {
+            if (fill_tail)
+                blend_tail(vmm_val, -std::numeric_limits<float>::infinity(), elt_num);
+            uni_vmaxps(vmm_max, vmm_max, vmm_val);
+            return;
+        }
 
-    const Xbyak::Opmask k_mask = Xbyak::Opmask(1);
+        uni_vsubps(vmm_val, vmm_val, vmm_max);
+        exp_injector->compute_vector_range(vmm_val.getIdx(), vmm_val.getIdx() + 1);
 
-    std::unique_ptr<jit_emu_vcvtneps2bf16> emu_vcvtneps2bf16;
+        if (pass == pass_type::sum) {
+            if (fill_tail)
+                blend_tail(vmm_val, 0.f, elt_num);
+            uni_vaddps(vmm_sum, vmm_sum, vmm_val);
+            return;
+        }
 
-    std::shared_ptr<jit_uni_eltwise_injector_f32<isa>> exp_injector;
+        uni_vmulps(vmm_val, vmm_val, vmm_sum);
+
+        apply_post_ops(jcp_.dst_dt, !(jcp_.along_axis && jcp_.channel_along_axis));
+
+        store_emitter->emit_code({static_cast<size_t>(vmm_val.getIdx())}, {static_cast<size_t>(reg_dst.getIdx())},
+            std::make_shared<store_emitter_context>(Precision::FP32, jcp_.dst_dt, elt_num),
+            {store_pool_vec_idxs}, {store_pool_gpr_idxs});
+    }
+
+    inline void load_value(int elt_num) {
+        load_emitter->emit_code({static_cast<size_t>(reg_src.getIdx())}, {static_cast<size_t>(vmm_val.getIdx())},
+            std::make_shared<load_emitter_context>(jcp_.src_dt, Precision::FP32, elt_num, 0, true),
+            {}, {load_pool_gpr_idxs});
+
+        if (jcp_.with_scale)
+            uni_vmulps(vmm_val, vmm_val, vmm_scale);
+
+        if (jcp_.with_mask) {
+            if (jcp_.broadcast_mask) {
+                uni_vbroadcastss(vmm_aux, ptr[reg_mask]);
+            } else {
+                load_emitter->emit_code({static_cast<size_t>(reg_mask.getIdx())}, {static_cast<size_t>(vmm_aux.getIdx())},
+                    std::make_shared<load_emitter_context>(Precision::FP32, Precision::FP32, elt_num, 0, true),
+                    {}, {load_pool_gpr_idxs});
+            }
+            uni_vaddps(vmm_val, vmm_val, vmm_aux);
+        }
+    }
 
-    jit_softmax_config_params jcp_;
-
-    inline void load_vector(Vmm vmm_src, const Xbyak::Address &op, Precision src_dt) {
-        switch (src_dt) {
-            case Precision::FP32:
-                uni_vmovups(vmm_src, op);
-                break;
-            case Precision::BF16:
-                vpmovzxwd(vmm_src, op);
-                uni_vpslld(vmm_src, vmm_src, 16);
-                break;
-            default:
-                assert(!"unknown src_dt");
+    inline void broadcast_value(Vmm vmm, float value) {
+        mov(reg_aux.cvt32(), float2int(value));
+        uni_vmovq(xmm_aux, reg_aux);
+        uni_vbroadcastss(vmm, xmm_aux);
+    }
+
+    // sets lanes [elt_num, step) of vmm to value
+    inline void blend_tail(Vmm vmm, float value, int elt_num) {
+        broadcast_value(vmm_aux, value);
+        if (isa == x64::sse41) {
+            uint8_t imm = 1;
+            imm = ~((imm << elt_num) - imm);
+            blendps(vmm, vmm_aux, imm);
+        } else if (isa == x64::avx2) {
+            uint8_t imm = 1;
+            imm = ~((imm << elt_num) - imm);
+            vblendps(vmm, vmm, vmm_aux, imm);
+        } else {
+            uint32_t tail_mask = 1;
+            tail_mask = ~((tail_mask << elt_num) - tail_mask);
+            mov(reg_aux.cvt32(), tail_mask);
+            kmovw(k_mask, reg_aux.cvt32());
+            vblendmps(vmm | k_mask, vmm, vmm_aux);
         }
     }
-    inline void store_vector(const Xbyak::Address &op, Vmm vmm_dst, Precision dst_dt) {
-        Xbyak::Ymm ymm_dst = Xbyak::Ymm(vmm_dst.getIdx());
-
-        switch (dst_dt) {
-            case Precision::FP32:
-                uni_vmovups(op, vmm_dst);
-                break;
-            case Precision::BF16:
-                if (mayiuse(avx512_core_bf16))
-                    vcvtneps2bf16(ymm_dst, vmm_dst);
-                else
-                    emu_vcvtneps2bf16->emit_code({static_cast<size_t>(vmm_dst.getIdx())}, {static_cast<size_t>(ymm_dst.getIdx())});
-                vmovdqu16(op, ymm_dst);
-                break;
-            default:
-                assert(!"unknown dst_dt");
+
+    // reduces all lanes of vmm, the result is broadcasted to every lane
+    inline void horiz_reduce(Vmm vmm, pass_type pass) {
+        auto reduce = [&](const Vmm &aux) {
+            if (pass == pass_type::max)
+                uni_vmaxps(vmm, vmm, aux);
+            else
+                uni_vaddps(vmm, vmm, aux);
+        };
+
+        if (isa == x64::avx512_common) {
+            Xbyak::Zmm zmm = Xbyak::Zmm(vmm.getIdx());
+            Xbyak::Zmm zmm_aux = Xbyak::Zmm(vmm_aux.getIdx());
+            vshuff32x4(zmm_aux, zmm, zmm, 0x4E);
+            reduce(vmm_aux);
+            vshuff32x4(zmm_aux, zmm, zmm, 0xB1);
+            reduce(vmm_aux);
+        } else if (isa == x64::avx2) {
+            Xbyak::Ymm ymm = Xbyak::Ymm(vmm.getIdx());
+            Xbyak::Ymm ymm_aux = Xbyak::Ymm(vmm_aux.getIdx());
+            vperm2f128(ymm_aux, ymm, ymm, 0x01);
+            reduce(vmm_aux);
+        }
+        uni_vshufps(vmm_aux, vmm, vmm, 0x4E);
+        reduce(vmm_aux);
+        uni_vshufps(vmm_aux, vmm, vmm, 0xB1);
+        reduce(vmm_aux);
+    }
+
+    void apply_post_ops(InferenceEngine::Precision dst_prc, bool is_broadcast) {
+        const auto &p = attr_.post_ops_;
+        int eltwise_inj_idx = 0;
+        int depthwise_inj_idx = 0;
+        int quantization_inj_idx = 0;
+        for (int i = 0; i < p.len(); i++) {
+            auto& post_op = p.entry_[i];
+            if (post_op.is_eltwise()) {
+                eltwise_injectors[eltwise_inj_idx]->compute_vector_range(vmm_val.getIdx(), vmm_val.getIdx() + 1);
+                eltwise_inj_idx++;
+            } else if (post_op.is_depthwise()) {
+                mov(reg_d_weights, reinterpret_cast<size_t>(post_op.depthwise.weights_data));
+                mov(reg_d_bias, reinterpret_cast<size_t>(post_op.depthwise.biases_data));
+                add(reg_d_weights, reg_oc_off);
+                add(reg_d_bias, reg_oc_off);
+                depthwise_injectors[depthwise_inj_idx]->compute_vector_range(vmm_val.getIdx(), vmm_val.getIdx() + 1, reg_d_weights, reg_d_bias, is_broadcast);
+                depthwise_inj_idx++;
+            } else if (post_op.is_quantization()) {
+                bool do_dequantization = post_op.quantization.alg == alg_kind::quantization_quantize_dequantize;
+                bool do_rounding = do_dequantization || one_of(dst_prc, Precision::FP32, Precision::BF16) || i != p.len() - 1;
+                int s_idx = vmm_val.getIdx();
+
+                quantization_injectors[quantization_inj_idx]->init_crop_ptrs(reg_oc_off);
+                quantization_injectors[quantization_inj_idx]->compute_crop(s_idx, s_idx + 1, 0, 0, is_broadcast);
+
+                quantization_injectors[quantization_inj_idx]->init_input_scale_shift_ptrs(reg_oc_off);
+                quantization_injectors[quantization_inj_idx]->compute_input_scale_shift(s_idx, s_idx + 1, 0, do_rounding, 0, is_broadcast);
+
+                quantization_injectors[quantization_inj_idx]->init_output_scale_shift_ptrs(reg_oc_off);
+                quantization_injectors[quantization_inj_idx]->compute_output_scale_shift(s_idx, s_idx + 1, 0, 0, is_broadcast);
+
+                quantization_inj_idx++;
+            }
         }
     }
 };
 
+std::shared_ptr<jit_uni_softmax_kernel> createSoftmaxKernel(const jit_softmax_config_params &jcp, const mkldnn_primitive_attr &attr) {
+    std::shared_ptr<jit_uni_softmax_kernel> softmax_kernel;
+    if (mayiuse(x64::avx512_common)) {
+        softmax_kernel.reset(new jit_uni_softmax_kernel_f32<x64::avx512_common>(jcp, attr));
+    } else if (mayiuse(x64::avx2)) {
+        softmax_kernel.reset(new jit_uni_softmax_kernel_f32<x64::avx2>(jcp, attr));
+    } else if (mayiuse(x64::sse41)) {
+        softmax_kernel.reset(new jit_uni_softmax_kernel_f32<x64::sse41>(jcp, attr));
+    }
+    if (softmax_kernel)
+        softmax_kernel->create_ker();
+    return softmax_kernel;
+}
+
 SoftmaxGeneric::SoftmaxGeneric(Precision inpPrc, Precision outPrc)
     : input_prec(inpPrc), output_prec(outPrc) {
     if (Precision::BF16 == output_prec) {
@@ -241,18 +362,14 @@ SoftmaxGeneric::SoftmaxGeneric(Precision inpPrc, Precision outPrc)
     jcp.src_dt = inpPrc;
     jcp.dst_dt = outPrc;
 
+    softmax_kernel = createSoftmaxKernel(jcp, *attr.get());
     if (mayiuse(x64::avx512_common)) {
-        softmax_kernel.reset(new jit_uni_softmax_kernel_f32<x64::avx512_common>(jcp));
         block_size = 16;
     } else if (mayiuse(x64::avx2)) {
-        softmax_kernel.reset(new jit_uni_softmax_kernel_f32<x64::avx2>(jcp));
         block_size = 8;
     } else if (mayiuse(x64::sse41)) {
-        softmax_kernel.reset(new jit_uni_softmax_kernel_f32<x64::sse41>(jcp));
         block_size = 4;
     }
-    if (softmax_kernel)
-        softmax_kernel->create_ker();
 }
 
 template<typename in_data_t, typename out_data_t>
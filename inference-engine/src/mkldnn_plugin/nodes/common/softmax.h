@@ -6,11 +6,60 @@
 
 #include <memory>
 #include <cmath>
+#include <cassert>
 #include <ie_precision.hpp>
+#include <mkldnn.hpp>
 #include "defs.h"
 #include "ie_parallel.hpp"
 
-struct jit_uni_softmax_kernel;
+struct jit_softmax_config_params {
+    InferenceEngine::Precision src_dt;
+    InferenceEngine::Precision dst_dt;
+    // vector lanes go along the softmax axis (it has to be dense), max and sum are reduced horizontally;
+    // otherwise lanes go along the inner dimensions and each step of the kernel moves to the next axis element
+    bool along_axis;
+    // along_axis: number of axis elements left after the last full vector,
+    // otherwise: number of processed lanes (0 means full vector)
+    int tail;
+    bool with_scale;
+    float scale;
+    bool with_mask;
+    // all lanes use the same mask element
+    bool broadcast_mask;
+    // post ops channel changes along the softmax axis
+    bool channel_along_axis;
+};
+
+struct jit_args_softmax {
+    const void* src;
+    void* dst;
+    size_t src_stride;
+    size_t dst_stride;
+    size_t work_amount;
+    const float* mask;
+    size_t mask_stride;
+    size_t oc_off;
+};
+
+struct jit_uni_softmax_kernel {
+    void (*ker_)(const jit_args_softmax *);
+
+    void operator()(const jit_args_softmax *args) { assert(ker_); ker_(args); }
+
+    jit_uni_softmax_kernel(jit_softmax_config_params jcp, const mkldnn_primitive_attr &attr) : ker_(nullptr), jcp_(jcp), attr_(attr) {}
+    virtual ~jit_uni_softmax_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_softmax_config_params jcp_;
+    const mkldnn_primitive_attr &attr_;
+};
+
+/**
+ * @brief Creates softmax kernel for the best available ISA.
+ * @return nullptr if the target doesn't support any of the kernel ISAs
+ */
+std::shared_ptr<jit_uni_softmax_kernel> createSoftmaxKernel(const jit_softmax_config_params &jcp, const mkldnn_primitive_attr &attr);
 
 static inline
 void softmax_many_batches(const float *src_data, float *dst_data, int B, int C, int H, int W) {
@@ -48,6 +97,6 @@ private:
 private:
     int block_size;
     InferenceEngine::Precision input_prec, output_prec;
+    mkldnn::primitive_attr attr;
     std::shared_ptr<jit_uni_softmax_kernel> softmax_kernel;
 };
-
@@ -0,0 +1,356 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sparse_fc_kernel.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+#include <mkldnn_types.h>
+#include <ie_parallel.hpp>
+
+#include "cpu/x64/jit_generator.hpp"
+
+using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+using namespace mkldnn;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_args_sparse_fc, field)
+
+template <cpu_isa_t isa>
+struct jit_uni_sparse_fc_kernel_f32 : public jit_uni_sparse_fc_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_sparse_fc_kernel_f32)
+
+    explicit jit_uni_sparse_fc_kernel_f32(jit_sparse_fc_config_params jcp_) : jit_uni_sparse_fc_kernel(jcp_), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_row_ptr, ptr[reg_params + GET_OFF(row_ptr)]);
+        mov(reg_cols, ptr[reg_params + GET_OFF(col_offsets)]);
+        mov(reg_values, ptr[reg_params + GET_OFF(values)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_rows, ptr[reg_params + GET_OFF(rows)]);
+
+        Xbyak::Label row_loop_label;
+        Xbyak::Label row_end_label;
+        Xbyak::Label nz_loop_label;
+        Xbyak::Label nz_end_label;
+
+        L(row_loop_label);
+        {
+            cmp(reg_rows, 0);
+            je(row_end_label, T_NEAR);
+
+            movsxd(reg_nz, dword[reg_row_ptr]);
+            movsxd(reg_nz_end, dword[reg_row_ptr + sizeof(int32_t)]);
+
+            for (int b = 0; b < jcp.m_blocks; b++)
+                uni_vpxor(vmm_acc(b), vmm_acc(b), vmm_acc(b));
+
+            L(nz_loop_label);
+            {
+                cmp(reg_nz, reg_nz_end);
+                jge(nz_end_label, T_NEAR);
+
+                movsxd(reg_src_row, dword[reg_cols + reg_nz * sizeof(int32_t)]);
+                add(reg_src_row, reg_src);
+
+                if (jcp.int8) {
+                    uni_vpbroadcastd(vmm_weight, ptr[reg_values + reg_nz * sizeof(int32_t)]);
+                    for (int b = 0; b < jcp.m_blocks; b++) {
+                        uni_vpmulld(vmm_aux, vmm_weight, ptr[reg_src_row + b * vlen]);
+                        uni_vpaddd(vmm_acc(b), vmm_acc(b), vmm_aux);
+                    }
+                } else {
+                    uni_vbroadcastss(vmm_weight, ptr[reg_values + reg_nz * sizeof(float)]);
+                    for (int b = 0; b < jcp.m_blocks; b++) {
+                        if (isa == cpu::x64::sse41) {
+                            // sse version of the fma clobbers the second operand
+                            uni_vmovups(vmm_aux, vmm_weight);
+                            uni_vfmadd231ps(vmm_acc(b), vmm_aux, ptr[reg_src_row + b * vlen]);
+                        } else {
+                            uni_vfmadd231ps(vmm_acc(b), vmm_weight, ptr[reg_src_row + b * vlen]);
+                        }
+                    }
+                }
+
+                add(reg_nz, 1);
+                jmp(nz_loop_label, T_NEAR);
+            }
+            L(nz_end_label);
+
+            for (int b = 0; b < jcp.m_blocks; b++) {
+                if (jcp.int8)
+                    uni_vcvtdq2ps(vmm_acc(b), vmm_acc(b));
+                uni_vmovups(ptr[reg_dst + b * vlen], vmm_acc(b));
+            }
+
+            add(reg_dst, jcp.m_blocks * vlen);
+            add(reg_row_ptr, sizeof(int32_t));
+            sub(reg_rows, 1);
+            jmp(row_loop_label, T_NEAR);
+        }
+        L(row_end_label);
+
+        this->postamble();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xbyak::Xmm, isa == cpu::x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    uint32_t vlen = cpu_isa_traits<isa>::vlen;
+
+    Vmm vmm_acc(int idx) {
+        return Vmm(idx);
+    }
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_row_ptr = r9;
+    Xbyak::Reg64 reg_cols = r10;
+    Xbyak::Reg64 reg_values = r11;
+    Xbyak::Reg64 reg_dst = r12;
+    Xbyak::Reg64 reg_rows = r13;
+    Xbyak::Reg64 reg_nz = r14;
+    Xbyak::Reg64 reg_nz_end = r15;
+    Xbyak::Reg64 reg_src_row = rax;
+
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_weight = Vmm(14);
+    Vmm vmm_aux = Vmm(15);
+};
+
+namespace {
+
+template <typename T>
+size_t countNonZeros(const T* data, size_t size) {
+    size_t nnz = 0;
+    for (size_t i = 0; i < size; i++)
+        nnz += data[i] != 0;
+    return nnz;
+}
+
+}  // namespace
+
+SparseFCKernel::SparseFCKernel(Precision srcPrc, size_t M, size_t N, size_t K) : srcPrc(srcPrc), M(M), N(N), K(K) {
+    if (!one_of(srcPrc, Precision::FP32, Precision::U8, Precision::I8))
+        IE_THROW() << "SparseFCKernel doesn't support src precision " << srcPrc;
+    int8 = srcPrc != Precision::FP32;
+
+    size_t simd_w = 1;
+    if (mayiuse(cpu::x64::avx512_common)) {
+        simd_w = cpu_isa_traits<cpu::x64::avx512_common>::vlen / sizeof(float);
+    } else if (mayiuse(cpu::x64::avx2)) {
+        simd_w = cpu_isa_traits<cpu::x64::avx2>::vlen / sizeof(float);
+    } else if (mayiuse(cpu::x64::sse41)) {
+        simd_w = cpu_isa_traits<cpu::x64::sse41>::vlen / sizeof(float);
+    }
+
+    // the tile has no sense if it's mostly padding, small number of rows is processed row by row
+    if (simd_w > 1 && M * 2 >= simd_w) {
+        jit_sparse_fc_config_params jcp;
+        jcp.m_blocks = static_cast<int>(std::min<size_t>(4, div_up(M, simd_w)));
+        jcp.int8 = int8;
+
+        if (mayiuse(cpu::x64::avx512_common)) {
+            kernel.reset(new jit_uni_sparse_fc_kernel_f32<cpu::x64::avx512_common>(jcp));
+        } else if (mayiuse(cpu::x64::avx2)) {
+            kernel.reset(new jit_uni_sparse_fc_kernel_f32<cpu::x64::avx2>(jcp));
+        } else {
+            kernel.reset(new jit_uni_sparse_fc_kernel_f32<cpu::x64::sse41>(jcp));
+        }
+        kernel->create_ker();
+
+        tile = jcp.m_blocks * simd_w;
+        const size_t nthr = parallel_get_max_threads();
+        srcScratch.resize(nthr * K * tile);
+        dstScratch.resize(nthr * nBlock * tile);
+    }
+}
+
+float SparseFCKernel::sparsity(const void* weights, Precision prc, size_t size) {
+    if (size == 0)
+        return 0.f;
+    size_t nnz = 0;
+    switch (prc) {
+        case Precision::FP32: nnz = countNonZeros(reinterpret_cast<const float*>(weights), size); break;
+        case Precision::I8: nnz = countNonZeros(reinterpret_cast<const int8_t*>(weights), size); break;
+        default: IE_THROW() << "SparseFCKernel doesn't support weights precision " << prc;
+    }
+    return static_cast<float>(size - nnz) / size;
+}
+
+MKLDNNMemoryPtr SparseFCKernel::packWeights(const void* weights, const mkldnn::engine& eng) const {
+    const auto* weights_f32 = reinterpret_cast<const float*>(weights);
+    const auto* weights_i8 = reinterpret_cast<const int8_t*>(weights);
+    auto isNonZero = [&](size_t i) {
+        return int8 ? weights_i8[i] != 0 : weights_f32[i] != 0.f;
+    };
+
+    size_t nnz = 0;
+    for (size_t i = 0; i < N * K; i++)
+        nnz += isNonZero(i);
+
+    const size_t packedSize = N + 1 + 3 * nnz;
+    MKLDNNMemoryPtr packed = std::make_shared<MKLDNNMemory>(eng);
+    packed->Create(mkldnn::memory::dims{static_cast<mkldnn::memory::dim>(packedSize)},
+                   mkldnn::memory::data_type::s32, mkldnn::memory::format_tag::x);
+
+    // layout in s32 elements: row_ptr[N + 1], cols[nnz], col_offsets[nnz], values[nnz]
+    int32_t* rows = reinterpret_cast<int32_t*>(packed->GetPtr());
+    int32_t* colIdx = rows + N + 1;
+    int32_t* colOff = colIdx + nnz;
+    int32_t* vals = colOff + nnz;
+
+    size_t pos = 0;
+    for (size_t n = 0; n < N; n++) {
+        rows[n] = static_cast<int32_t>(pos);
+        for (size_t k = 0; k < K; k++) {
+            const size_t i = n * K + k;
+            if (!isNonZero(i))
+                continue;
+            colIdx[pos] = static_cast<int32_t>(k);
+            colOff[pos] = static_cast<int32_t>(k * tile * sizeof(float));
+            if (int8) {
+                vals[pos] = weights_i8[i];
+            } else {
+                std::memcpy(&vals[pos], &weights_f32[i], sizeof(float));
+            }
+            pos++;
+        }
+    }
+    rows[N] = static_cast<int32_t>(pos);
+
+    return packed;
+}
+
+void SparseFCKernel::setPackedWeights(MKLDNNMemoryPtr packed) {
+    packedWeights = packed;
+    rowPtr = reinterpret_cast<const int32_t*>(packedWeights->GetPtr());
+    const size_t nnz = rowPtr[N];
+    cols = rowPtr + N + 1;
+    colOffsets = cols + nnz;
+    values = colOffsets + nnz;
+}
+
+void SparseFCKernel::execute(const uint8_t* src, const float* bias, float* dst) {
+    if (!packedWeights)
+        IE_THROW() << "SparseFCKernel weights are not set";
+
+    if (kernel)
+        executeTiles(src, bias, dst);
+    else
+        executeRows(src, bias, dst);
+}
+
+void SparseFCKernel::transposeTile(const uint8_t* src, size_t m0, void* scratch) const {
+    const size_t rows = std::min(tile, M - m0);
+    if (!int8) {
+        const auto* src_f32 = reinterpret_cast<const float*>(src) + m0 * K;
+        auto* tile_f32 = reinterpret_cast<float*>(scratch);
+        for (size_t m = 0; m < rows; m++)
+            for (size_t k = 0; k < K; k++)
+                tile_f32[k * tile + m] = src_f32[m * K + k];
+        for (size_t m = rows; m < tile; m++)
+            for (size_t k = 0; k < K; k++)
+                tile_f32[k * tile + m] = 0.f;
+    } else {
+        auto* tile_s32 = reinterpret_cast<int32_t*>(scratch);
+        for (size_t m = 0; m < rows; m++) {
+            for (size_t k = 0; k < K; k++) {
+                const size_t i = (m0 + m) * K + k;
+                tile_s32[k * tile + m] = srcPrc == Precision::U8 ? static_cast<int32_t>(src[i])
+                                                                 : static_cast<int32_t>(reinterpret_cast<const int8_t*>(src)[i]);
+            }
+        }
+        for (size_t m = rows; m < tile; m++)
+            for (size_t k = 0; k < K; k++)
+                tile_s32[k * tile + m] = 0;
+    }
+}
+
+void SparseFCKernel::executeTiles(const uint8_t* src, const float* bias, float* dst) {
+    const size_t mTiles = div_up(M, tile);
+    const size_t nBlocks = div_up(N, nBlock);
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(mTiles * nBlocks, nthr, ithr, start, end);
+
+        int32_t* srcTile = &srcScratch[ithr * K * tile];
+        float* dstTile = &dstScratch[ithr * nBlock * tile];
+        // consecutive work items of the thread share the src tile
+        size_t transposedTile = mTiles;
+
+        for (size_t iwork = start; iwork < end; iwork++) {
+            const size_t mt = iwork / nBlocks;
+            const size_t nb = iwork % nBlocks;
+            if (mt != transposedTile) {
+                transposeTile(src, mt * tile, srcTile);
+                transposedTile = mt;
+            }
+
+            const size_t n0 = nb * nBlock;
+            const size_t rows = std::min(nBlock, N - n0);
+
+            jit_args_sparse_fc args;
+            args.src = srcTile;
+            args.row_ptr = rowPtr + n0;
+            args.col_offsets = colOffsets;
+            args.values = values;
+            args.dst = dstTile;
+            args.rows = rows;
+            (*kernel)(&args);
+
+            const size_t m0 = mt * tile;
+            const size_t mRows = std::min(tile, M - m0);
+            for (size_t m = 0; m < mRows; m++) {
+                float* dstRow = dst + (m0 + m) * N + n0;
+                for (size_t r = 0; r < rows; r++)
+                    dstRow[r] = dstTile[r * tile + m] + (bias ? bias[n0 + r] : 0.f);
+            }
+        }
+    });
+}
+
+void SparseFCKernel::executeRows(const uint8_t* src, const float* bias, float* dst) const {
+    parallel_for(N, [&](size_t n) {
+        const int32_t begin = rowPtr[n];
+        const int32_t end = rowPtr[n + 1];
+        const float b = bias ? bias[n] : 0.f;
+        for (size_t m = 0; m < M; m++) {
+            if (!int8) {
+                const auto* srcRow = reinterpret_cast<const float*>(src) + m * K;
+                const auto* vals = reinterpret_cast<const float*>(values);
+                float acc = 0.f;
+                for (int32_t j = begin; j < end; j++)
+                    acc += vals[j] * srcRow[cols[j]];
+                dst[m * N + n] = acc + b;
+            } else {
+                const auto* vals = reinterpret_cast<const int32_t*>(values);
+                int32_t acc = 0;
+                if (srcPrc == Precision::U8) {
+                    const uint8_t* srcRow = src + m * K;
+                    for (int32_t j = begin; j < end; j++)
+                        acc += vals[j] * static_cast<int32_t>(srcRow[cols[j]]);
+                } else {
+                    const auto* srcRow = reinterpret_cast<const int8_t*>(src) + m * K;
+                    for (int32_t j = begin; j < end; j++)
+                        acc += vals[j] * static_cast<int32_t>(srcRow[cols[j]]);
+                }
+                dst[m * N + n] = static_cast<float>(acc) + b;
+            }
+        }
+    });
+}
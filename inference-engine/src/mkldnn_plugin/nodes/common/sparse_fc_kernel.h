@@ -0,0 +1,100 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <ie_precision.hpp>
+#include <mkldnn_memory.h>
+#include <memory>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+struct jit_sparse_fc_config_params {
+    int m_blocks;   // number of vectors in the src tile row
+    bool int8;      // s32 src tile and values, the result is converted to f32
+};
+
+struct jit_args_sparse_fc {
+    const void* src;              // transposed src tile: K x tile elements
+    const int32_t* row_ptr;       // rows + 1 indices of the first nonzero of each row
+    const int32_t* col_offsets;   // byte offsets of the src tile rows for each nonzero
+    const void* values;           // nonzero values
+    float* dst;                   // rows x tile results
+    size_t rows;
+};
+
+struct jit_uni_sparse_fc_kernel {
+    void (*ker_)(const jit_args_sparse_fc *);
+
+    void operator()(const jit_args_sparse_fc *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_sparse_fc_kernel(jit_sparse_fc_config_params jcp_) : ker_(nullptr), jcp(jcp_) {}
+    virtual ~jit_uni_sparse_fc_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_sparse_fc_config_params jcp;
+};
+
+/**
+ * @brief FullyConnected with the sparse weights: dst[M, N] = src[M, K] * W[N, K]^T + bias.
+ *
+ * Weights are packed into the compressed sparse row format (nonzero values of each output channel with their input
+ * channel indices). The src is processed by tiles of rows which are transposed to K x tile scratch, so the kernel
+ * multiplies each nonzero weight by the contiguous vector of the tile. FP32 and INT8 (u8/s8 src with s8 weights,
+ * s32 accumulation) are supported, the result is FP32.
+ */
+class SparseFCKernel {
+public:
+    SparseFCKernel(InferenceEngine::Precision srcPrc, size_t M, size_t N, size_t K);
+
+    /**
+     * @brief Fraction of zero values
+     * @param weights f32 or s8 values
+     */
+    static float sparsity(const void* weights, InferenceEngine::Precision prc, size_t size);
+
+    /**
+     * @brief Packs N x K dense weights, the packed weights depend on the tile size so the result is cached by it
+     */
+    MKLDNNMemoryPtr packWeights(const void* weights, const mkldnn::engine& eng) const;
+    void setPackedWeights(MKLDNNMemoryPtr packed);
+
+    size_t getTileSize() const {
+        return tile;
+    }
+
+    void execute(const uint8_t* src, const float* bias, float* dst);
+
+private:
+    void executeTiles(const uint8_t* src, const float* bias, float* dst);
+    void executeRows(const uint8_t* src, const float* bias, float* dst) const;
+
+    void transposeTile(const uint8_t* src, size_t m0, void* scratch) const;
+
+    InferenceEngine::Precision srcPrc;
+    bool int8;
+    size_t M, N, K;
+    size_t tile = 1;
+    // output channels computed by the single kernel call
+    size_t nBlock = 64;
+
+    MKLDNNMemoryPtr packedWeights;
+    const int32_t* rowPtr = nullptr;
+    const int32_t* cols = nullptr;
+    const int32_t* colOffsets = nullptr;
+    const void* values = nullptr;
+
+    std::vector<int32_t> srcScratch;
+    std::vector<float> dstScratch;
+
+    std::shared_ptr<jit_uni_sparse_fc_kernel> kernel;
+};
+
+}  // namespace MKLDNNPlugin
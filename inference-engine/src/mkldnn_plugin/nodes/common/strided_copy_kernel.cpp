@@ -0,0 +1,383 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "strided_copy_kernel.h"
+
+#include <vector>
+#include <numeric>
+#include <mkldnn_types.h>
+#include <ie_parallel.hpp>
+#include "cpu_memcpy.h"
+
+#include "cpu/x64/jit_generator.hpp"
+
+using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+using namespace mkldnn;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_args_strided_copy, field)
+
+template <cpu_isa_t isa>
+struct jit_uni_strided_copy_kernel_f32 : public jit_uni_strided_copy_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_strided_copy_kernel_f32)
+
+    explicit jit_uni_strided_copy_kernel_f32(jit_strided_copy_config_params jcp_) : jit_uni_strided_copy_kernel(jcp_), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+
+        loop(0);
+
+        this->postamble();
+    }
+
+    void load(const Xbyak::Xmm &xmm, const Xbyak::Address &addr) {
+        switch (jcp.data_size) {
+            case 8: movsd(xmm, addr); break;
+            case 4: movss(xmm, addr); break;
+            case 2: pinsrw(xmm, addr, 0x0); break;
+            case 1: pinsrb(xmm, addr, 0x0); break;
+        }
+    }
+
+    void store(const Xbyak::Address &addr, const Xbyak::Xmm &xmm) {
+        switch (jcp.data_size) {
+            case 8: movsd(addr, xmm); break;
+            case 4: movss(addr, xmm); break;
+            case 2: pextrw(addr, xmm, 0x0); break;
+            case 1: pextrb(addr, xmm, 0x0); break;
+        }
+    }
+
+    void loop(size_t n) {
+        const size_t ndims = jcp.dims.size();
+        mov(reg_work_amount, jcp.dims[n]);
+
+        Xbyak::Label main_loop_label;
+        Xbyak::Label tail_loop_label;
+        Xbyak::Label exit_label;
+
+        if (n + 1 == ndims && jcp.dst_strides[n] == 1) {
+            // contiguous copy or broadcast of the scalar
+            const bool is_copy = jcp.src_strides[n] == 1;
+            const bool is_broadcast = jcp.src_strides[n] == 0 && jcp.data_size == sizeof(float);
+            if (is_copy || is_broadcast) {
+                const uint32_t step = vlen / jcp.data_size;
+                if (is_broadcast)
+                    uni_vbroadcastss(vmm, ptr[reg_src]);
+
+                L(main_loop_label);
+                {
+                    cmp(reg_work_amount, step);
+                    jl(tail_loop_label, T_NEAR);
+
+                    if (is_copy) {
+                        uni_vmovups(vmm, ptr[reg_src]);
+                        add(reg_src, vlen);
+                    }
+                    uni_vmovups(ptr[reg_dst], vmm);
+
+                    add(reg_dst, vlen);
+                    sub(reg_work_amount, step);
+
+                    jmp(main_loop_label, T_NEAR);
+                }
+            }
+        }
+
+        L(tail_loop_label); {
+            cmp(reg_work_amount, 0);
+            je(exit_label, T_NEAR);
+
+            if (n + 1 == ndims) {
+                load(xmm, ptr[reg_src]);
+                store(ptr[reg_dst], xmm);
+            } else {
+                push(reg_src);
+                push(reg_dst);
+                push(reg_work_amount);
+                loop(n + 1);
+                pop(reg_work_amount);
+                pop(reg_dst);
+                pop(reg_src);
+            }
+
+            if (jcp.src_strides[n] != 0)
+                add(reg_src, jcp.src_strides[n] * jcp.data_size);
+            add(reg_dst, jcp.dst_strides[n] * jcp.data_size);
+            sub(reg_work_amount, 1);
+
+            jmp(tail_loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xbyak::Xmm, isa == cpu::x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    uint32_t vlen = cpu_isa_traits<isa>::vlen;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_work_amount = r10;
+
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm = Vmm(1);
+    Xbyak::Xmm xmm = Xbyak::Xmm(1);
+};
+
+StridedCopyKernel::StridedCopyKernel(const StridedCopyParams& params) {
+    prepareParams(params);
+}
+
+StridedCopyParams StridedCopyKernel::broadcastParams(const BlockingDesc& src_blk, const BlockingDesc& dst_blk, size_t data_size) {
+    const auto& dst_block_dims = dst_blk.getBlockDims();
+    SizeVector src_block_dims = src_blk.getBlockDims();
+    SizeVector src_block_strides = src_blk.getStrides();
+    SizeVector src_order = src_blk.getOrder();
+
+    if (src_block_dims.size() > dst_block_dims.size())
+        IE_THROW() << "Broadcast is not applicable: src rank is greater than dst rank";
+
+    const size_t prefix = dst_block_dims.size() - src_block_dims.size();
+    if (prefix != 0) {
+        for (size_t i = 0; i < src_order.size(); i++) {
+            if (src_order[i] != i)
+                IE_THROW() << "Broadcast is not applicable: src with smaller rank must have planar layout";
+        }
+        src_block_dims.insert(src_block_dims.begin(), prefix, 1);
+        src_block_strides.insert(src_block_strides.begin(), prefix, 0);
+    } else if (src_order != dst_blk.getOrder()) {
+        IE_THROW() << "Broadcast is not applicable: src and dst have different layouts";
+    }
+
+    StridedCopyParams params;
+    params.dims = dst_block_dims;
+    params.dst_strides = dst_blk.getStrides();
+    params.src_strides.resize(dst_block_dims.size());
+    params.data_size = data_size;
+    for (size_t i = 0; i < dst_block_dims.size(); i++) {
+        if (src_block_dims[i] == dst_block_dims[i]) {
+            params.src_strides[i] = src_block_strides[i];
+        } else if (src_block_dims[i] == 1) {
+            params.src_strides[i] = 0;
+        } else {
+            IE_THROW() << "Broadcast is not applicable: src block dim " << src_block_dims[i]
+                       << " is not compatible with dst block dim " << dst_block_dims[i];
+        }
+    }
+    return params;
+}
+
+void StridedCopyKernel::prepareParams(const StridedCopyParams& params) {
+    if (params.dims.size() != params.src_strides.size() || params.dims.size() != params.dst_strides.size())
+        IE_THROW() << "StridedCopyKernel has inconsistent dims and strides";
+
+    data_size = params.data_size;
+
+    // drop unit dims and glue the neighbouring ones which are dense for both src and dst
+    for (size_t i = 0; i < params.dims.size(); i++) {
+        if (params.dims[i] == 1)
+            continue;
+        if (!dims.empty() &&
+            src_strides.back() == params.src_strides[i] * params.dims[i] &&
+            dst_strides.back() == params.dst_strides[i] * params.dims[i]) {
+            dims.back() *= params.dims[i];
+            src_strides.back() = params.src_strides[i];
+            dst_strides.back() = params.dst_strides[i];
+            if (batch_idx == static_cast<int>(dims.size()) - 1)
+                batch_factor *= params.dims[i];
+        } else {
+            if (i == 0)
+                batch_idx = 0;
+            dims.push_back(params.dims[i]);
+            src_strides.push_back(params.src_strides[i]);
+            dst_strides.push_back(params.dst_strides[i]);
+        }
+    }
+    if (dims.empty()) {
+        dims.push_back(1);
+        src_strides.push_back(1);
+        dst_strides.push_back(1);
+    }
+
+    // long rows are split into the chunks if there is not enough outer work for all threads
+    const size_t max_threads = parallel_get_max_threads();
+    const size_t min_chunk_size = 4096;
+    const size_t outer_work = std::accumulate(dims.begin(), dims.end() - 1, size_t(1), std::multiplies<size_t>());
+    if (outer_work < max_threads && dims.back() * data_size >= 2 * min_chunk_size) {
+        const size_t row = dims.back();
+        const bool is_batch_row = batch_idx == static_cast<int>(dims.size()) - 1;
+        const size_t batch = is_batch_row ? row / batch_factor : 1;
+        for (size_t parts = div_up(max_threads, outer_work); row / parts * data_size >= min_chunk_size; parts++) {
+            if (row % parts != 0 || parts % batch != 0)
+                continue;
+            const size_t chunk = row / parts;
+            dims.back() = parts;
+            dims.push_back(chunk);
+            src_strides.push_back(src_strides.back());
+            dst_strides.push_back(dst_strides.back());
+            src_strides[src_strides.size() - 2] *= chunk;
+            dst_strides[dst_strides.size() - 2] *= chunk;
+            if (is_batch_row)
+                batch_factor = parts / batch;
+            break;
+        }
+    }
+
+    // short rows are processed by the kernel together with the next outer dimension to reduce the calls overhead
+    const size_t min_row_size = 256;
+    size_t kernel_ndims = 1;
+    if (dims.size() > 1 && dims.back() * data_size < min_row_size)
+        kernel_ndims = 2;
+    outer_ndims = dims.size() - kernel_ndims;
+
+    jcp.dims = SizeVector(dims.begin() + outer_ndims, dims.end());
+    jcp.src_strides = SizeVector(src_strides.begin() + outer_ndims, src_strides.end());
+    jcp.dst_strides = SizeVector(dst_strides.begin() + outer_ndims, dst_strides.end());
+    jcp.data_size = data_size;
+
+    const bool is_supported_data_size = data_size == 1 || data_size == 2 || data_size == 4 || data_size == 8;
+    // the batch dimension is processed inside the kernel, so it can't be changed in runtime
+    const bool is_batch_outer = batch_idx < static_cast<int>(outer_ndims);
+    if (is_supported_data_size && is_batch_outer) {
+        if (mayiuse(cpu::x64::avx512_common)) {
+            copy_kernel.reset(new jit_uni_strided_copy_kernel_f32<cpu::x64::avx512_common>(jcp));
+        } else if (mayiuse(cpu::x64::avx2)) {
+            copy_kernel.reset(new jit_uni_strided_copy_kernel_f32<cpu::x64::avx2>(jcp));
+        } else if (mayiuse(cpu::x64::sse41)) {
+            copy_kernel.reset(new jit_uni_strided_copy_kernel_f32<cpu::x64::sse41>(jcp));
+        }
+    }
+
+    if (copy_kernel)
+        copy_kernel->create_ker();
+}
+
+void StridedCopyKernel::execute(const uint8_t* src_data, uint8_t* dst_data) const {
+    if (copy_kernel) {
+        optimizedExecute(src_data, dst_data, dims);
+        return;
+    }
+
+    referenceExecute(src_data, dst_data, dims);
+}
+
+void StridedCopyKernel::execute(const uint8_t* src_data, uint8_t* dst_data, const int mb) const {
+    SizeVector batch_dims = dims;
+    if (batch_idx >= 0)
+        batch_dims[batch_idx] = mb * batch_factor;
+
+    if (copy_kernel) {
+        optimizedExecute(src_data, dst_data, batch_dims);
+        return;
+    }
+
+    referenceExecute(src_data, dst_data, batch_dims);
+}
+
+static inline void parallel_init(size_t start, size_t nDims, const SizeVector& dims, SizeVector& indexes) {
+    for (int j = nDims - 1; j >= 0; j--) {
+        indexes[j] = start % dims[j];
+        start = start / dims[j];
+    }
+}
+
+static inline void parallel_step(size_t nDims, const SizeVector& dims, SizeVector& indexes) {
+    for (int j = nDims - 1; j >= 0; --j) {
+        ++indexes[j];
+        if (indexes[j] < dims[j])
+            break;
+        else
+            indexes[j] = 0;
+    }
+}
+
+static inline size_t get_offset(size_t nDims, const SizeVector& indexes, const SizeVector& strides) {
+    size_t offset = 0;
+    for (size_t i = 0; i < nDims; ++i)
+        offset += indexes[i] * strides[i];
+    return offset;
+}
+
+void StridedCopyKernel::optimizedExecute(const uint8_t* src_data, uint8_t* dst_data, const SizeVector& dims) const {
+    const size_t work_amount = std::accumulate(dims.begin(), dims.begin() + outer_ndims, size_t(1), std::multiplies<size_t>());
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(work_amount, nthr, ithr, start, end);
+        SizeVector indexes(outer_ndims, 0);
+        parallel_init(start, outer_ndims, dims, indexes);
+
+        for (size_t iwork = start; iwork < end; ++iwork) {
+            auto arg = jit_args_strided_copy();
+            arg.src = &src_data[get_offset(outer_ndims, indexes, src_strides) * data_size];
+            arg.dst = &dst_data[get_offset(outer_ndims, indexes, dst_strides) * data_size];
+
+            (*copy_kernel)(&arg);
+
+            parallel_step(outer_ndims, dims, indexes);
+        }
+    });
+}
+
+template <typename T>
+static void copy_row(const uint8_t* src, uint8_t* dst, size_t count, size_t src_stride, size_t dst_stride) {
+    const T* src_ptr = reinterpret_cast<const T*>(src);
+    T* dst_ptr = reinterpret_cast<T*>(dst);
+    for (size_t i = 0; i < count; i++)
+        dst_ptr[i * dst_stride] = src_ptr[i * src_stride];
+}
+
+void StridedCopyKernel::referenceExecute(const uint8_t* src_data, uint8_t* dst_data, const SizeVector& dims) const {
+    const size_t ndims = dims.size();
+    const size_t row_ndims = ndims - 1;
+    const size_t row_size = dims.back();
+    const size_t row_src_stride = src_strides.back();
+    const size_t row_dst_stride = dst_strides.back();
+    const bool is_dense_row = row_src_stride == 1 && row_dst_stride == 1;
+
+    const size_t work_amount = std::accumulate(dims.begin(), dims.end() - 1, size_t(1), std::multiplies<size_t>());
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(work_amount, nthr, ithr, start, end);
+        SizeVector indexes(row_ndims, 0);
+        parallel_init(start, row_ndims, dims, indexes);
+
+        for (size_t iwork = start; iwork < end; ++iwork) {
+            const uint8_t* src = &src_data[get_offset(row_ndims, indexes, src_strides) * data_size];
+            uint8_t* dst = &dst_data[get_offset(row_ndims, indexes, dst_strides) * data_size];
+
+            if (is_dense_row) {
+                cpu_memcpy(dst, src, row_size * data_size);
+            } else {
+                switch (data_size) {
+                    case 8: copy_row<uint64_t>(src, dst, row_size, row_src_stride, row_dst_stride); break;
+                    case 4: copy_row<uint32_t>(src, dst, row_size, row_src_stride, row_dst_stride); break;
+                    case 2: copy_row<uint16_t>(src, dst, row_size, row_src_stride, row_dst_stride); break;
+                    case 1: copy_row<uint8_t>(src, dst, row_size, row_src_stride, row_dst_stride); break;
+                    default:
+                        for (size_t i = 0; i < row_size; i++)
+                            cpu_memcpy(dst + i * row_dst_stride * data_size, src + i * row_src_stride * data_size, data_size);
+                }
+            }
+
+            parallel_step(row_ndims, dims, indexes);
+        }
+    });
+}
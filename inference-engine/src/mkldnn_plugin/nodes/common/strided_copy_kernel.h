@@ -0,0 +1,92 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <memory>
+
+namespace MKLDNNPlugin {
+
+/**
+ * N-D copy: dst[i0, i1, ...] = src[i0, i1, ...] where offsets are computed with the own strides of src and dst.
+ * Zero src stride broadcasts the data along this dimension. Dims and strides are given in elements and may be
+ * the blocked ones, so the kernel is applicable to any blocked layout directly.
+ */
+struct StridedCopyParams {
+    InferenceEngine::SizeVector dims;
+    InferenceEngine::SizeVector src_strides;
+    InferenceEngine::SizeVector dst_strides;
+    size_t data_size;
+};
+
+struct jit_strided_copy_config_params {
+    InferenceEngine::SizeVector dims;
+    InferenceEngine::SizeVector src_strides;
+    InferenceEngine::SizeVector dst_strides;
+    int data_size;
+};
+
+struct jit_args_strided_copy {
+    const void* src;
+    const void* dst;
+};
+
+struct jit_uni_strided_copy_kernel {
+    void (*ker_)(const jit_args_strided_copy *);
+
+    void operator()(const jit_args_strided_copy *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_strided_copy_kernel(jit_strided_copy_config_params jcp_) : ker_(nullptr), jcp(jcp_) {}
+    virtual ~jit_uni_strided_copy_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_strided_copy_config_params jcp;
+};
+
+class StridedCopyKernel {
+public:
+    StridedCopyKernel(const StridedCopyParams& params);
+
+    void execute(const uint8_t* src_data, uint8_t* dst_data) const;
+    /**
+     * @param mb batch to process, the batch is assumed to be the outermost dimension of the params.dims
+     */
+    void execute(const uint8_t* src_data, uint8_t* dst_data, const int mb) const;
+
+    /**
+     * @brief Creates params for the numpy broadcast of the src to the dst
+     * The src and the dst must have the same blocking order, except the case of the planar src with smaller rank.
+     * Each src block dim must be either equal to the corresponding dst block dim or be 1.
+     */
+    static StridedCopyParams broadcastParams(const InferenceEngine::BlockingDesc& src_blk, const InferenceEngine::BlockingDesc& dst_blk,
+                                             size_t data_size);
+
+private:
+    void prepareParams(const StridedCopyParams& params);
+
+    void optimizedExecute(const uint8_t* src_data, uint8_t* dst_data, const InferenceEngine::SizeVector& dims) const;
+    void referenceExecute(const uint8_t* src_data, uint8_t* dst_data, const InferenceEngine::SizeVector& dims) const;
+
+    // collapsed iteration space: dims[0, outer_ndims) are split between threads, the rest is processed by the kernel
+    InferenceEngine::SizeVector dims;
+    InferenceEngine::SizeVector src_strides;
+    InferenceEngine::SizeVector dst_strides;
+    size_t data_size = 0;
+    size_t outer_ndims = 0;
+
+    // position of the original outermost dimension in the collapsed dims and the size merged into it
+    int batch_idx = -1;
+    size_t batch_factor = 1;
+
+    jit_strided_copy_config_params jcp = {};
+    std::shared_ptr<jit_uni_strided_copy_kernel> copy_kernel;
+};
+
+}  // namespace MKLDNNPlugin
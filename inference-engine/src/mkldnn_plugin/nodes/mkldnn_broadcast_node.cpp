@@ -12,7 +12,7 @@
 #include "mkldnn_broadcast_node.h"
 #include <nodes/common/tensor_desc_creator.h>
 #include <ngraph/opsets/opset1.hpp>
-#include "common/cpu_memcpy.h"
+#include "common/strided_copy_kernel.h"
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
@@ -64,66 +64,45 @@ void MKLDNNBroadcastNode::initSupportedPrimitiveDescriptors() {
                           {TensorDescCreatorTypes::ncsp, Precision::I32}},
                          {{TensorDescCreatorTypes::ncsp, prec}},
                          impl_desc_type::ref_any);
+
+    // channels last and blocked layouts are applicable only if the channels aren't broadcasted
+    const auto& srcDims = getParentEdgeAt(BROADCAST_INPUT)->getDims().ToSizeVector();
+    const auto& dstDims = getChildEdgeAt(0)->getDims().ToSizeVector();
+    if (srcDims.size() == dstDims.size() && srcDims.size() > 2 && srcDims[1] == dstDims[1]) {
+        for (auto type : {TensorDescCreatorTypes::nspc, TensorDescCreatorTypes::nCsp8c, TensorDescCreatorTypes::nCsp16c}) {
+            addSupportedPrimDesc({{type, prec},
+                                  {TensorDescCreatorTypes::ncsp, Precision::I32}},
+                                 {{type, prec}},
+                                 impl_desc_type::ref_any);
+        }
+    }
 }
 
-void MKLDNNBroadcastNode::execute(mkldnn::stream strm) {
+void MKLDNNBroadcastNode::createPrimitive() {
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        IE_THROW() << errorPrefix << " has nullable preferable primitive descriptor";
+
     size_t shape_size = (getParentEdgeAt(BROADCAST_SHAPE)->getDesc().getDims())[0];
-    SizeVector dst_dims = getChildEdgeAt(0)->getDesc().getDims();
-    SizeVector src_dims = getParentEdgeAt(BROADCAST_INPUT)->getDesc().getDims();
-    SizeVector srcStrides = getParentEdgeAt(BROADCAST_INPUT)->getDesc().getBlockingDesc().getStrides();
-    size_t data_size = getParentEdgeAt(BROADCAST_INPUT)->getDesc().getPrecision().size();
-
-    if (!src_dims.size())
-        src_dims = SizeVector(1, 1);
-    if (!srcStrides.size())
-        srcStrides = SizeVector(1, 1);
-
-    if (dst_dims.size() != shape_size) {
-        IE_THROW() << "Output tensor dimension mismatch";
-    }
+    const auto& srcDesc = getParentEdgeAt(BROADCAST_INPUT)->getDesc();
+    const auto& dstDesc = getChildEdgeAt(0)->getDesc();
 
-    if (src_dims.size() > dst_dims.size()) {
-        IE_THROW() << "Output tensor dimension is smaller then input tensor dimension";
+    if (dstDesc.getDims().size() != shape_size) {
+        IE_THROW() << errorPrefix << " has output tensor dimension mismatch";
     }
 
-    InferenceEngine::SizeVector dstStrides = getChildEdgeAt(0)->getDesc().getBlockingDesc().getStrides();
-    InferenceEngine::SizeVector src_aligned(dst_dims.size());
-    InferenceEngine::SizeVector srcStrides_aligned(dst_dims.size());
-    size_t prefix_size = dst_dims.size() - src_dims.size();
-    for (size_t i = 0; i < dst_dims.size(); i++) {
-        if (i < prefix_size) {
-            src_aligned[i] = 1;
-            srcStrides_aligned[i] = srcStrides[0];
-        } else {
-            src_aligned[i] = src_dims[i - prefix_size];
-            srcStrides_aligned[i] = srcStrides[i - prefix_size];
-        }
+    if (srcDesc.getDims().size() > dstDesc.getDims().size()) {
+        IE_THROW() << errorPrefix << " has output tensor dimension smaller then input tensor dimension";
     }
 
-    size_t work_amount_dst = dstStrides[0] * dst_dims[0];
+    auto params = StridedCopyKernel::broadcastParams(srcDesc.getBlockingDesc(), dstDesc.getBlockingDesc(), srcDesc.getPrecision().size());
+    copyKernel = std::unique_ptr<StridedCopyKernel>(new StridedCopyKernel(params));
+}
+
+void MKLDNNBroadcastNode::execute(mkldnn::stream strm) {
     const auto *src_data = reinterpret_cast<const uint8_t *>(getParentEdgeAt(BROADCAST_INPUT)->getMemoryPtr()->GetPtr());
     auto *dst_data = reinterpret_cast<uint8_t *>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
 
-    parallel_nt(0, [&](const int ithr, const int nthr) {
-        size_t i, src_idx, start = 0, end = 0;
-        SizeVector counters(dst_dims.size(), 0);
-        splitter(work_amount_dst, nthr, ithr, start, end);
-        for (int j = dst_dims.size() - 1, i = start; j >= 0; j--) {
-            counters[j] = i % dst_dims[j];
-            i /= dst_dims[j];
-        }
-        for (size_t iwork = start * data_size; iwork < end * data_size; iwork += data_size) {
-            for (i = 0, src_idx = 0; i < dst_dims.size(); ++i)
-                src_idx += counters[i] ? ((counters[i] % src_aligned[i]) * srcStrides_aligned[i]) : 0;
-
-            cpu_memcpy(&dst_data[iwork], &src_data[src_idx * data_size], data_size);
-
-            for (int j = dst_dims.size() - 1; j >= 0; j--) {
-                counters[j] = (counters[j] + 1) % dst_dims[j];
-                if (counters[j] != 0) break;
-            }
-        }
-    });
+    copyKernel->execute(src_data, dst_data);
 }
 
 bool MKLDNNBroadcastNode::created() const {
@@ -9,6 +9,7 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include "common/strided_copy_kernel.h"
 
 namespace MKLDNNPlugin {
 
@@ -18,7 +19,7 @@ public:
 
     void getSupportedDescriptors() override {};
     void initSupportedPrimitiveDescriptors() override;
-    void createPrimitive() override {};
+    void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
 
@@ -29,6 +30,8 @@ private:
     static const size_t BROADCAST_SHAPE = 1;
 
     std::string errorPrefix;
+
+    std::unique_ptr<StridedCopyKernel> copyKernel;
 };
 
 }  // namespace MKLDNNPlugin
@@ -121,7 +121,9 @@ void MKLDNNConvertNode::execute(mkldnn::stream strm) {
 
     void* srcPtr = parentMem.GetPtr();
     void* dstPtr = childMem.GetPtr();
-    cpu_convert(srcPtr, dstPtr, getParentEdgeAt(0)->getDesc().getPrecision(), getChildEdgeAt(0)->getDesc().getPrecision(), parentMem.GetElementsCount());
+    const int maxBatch = getMaxBatch();
+    const size_t size = maxBatch > 0 ? parentMem.GetElementsCount() / maxBatch * batchToProcess() : parentMem.GetElementsCount();
+    cpu_convert(srcPtr, dstPtr, getParentEdgeAt(0)->getDesc().getPrecision(), getChildEdgeAt(0)->getDesc().getPrecision(), size);
 }
 
 bool MKLDNNConvertNode::created() const {
@@ -9,6 +9,7 @@
 #include <ngraph/op/detection_output.hpp>
 #include "ie_parallel.hpp"
 #include "mkldnn_detection_output_node.h"
+#include "utils/general_utils.h"
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
@@ -107,6 +108,8 @@ MKLDNNDetectionOutputNode::MKLDNNDetectionOutputNode(const std::shared_ptr<ngrap
     _detections_count.resize(_num * _num_classes);
     _bbox_sizes.resize(_num * _num_classes * _num_priors);
     _num_priors_actual.resize(_num);
+    _kept_bboxes.resize(_num_classes * _num_priors * 5);
+    _mx_candidates.resize(_num_priors);
 
     const auto &confSize = op->get_input_shape(idx_confidence);
     _reordered_conf.resize(std::accumulate(confSize.begin(), confSize.end(), 1, std::multiplies<size_t>()));
@@ -146,6 +149,7 @@ void MKLDNNDetectionOutputNode::execute(mkldnn::stream strm) {
     int *buffer_data           = _buffer.data();
     int *indices_data          = _indices.data();
     int *num_priors_actual     = _num_priors_actual.data();
+    float *kept_bboxes_data    = _kept_bboxes.data();
 
     for (int n = 0; n < N; ++n) {
         const float *ppriors = prior_data;
@@ -234,7 +238,8 @@ void MKLDNNDetectionOutputNode::execute(mkldnn::stream strm) {
                         psizes = bbox_sizes_data + n*_num_classes*_num_priors + c*_num_priors;
                     }
 
-                    nms_cf(pconf, pboxes, psizes, pbuffer, pindices, *pdetections, num_priors_actual[n]);
+                    nms_cf(pconf, pboxes, psizes, pbuffer, pindices, *pdetections, num_priors_actual[n],
+                           kept_bboxes_data + c*5*_num_priors);
                 }
             });
         } else {
@@ -247,7 +252,7 @@ void MKLDNNDetectionOutputNode::execute(mkldnn::stream strm) {
             const float *pboxes = decoded_bboxes_data + n*4*_num_loc_classes*_num_priors;
             const float *psizes = bbox_sizes_data + n*_num_loc_classes*_num_priors;
 
-            nms_mx(pconf, pboxes, psizes, pbuffer, pindices, pdetections, _num_priors);
+            nms_mx(pconf, pboxes, psizes, pbuffer, pindices, pdetections, _num_priors, kept_bboxes_data);
         }
 
         for (int c = 0; c < _num_classes; ++c) {
@@ -255,7 +260,8 @@ void MKLDNNDetectionOutputNode::execute(mkldnn::stream strm) {
         }
 
         if (_keep_top_k > -1 && detections_total > _keep_top_k) {
-            std::vector<std::pair<float, std::pair<int, int>>> conf_index_class_map;
+            auto &conf_index_class_map = _conf_index_class_map;
+            conf_index_class_map.clear();
 
             for (int c = 0; c < _num_classes; ++c) {
                 int detections = detections_data[n*_num_classes + c];
@@ -269,8 +275,9 @@ void MKLDNNDetectionOutputNode::execute(mkldnn::stream strm) {
                 }
             }
 
-            std::sort(conf_index_class_map.begin(), conf_index_class_map.end(),
-                      SortScorePairDescend<std::pair<int, int>>);
+            // only the kept detections need to be ordered
+            std::partial_sort(conf_index_class_map.begin(), conf_index_class_map.begin() + _keep_top_k, conf_index_class_map.end(),
+                              SortScorePairDescend<std::pair<int, int>>);
             conf_index_class_map.resize(_keep_top_k);
 
             // Store the new indices.
@@ -363,41 +370,58 @@ struct ConfidenceComparator {
     const float* _conf_data;
 };
 
-static inline float JaccardOverlap(const float *decoded_bbox,
-                                   const float *bbox_sizes,
-                                   const int idx1,
-                                   const int idx2) {
-    float xmin1 = decoded_bbox[idx1*4 + 0];
-    float ymin1 = decoded_bbox[idx1*4 + 1];
-    float xmax1 = decoded_bbox[idx1*4 + 2];
-    float ymax1 = decoded_bbox[idx1*4 + 3];
-
-    float xmin2 = decoded_bbox[idx2*4 + 0];
-    float ymin2 = decoded_bbox[idx2*4 + 1];
-    float xmax2 = decoded_bbox[idx2*4 + 2];
-    float ymax2 = decoded_bbox[idx2*4 + 3];
-
-    if (xmin2 > xmax1 || xmax2 < xmin1 || ymin2 > ymax1 || ymax2 < ymin1) {
-        return 0.0f;
-    }
-
-    float intersect_xmin = (std::max)(xmin1, xmin2);
-    float intersect_ymin = (std::max)(ymin1, ymin2);
-    float intersect_xmax = (std::min)(xmax1, xmax2);
-    float intersect_ymax = (std::min)(ymax1, ymax2);
-
-    float intersect_width  = intersect_xmax - intersect_xmin;
-    float intersect_height = intersect_ymax - intersect_ymin;
-
-    if (intersect_width <= 0 || intersect_height <= 0) {
-        return 0.0f;
+// NMS compares a candidate with the kept boxes in blocks: the overlaps of a block are computed without branches,
+// so the compiler can vectorize the loop, and the candidate is rejected as soon as a block has an overlap above
+// the threshold. The node is not cross-compiled, so the loops are built for the baseline ISA only.
+static const int NMS_BLOCK_SIZE = 16;
+
+// Returns true if the overlap (Jaccard index) of the box with any of the kept boxes is above the threshold.
+// Kept boxes are stored by planes of kept_stride elements: xmin, ymin, xmax, ymax, size.
+static inline bool IsSuppressed(const float *kept_bboxes,
+                                const int kept_stride,
+                                const int kept_count,
+                                const float *bbox,
+                                const float bbox_size,
+                                const float nms_threshold) {
+    const float *kept_xmin = kept_bboxes + 0*kept_stride;
+    const float *kept_ymin = kept_bboxes + 1*kept_stride;
+    const float *kept_xmax = kept_bboxes + 2*kept_stride;
+    const float *kept_ymax = kept_bboxes + 3*kept_stride;
+    const float *kept_size = kept_bboxes + 4*kept_stride;
+
+    const float xmin = bbox[0];
+    const float ymin = bbox[1];
+    const float xmax = bbox[2];
+    const float ymax = bbox[3];
+
+    for (int start = 0; start < kept_count; start += NMS_BLOCK_SIZE) {
+        const int end = (std::min)(kept_count, start + NMS_BLOCK_SIZE);
+        int suppressed = 0;
+        for (int k = start; k < end; ++k) {
+            const float intersect_width  = (std::min)(xmax, kept_xmax[k]) - (std::max)(xmin, kept_xmin[k]);
+            const float intersect_height = (std::min)(ymax, kept_ymax[k]) - (std::max)(ymin, kept_ymin[k]);
+            const float intersect_size = intersect_width * intersect_height;
+            const float ratio = intersect_size / (bbox_size + kept_size[k] - intersect_size);
+            // the boxes without intersection have zero overlap
+            const float overlap = (intersect_width > 0 && intersect_height > 0) ? ratio : 0.0f;
+            suppressed |= overlap > nms_threshold;
+        }
+        if (suppressed)
+            return true;
     }
+    return false;
+}
 
-    float intersect_size = intersect_width * intersect_height;
-    float bbox1_size = bbox_sizes[idx1];
-    float bbox2_size = bbox_sizes[idx2];
-
-    return intersect_size / (bbox1_size + bbox2_size - intersect_size);
+static inline void KeepBBox(float *kept_bboxes,
+                            const int kept_stride,
+                            const int kept_idx,
+                            const float *bbox,
+                            const float bbox_size) {
+    kept_bboxes[0*kept_stride + kept_idx] = bbox[0];
+    kept_bboxes[1*kept_stride + kept_idx] = bbox[1];
+    kept_bboxes[2*kept_stride + kept_idx] = bbox[2];
+    kept_bboxes[3*kept_stride + kept_idx] = bbox[3];
+    kept_bboxes[4*kept_stride + kept_idx] = bbox_size;
 }
 
 void MKLDNNDetectionOutputNode::decodeBBoxes(const float *prior_data,
@@ -421,84 +445,100 @@ void MKLDNNDetectionOutputNode::decodeBBoxes(const float *prior_data,
             }
         }
     }
-    parallel_for(num_priors_actual[n], [&](int p) {
-        float new_xmin = 0.0f;
-        float new_ymin = 0.0f;
-        float new_xmax = 0.0f;
-        float new_ymax = 0.0f;
-
-        float prior_xmin = prior_data[p*pr_size + 0 + offs];
-        float prior_ymin = prior_data[p*pr_size + 1 + offs];
-        float prior_xmax = prior_data[p*pr_size + 2 + offs];
-        float prior_ymax = prior_data[p*pr_size + 3 + offs];
-
-        float loc_xmin = loc_data[4*p*_num_loc_classes + 0];
-        float loc_ymin = loc_data[4*p*_num_loc_classes + 1];
-        float loc_xmax = loc_data[4*p*_num_loc_classes + 2];
-        float loc_ymax = loc_data[4*p*_num_loc_classes + 3];
-
-        if (!_normalized) {
-            prior_xmin /= _image_width;
-            prior_ymin /= _image_height;
-            prior_xmax /= _image_width;
-            prior_ymax /= _image_height;
-        }
+    // the parameters are loop invariants, so the compiler can unswitch the loop over a block of priors,
+    // the exponent of the CENTER_SIZE code is still a std::exp call per prior
+    const bool normalized = _normalized;
+    const bool corner = _code_type == CodeType::CORNER;
+    const bool variance_encoded_in_target = _variance_encoded_in_target != 0;
+    const bool clip_before_nms = _clip_before_nms;
+    const float image_width = static_cast<float>(_image_width);
+    const float image_height = static_cast<float>(_image_height);
+    const int loc_stride = 4*_num_loc_classes;
+
+    const int num_priors = num_priors_actual[n];
+    const int block_size = 64;
+    parallel_for(div_up(num_priors, block_size), [&](int block) {
+        const int start = block*block_size;
+        const int end = (std::min)(num_priors, start + block_size);
+        for (int p = start; p < end; ++p) {
+            float new_xmin = 0.0f;
+            float new_ymin = 0.0f;
+            float new_xmax = 0.0f;
+            float new_ymax = 0.0f;
+
+            float prior_xmin = prior_data[p*pr_size + 0 + offs];
+            float prior_ymin = prior_data[p*pr_size + 1 + offs];
+            float prior_xmax = prior_data[p*pr_size + 2 + offs];
+            float prior_ymax = prior_data[p*pr_size + 3 + offs];
+
+            float loc_xmin = loc_data[loc_stride*p + 0];
+            float loc_ymin = loc_data[loc_stride*p + 1];
+            float loc_xmax = loc_data[loc_stride*p + 2];
+            float loc_ymax = loc_data[loc_stride*p + 3];
+
+            if (!normalized) {
+                prior_xmin /= image_width;
+                prior_ymin /= image_height;
+                prior_xmax /= image_width;
+                prior_ymax /= image_height;
+            }
 
-        if (_code_type == CodeType::CORNER) {
-            if (_variance_encoded_in_target) {
-                // variance is encoded in target, we simply need to add the offset predictions.
-                new_xmin = prior_xmin + loc_xmin;
-                new_ymin = prior_ymin + loc_ymin;
-                new_xmax = prior_xmax + loc_xmax;
-                new_ymax = prior_ymax + loc_ymax;
+            if (corner) {
+                if (variance_encoded_in_target) {
+                    // variance is encoded in target, we simply need to add the offset predictions.
+                    new_xmin = prior_xmin + loc_xmin;
+                    new_ymin = prior_ymin + loc_ymin;
+                    new_xmax = prior_xmax + loc_xmax;
+                    new_ymax = prior_ymax + loc_ymax;
+                } else {
+                    new_xmin = prior_xmin + variance_data[p*4 + 0] * loc_xmin;
+                    new_ymin = prior_ymin + variance_data[p*4 + 1] * loc_ymin;
+                    new_xmax = prior_xmax + variance_data[p*4 + 2] * loc_xmax;
+                    new_ymax = prior_ymax + variance_data[p*4 + 3] * loc_ymax;
+                }
             } else {
-                new_xmin = prior_xmin + variance_data[p*4 + 0] * loc_xmin;
-                new_ymin = prior_ymin + variance_data[p*4 + 1] * loc_ymin;
-                new_xmax = prior_xmax + variance_data[p*4 + 2] * loc_xmax;
-                new_ymax = prior_ymax + variance_data[p*4 + 3] * loc_ymax;
+                float prior_width    =  prior_xmax - prior_xmin;
+                float prior_height   =  prior_ymax - prior_ymin;
+                float prior_center_x = (prior_xmin + prior_xmax) / 2.0f;
+                float prior_center_y = (prior_ymin + prior_ymax) / 2.0f;
+
+                float decode_bbox_center_x, decode_bbox_center_y;
+                float decode_bbox_width, decode_bbox_height;
+
+                if (variance_encoded_in_target) {
+                    // variance is encoded in target, we simply need to restore the offset predictions.
+                    decode_bbox_center_x = loc_xmin * prior_width  + prior_center_x;
+                    decode_bbox_center_y = loc_ymin * prior_height + prior_center_y;
+                    decode_bbox_width  = std::exp(loc_xmax) * prior_width;
+                    decode_bbox_height = std::exp(loc_ymax) * prior_height;
+                } else {
+                    // variance is encoded in bbox, we need to scale the offset accordingly.
+                    decode_bbox_center_x = variance_data[p*4 + 0] * loc_xmin * prior_width + prior_center_x;
+                    decode_bbox_center_y = variance_data[p*4 + 1] * loc_ymin * prior_height + prior_center_y;
+                    decode_bbox_width    = std::exp(variance_data[p*4 + 2] * loc_xmax) * prior_width;
+                    decode_bbox_height   = std::exp(variance_data[p*4 + 3] * loc_ymax) * prior_height;
+                }
+
+                new_xmin = decode_bbox_center_x - decode_bbox_width  / 2.0f;
+                new_ymin = decode_bbox_center_y - decode_bbox_height / 2.0f;
+                new_xmax = decode_bbox_center_x + decode_bbox_width  / 2.0f;
+                new_ymax = decode_bbox_center_y + decode_bbox_height / 2.0f;
             }
-        } else if (_code_type == CodeType::CENTER_SIZE) {
-            float prior_width    =  prior_xmax - prior_xmin;
-            float prior_height   =  prior_ymax - prior_ymin;
-            float prior_center_x = (prior_xmin + prior_xmax) / 2.0f;
-            float prior_center_y = (prior_ymin + prior_ymax) / 2.0f;
-
-            float decode_bbox_center_x, decode_bbox_center_y;
-            float decode_bbox_width, decode_bbox_height;
-
-            if (_variance_encoded_in_target) {
-                // variance is encoded in target, we simply need to restore the offset predictions.
-                decode_bbox_center_x = loc_xmin * prior_width  + prior_center_x;
-                decode_bbox_center_y = loc_ymin * prior_height + prior_center_y;
-                decode_bbox_width  = std::exp(loc_xmax) * prior_width;
-                decode_bbox_height = std::exp(loc_ymax) * prior_height;
-            } else {
-                // variance is encoded in bbox, we need to scale the offset accordingly.
-                decode_bbox_center_x = variance_data[p*4 + 0] * loc_xmin * prior_width + prior_center_x;
-                decode_bbox_center_y = variance_data[p*4 + 1] * loc_ymin * prior_height + prior_center_y;
-                decode_bbox_width    = std::exp(variance_data[p*4 + 2] * loc_xmax) * prior_width;
-                decode_bbox_height   = std::exp(variance_data[p*4 + 3] * loc_ymax) * prior_height;
+
+            if (clip_before_nms) {
+                new_xmin = (std::max)(0.0f, (std::min)(1.0f, new_xmin));
+                new_ymin = (std::max)(0.0f, (std::min)(1.0f, new_ymin));
+                new_xmax = (std::max)(0.0f, (std::min)(1.0f, new_xmax));
+                new_ymax = (std::max)(0.0f, (std::min)(1.0f, new_ymax));
             }
 
-            new_xmin = decode_bbox_center_x - decode_bbox_width  / 2.0f;
-            new_ymin = decode_bbox_center_y - decode_bbox_height / 2.0f;
-            new_xmax = decode_bbox_center_x + decode_bbox_width  / 2.0f;
-            new_ymax = decode_bbox_center_y + decode_bbox_height / 2.0f;
-        }
+            decoded_bboxes[p*4 + 0] = new_xmin;
+            decoded_bboxes[p*4 + 1] = new_ymin;
+            decoded_bboxes[p*4 + 2] = new_xmax;
+            decoded_bboxes[p*4 + 3] = new_ymax;
 
-        if (_clip_before_nms) {
-            new_xmin = (std::max)(0.0f, (std::min)(1.0f, new_xmin));
-            new_ymin = (std::max)(0.0f, (std::min)(1.0f, new_ymin));
-            new_xmax = (std::max)(0.0f, (std::min)(1.0f, new_xmax));
-            new_ymax = (std::max)(0.0f, (std::min)(1.0f, new_ymax));
+            decoded_bbox_sizes[p] = (new_xmax - new_xmin) * (new_ymax - new_ymin);
         }
-
-        decoded_bboxes[p*4 + 0] = new_xmin;
-        decoded_bboxes[p*4 + 1] = new_ymin;
-        decoded_bboxes[p*4 + 2] = new_xmax;
-        decoded_bboxes[p*4 + 3] = new_ymax;
-
-        decoded_bbox_sizes[p] = (new_xmax - new_xmin) * (new_ymax - new_ymin);
     });
 }
 
@@ -508,7 +548,8 @@ void MKLDNNDetectionOutputNode::nms_cf(const float* conf_data,
                                  int* buffer,
                                  int* indices,
                                  int& detections,
-                                 int num_priors_actual) {
+                                 int num_priors_actual,
+                                 float* kept_bboxes) {
     int count = 0;
     for (int i = 0; i < num_priors_actual; ++i) {
         if (conf_data[i] > _confidence_threshold) {
@@ -526,16 +567,8 @@ void MKLDNNDetectionOutputNode::nms_cf(const float* conf_data,
     for (int i = 0; i < num_output_scores; ++i) {
         const int idx = buffer[i];
 
-        bool keep = true;
-        for (int k = 0; k < detections; ++k) {
-            const int kept_idx = indices[k];
-            float overlap = JaccardOverlap(bboxes, sizes, idx, kept_idx);
-            if (overlap > _nms_threshold) {
-                keep = false;
-                break;
-            }
-        }
-        if (keep) {
+        if (!IsSuppressed(kept_bboxes, _num_priors, detections, bboxes + idx*4, sizes[idx], _nms_threshold)) {
+            KeepBBox(kept_bboxes, _num_priors, detections, bboxes + idx*4, sizes[idx]);
             indices[detections] = idx;
             detections++;
         }
@@ -548,9 +581,11 @@ void MKLDNNDetectionOutputNode::nms_mx(const float* conf_data,
                                  int* buffer,
                                  int* indices,
                                  int* detections,
-                                 int num_priors_actual) {
-    int count = 0;
-    for (int i = 0; i < num_priors_actual; ++i) {
+                                 int num_priors_actual,
+                                 float* kept_bboxes) {
+    // the best class of each prior is found in parallel, the candidates are gathered in the priors order
+    int *candidates = _mx_candidates.data();
+    parallel_for(num_priors_actual, [&](int i) {
         float conf = -1;
         int id = 0;
         for (int c = 1; c < _num_classes; ++c) {
@@ -561,8 +596,13 @@ void MKLDNNDetectionOutputNode::nms_mx(const float* conf_data,
             }
         }
 
-        if (id > 0 && conf >= _confidence_threshold) {
-            indices[count++] = id*_num_priors + i;
+        candidates[i] = (id > 0 && conf >= _confidence_threshold) ? id*_num_priors + i : -1;
+    });
+
+    int count = 0;
+    for (int i = 0; i < num_priors_actual; ++i) {
+        if (candidates[i] >= 0) {
+            indices[count++] = candidates[i];
         }
     }
 
@@ -579,22 +619,11 @@ void MKLDNNDetectionOutputNode::nms_mx(const float* conf_data,
 
         int &ndetection = detections[cls];
         int *pindices = indices + cls*_num_priors;
+        float *pkept = kept_bboxes + cls*5*_num_priors;
+        const int bbox_idx = _share_location ? prior : cls*_num_priors + prior;
 
-        bool keep = true;
-        for (int k = 0; k < ndetection; ++k) {
-            const int kept_idx = pindices[k];
-            float overlap = 0.0f;
-            if (_share_location) {
-                overlap = JaccardOverlap(bboxes, sizes, prior, kept_idx);
-            } else {
-                overlap = JaccardOverlap(bboxes, sizes, cls*_num_priors + prior, cls*_num_priors + kept_idx);
-            }
-            if (overlap > _nms_threshold) {
-                keep = false;
-                break;
-            }
-        }
-        if (keep) {
+        if (!IsSuppressed(pkept, _num_priors, ndetection, bboxes + bbox_idx*4, sizes[bbox_idx], _nms_threshold)) {
+            KeepBBox(pkept, _num_priors, ndetection, bboxes + bbox_idx*4, sizes[bbox_idx]);
             pindices[ndetection++] = prior;
         }
     }
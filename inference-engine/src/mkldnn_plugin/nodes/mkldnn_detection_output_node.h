@@ -67,11 +67,12 @@ private:
                       bool decodeType = true); // after ARM = false
 
     void nms_cf(const float *conf_data, const float *bboxes, const float *sizes,
-                int *buffer, int *indices, int &detections, int num_priors_actual);
+                int *buffer, int *indices, int &detections, int num_priors_actual, float *kept_bboxes);
 
     void nms_mx(const float *conf_data, const float *bboxes, const float *sizes,
-                int *buffer, int *indices, int *detections, int num_priors_actual);
+                int *buffer, int *indices, int *detections, int num_priors_actual, float *kept_bboxes);
 
+    // scratch buffers are allocated once and reused by each execute call
     std::vector<float> _decoded_bboxes;
     std::vector<int> _buffer;
     std::vector<int> _indices;
@@ -79,6 +80,11 @@ private:
     std::vector<float> _reordered_conf;
     std::vector<float> _bbox_sizes;
     std::vector<int> _num_priors_actual;
+    // boxes kept by NMS for each class in the planar layout (xmin, ymin, xmax, ymax, size planes), so that
+    // the overlap of a candidate with all kept boxes is computed by a vectorizable loop
+    std::vector<float> _kept_bboxes;
+    std::vector<int> _mx_candidates;
+    std::vector<std::pair<float, std::pair<int, int>>> _conf_index_class_map;
 
     std::string errorPrefix;
 };
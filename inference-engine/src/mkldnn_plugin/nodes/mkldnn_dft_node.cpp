@@ -5,6 +5,8 @@
 #include <string>
 #include <vector>
 #include <cmath>
+#include <numeric>
+#include <algorithm>
 #include <mkldnn_extension_utils.h>
 
 #include "mkldnn_dft_node.h"
@@ -102,42 +104,6 @@ void MKLDNNDFTNode::initSupportedPrimitiveDescriptors() {
 }
 
 namespace {
-inline float getRealFromComplexProd(float lhsReal, float lhsImag, float rhsReal, float rhsImag) {
-    return lhsReal * rhsReal - lhsImag * rhsImag;
-}
-
-inline float getImaginaryFromComplexProd(float lhsReal, float lhsImag, float rhsReal, float rhsImag) {
-    return lhsReal * rhsImag + lhsImag * rhsReal;
-}
-
-/*
-    Returns true while we can iterate
-    Specified axis is skipped in counters   
-*/
-inline bool nextIterationStep(std::vector<size_t>& counters, const std::vector<size_t>& iterationRange, size_t axis) {
-    auto itCounter = counters.rbegin();
-    auto itWork = iterationRange.rbegin();
-
-    while (itCounter != counters.rend() && itWork != iterationRange.rend()) {
-        if (std::distance(itCounter, counters.rend()) == axis + 1) {
-            ++itCounter;
-            ++itWork;
-            continue;
-        }
-        *itCounter = (*itCounter + 1) % *itWork;
-        if (*itCounter != 0) {
-            return true;
-        }
-        ++itCounter;
-        ++itWork;
-    }
-    return false;
-}
-
-inline bool IsPowerOfTwo(size_t n) {
-    return (n != 0) && (n & (n - 1)) == 0;
-}
-
 inline bool copyStep(std::vector<size_t>& counters, const std::vector<size_t>& iterationRange) {
     auto itCounter = counters.rbegin();
     auto itWork = iterationRange.rbegin();
@@ -222,7 +188,7 @@ void copyDataToOutputWithSignalSize(const float* input, const std::vector<size_t
 
 } // namespace
 
-void MKLDNNDFTNode::execute(mkldnn::stream strm) {
+void MKLDNNDFTNode::prepareFFTPlans() {
     auto axesEdge = getParentEdgeAt(AXES_INDEX);
     const auto* axesStartPtr = reinterpret_cast<const int32_t*>(axesEdge->getMemoryPtr()->GetPtr());
     axes = std::vector<int32_t>(axesStartPtr, axesStartPtr + axesEdge->getDims()[0]);
@@ -236,12 +202,25 @@ void MKLDNNDFTNode::execute(mkldnn::stream strm) {
     outputShape = getChildEdgeAt(0)->getDims().ToSizeVector();
     for (size_t axis : axes) {
         size_t nComplex = outputShape[axis];
-        // FFT uses different twiddle factors
-        if (twiddlesMap.find(nComplex) == twiddlesMap.end() && !IsPowerOfTwo(nComplex)) {
-            twiddlesMap[nComplex] = generateTwiddles(nComplex);
+        if (fftPlans.find(nComplex) == fftPlans.end()) {
+            fftPlans[nComplex] = std::make_shared<FFTPlan>(nComplex, inverse);
         }
+        threadBufferSize = std::max(threadBufferSize, 2 * nComplex + fftPlans[nComplex]->getScratchSize());
     }
 
+    const size_t buffersSize = threadBufferSize * parallel_get_max_threads();
+    if (threadBuffers.size() < buffersSize)
+        threadBuffers.resize(buffersSize);
+
+    fftPlansPrepared = true;
+}
+
+void MKLDNNDFTNode::execute(mkldnn::stream strm) {
+    // plans for constant axes are prepared once: in createPrimitive() if the axes are an Input node,
+    // otherwise on the first execution when the constant subgraph has been already computed
+    if (!fftPlansPrepared || !getParentEdgeAt(AXES_INDEX)->getParent()->isConstant())
+        prepareFFTPlans();
+
     auto inputDataEdge = getParentEdgeAt(DATA_INDEX);
     auto outputDataEdge = getChildEdgeAt(0);
     const auto *input = reinterpret_cast<const float*>(inputDataEdge->getMemoryPtr()->GetPtr());
@@ -258,163 +237,64 @@ void MKLDNNDFTNode::execute(mkldnn::stream strm) {
 
     // 1d case
     if (inputDataEdge->getDesc().getDims().size() == 2) {
-        size_t nComplex = outputShape[0];
-        if (IsPowerOfTwo(nComplex)) {
-            fft(output, nComplex * 2, true);
-        } else {
-            naiveDFT(output, nComplex * 2);
-        }
+        const auto& plan = *fftPlans.at(outputShape[0]);
+        plan.execute(output, threadBuffers.data(), true);
     } else {
         dftNd(output, outputStrides);
     }
 }
 
-void MKLDNNDFTNode::dftNd(float* output, const std::vector<size_t>& outputStrides) const {
+void MKLDNNDFTNode::dftNd(float* output, const std::vector<size_t>& outputStrides) {
     const std::vector<size_t> iterationRange(outputShape.begin(), outputShape.end() - 1);
-    const size_t lastDimIndex = iterationRange.size() - 1;
-    for (size_t axisIndex = 0; axisIndex < axes.size(); ++axisIndex) {
-        const size_t currentAxis = axes[axisIndex];
-        const size_t outputComplexLen = outputShape[currentAxis];
-        const size_t outputLen = outputComplexLen * 2;
-
-        std::vector<size_t> iterationCounter(iterationRange.size(), 0);
-        if (IsPowerOfTwo(outputComplexLen)) {
-            size_t parallelDimIndex = lastDimIndex == currentAxis ? lastDimIndex - 1 : lastDimIndex;
-            do {
-                parallel_for(iterationRange[parallelDimIndex], [&](size_t dim) {
-                    std::vector<float> gatheredData(outputLen);
-                    auto parallelIterationCounter = iterationCounter;
-                    parallelIterationCounter[parallelDimIndex] = dim;
-                    gatherToBufferND(gatheredData.data(), output, currentAxis, parallelIterationCounter, outputShape, outputStrides);
-                    fft(gatheredData.data(), outputLen);
-                    applyBufferND(gatheredData.data(), output, currentAxis, parallelIterationCounter, outputShape, outputStrides);
-                });
-                iterationCounter[parallelDimIndex] = iterationRange[parallelDimIndex] - 1;
-            } while (nextIterationStep(iterationCounter, iterationRange, currentAxis));
-        } else {
-            std::vector<float> gatheredData(outputLen);
-            do {
-                gatherToBufferND(gatheredData.data(), output, currentAxis, iterationCounter, outputShape, outputStrides);
-                naiveDFT(gatheredData.data(), outputLen);
-                applyBufferND(gatheredData.data(), output, currentAxis, iterationCounter, outputShape, outputStrides);
-            } while (nextIterationStep(iterationCounter, iterationRange, currentAxis));
-        }
-    }
-}
-
-/* Cooley Tukey implementation of FFT */
-void MKLDNNDFTNode::fft(float* data, int64_t dataLength, bool parallelize) const {
-    static int cacheSizeL3 = utils::get_cache_size(3, false);
-    static int elementsPerCacheLine = cacheSizeL3 / sizeof(float);
-    std::vector<float> bufferVector(dataLength * 2, 0);
-    float* buffer = bufferVector.data();
-    cpu_memcpy(buffer, data, dataLength * sizeof(float));
-
-    size_t nComplex = dataLength / 2;
-    float* inBufferStart = buffer + dataLength;
-    float* outBufferStart = buffer;
-
-    auto blockIteration = [&] (const size_t block, const size_t blockSize, const size_t nextIterationBlockSize, const float anglePart) {
-        float* curInpBufferPtr = inBufferStart + block * blockSize;
-        float* curOutBufferPtr = outBufferStart + block * nextIterationBlockSize;
-
-        const float angle = anglePart * block;
-        const float twiddleReal = std::cos(angle);
-        const float twiddleImag = -std::sin(angle);
-        for (int64_t pair = 0; pair < blockSize / 2; pair += 2) {
-            const float evenReal = curInpBufferPtr[pair];
-            const float evenImag = curInpBufferPtr[pair + 1];
-
-            const float oddReal = curInpBufferPtr[(blockSize / 2 + pair)];
-            const float oddImag = curInpBufferPtr[(blockSize / 2 + pair) + 1];
-
-            const float twiddledOddReal = getRealFromComplexProd(twiddleReal, twiddleImag, oddReal, oddImag);
-            const float twiddledOddImag = getImaginaryFromComplexProd(twiddleReal, twiddleImag, oddReal, oddImag);
-
-            curOutBufferPtr[pair] = evenReal + twiddledOddReal;
-            curOutBufferPtr[pair + 1] = evenImag + twiddledOddImag;
-
-            curOutBufferPtr[nComplex + pair] = evenReal - twiddledOddReal;
-            curOutBufferPtr[nComplex + pair + 1] = evenImag - twiddledOddImag;
-        }
-    };
-
-    for (int64_t numBlocks = 1; numBlocks < nComplex; numBlocks *= 2) {
-        const float anglePart = PI / numBlocks * (inverse ? -1 : 1);
-
-        std::swap(inBufferStart, outBufferStart);
-        const int64_t blockSize = dataLength / numBlocks;
-        const int64_t nextIterationBlockSize = blockSize / 2;
-        if (parallelize && blockSize >= 4 * elementsPerCacheLine) {
-            parallel_for(numBlocks, [&] (const size_t block) {
-                blockIteration(block, blockSize, nextIterationBlockSize, anglePart);
-            });
-        } else {
-            for (int64_t block = 0; block < numBlocks; ++block) {
-                blockIteration(block, blockSize, nextIterationBlockSize, anglePart);
+    const size_t totalComplex = std::accumulate(iterationRange.begin(), iterationRange.end(), size_t(1), std::multiplies<size_t>());
+    for (size_t currentAxis : axes) {
+        const auto& plan = *fftPlans.at(outputShape[currentAxis]);
+        const size_t outputLen = outputShape[currentAxis] * 2;
+        const size_t linesNum = totalComplex / iterationRange[currentAxis];
+        // single long signal is parallelized inside the transform
+        const bool parallelInside = linesNum == 1;
+
+        auto transformLines = [&](size_t start, size_t end, size_t ithr) {
+            float* gatheredData = threadBuffers.data() + ithr * threadBufferSize;
+            float* scratch = gatheredData + outputLen;
+            std::vector<size_t> iterationCounter(iterationRange.size(), 0);
+            for (size_t line = start; line < end; ++line) {
+                size_t rest = line;
+                for (size_t dim = iterationRange.size(); dim-- > 0;) {
+                    if (dim == currentAxis)
+                        continue;
+                    iterationCounter[dim] = rest % iterationRange[dim];
+                    rest /= iterationRange[dim];
+                }
+                gatherToBufferND(gatheredData, output, currentAxis, iterationCounter, outputShape, outputStrides);
+                plan.execute(gatheredData, scratch, parallelInside);
+                applyBufferND(gatheredData, output, currentAxis, iterationCounter, outputShape, outputStrides);
             }
-        }
-    }
+        };
 
-    for (int64_t k = 0; k < dataLength; k++) {
-        if (inverse) {
-            outBufferStart[k] /= nComplex;
+        if (parallelInside) {
+            transformLines(0, linesNum, 0);
+        } else {
+            parallel_nt(0, [&](const int ithr, const int nthr) {
+                size_t start = 0, end = 0;
+                splitter(linesNum, nthr, ithr, start, end);
+                if (start < end)
+                    transformLines(start, end, ithr);
+            });
         }
-        data[k] = outBufferStart[k];
     }
 }
 
-void MKLDNNDFTNode::naiveDFT(float* data, size_t dataLength) const {
-    std::vector<float> outputBuffer(dataLength);
-    const size_t nComplex = dataLength / 2;
-    const auto& twiddles = twiddlesMap.find(nComplex)->second;
-
-    parallel_for(nComplex, [&](size_t k) {
-        float sumReal = 0.0f;
-        float sumImag = 0.0f;
-        for (size_t n = 0; n < nComplex; ++n) {
-            auto it = twiddles[k * nComplex + n];
-            float complexReal = it.first;
-            float complexImag = it.second;
-
-            if (inverse) {
-                complexImag *= -1; // conjugate
-            }
-            float complexProdReal = getRealFromComplexProd(data[2 * n], data[2 * n + 1], complexReal, complexImag);
-            float complexProdImag = getImaginaryFromComplexProd(data[2 * n], data[2 * n + 1], complexReal, complexImag);
-
-            sumReal += complexProdReal;
-            sumImag += complexProdImag;
-        }
-
-        if (inverse) {
-            sumReal /= nComplex;
-            sumImag /= nComplex;
-        }
-        outputBuffer[k * 2] = sumReal;
-        outputBuffer[k * 2 + 1] = sumImag;
-    });
-    cpu_memcpy(data, outputBuffer.data(), dataLength * sizeof(float));
-}
-
-std::vector<std::pair<float, float>> MKLDNNDFTNode::generateTwiddles(size_t n_complex) const {
-    std::vector<std::pair<float, float>> twiddles(n_complex * n_complex);
-    parallel_for(n_complex, [&](const size_t k) {
-        for (size_t n = 0; n < n_complex; ++n) {
-            float phase =  2.0f * PI * static_cast<float>(n * k) / static_cast<float>(n_complex);
-            auto complexReal = std::cos(phase);
-            auto complexImag = -std::sin(phase);
-            twiddles[k * n_complex + n] = std::make_pair(complexReal, complexImag);
-        }
-    });
-    return twiddles;
-}
-
 bool MKLDNNDFTNode::created() const {
     return getType() == DFT;
 }
 
-void MKLDNNDFTNode::createPrimitive() {}
+void MKLDNNDFTNode::createPrimitive() {
+    // constant subgraphs are not executed yet, so only Input node memory can be read here
+    auto axesParent = getParentEdgeAt(AXES_INDEX)->getParent();
+    if (axesParent->getType() == Input && axesParent->isConstant())
+        prepareFFTPlans();
+}
 
 
 REG_MKLDNN_PRIM_FOR(MKLDNNDFTNode, DFT)
@@ -7,6 +7,9 @@
 #include <ie_common.h>
 #include <mkldnn_node.h>
 #include <string>
+#include <memory>
+#include <unordered_map>
+#include "common/fft_plan.h"
 
 namespace MKLDNNPlugin {
 
@@ -24,13 +27,15 @@ public:
     static bool isSupportedOperation(const std::shared_ptr<ngraph::Node>& op, std::string& errorMessage) noexcept;
 
 private:
-    void dftNd(float* output, const std::vector<size_t>& outputStrides) const;
-    void fft(float* data, int64_t dataLength, bool parallelize = false) const;
-    void naiveDFT(float* data, size_t dataLength) const;
-
-    std::vector<std::pair<float, float>> generateTwiddles(size_t n_complex) const;
-
-    std::unordered_map<size_t, std::vector<std::pair<float, float>>> twiddlesMap;
+    void dftNd(float* output, const std::vector<size_t>& outputStrides);
+    void prepareFFTPlans();
+
+    // FFT plans with precomputed twiddles per signal length
+    std::unordered_map<size_t, std::shared_ptr<FFTPlan>> fftPlans;
+    bool fftPlansPrepared = false;
+    // per thread buffers for a gathered signal followed by the plan scratch
+    std::vector<float> threadBuffers;
+    size_t threadBufferSize = 0;
     std::vector<int32_t> axes;
     std::vector<size_t> outputShape;
     std::vector<size_t> inputShape;
@@ -38,7 +43,6 @@ private:
     const size_t DATA_INDEX = 0;
     const size_t AXES_INDEX = 1;
     const size_t SIGNAL_SIZE_INDEX = 2;
-    static constexpr float PI = 3.141592653589793238462643f;
     bool inverse;
 };
 
@@ -12,6 +12,8 @@
 #include <mkldnn_extension_utils.h>
 #include <mkldnn.hpp>
 #include "utils/general_utils.h"
+#include <ie_ngraph_utils.hpp>
+#include <cpu/x64/cpu_isa_traits.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -45,11 +47,30 @@ MKLDNNFullyConnectedNode::MKLDNNFullyConnectedNode(const std::shared_ptr<ngraph:
         errorPrefix = "FullyConnected node with name '" + getName() + "'";
 
         withBiases = op->get_input_size() == 3;
+        weightsSparsity = getWeightsSparsity(op);
     } else {
         IE_THROW(NotImplemented) << errorMessage;
     }
 }
 
+float MKLDNNFullyConnectedNode::getWeightsSparsity(const std::shared_ptr<ngraph::Node>& op) {
+    const auto weights = std::dynamic_pointer_cast<const ngraph::opset1::Constant>(op->get_input_node_shared_ptr(WEIGHTS_ID));
+    if (!weights || weights->get_shape().size() != 2 || !one_of(op->get_input_shape(DATA_ID).size(), 2, 3))
+        return -1.f;
+
+    const auto dataPrc = details::convertPrecision(op->get_input_element_type(DATA_ID));
+    const auto weightsPrc = details::convertPrecision(weights->get_element_type());
+    if (!(dataPrc == Precision::FP32 && weightsPrc == Precision::FP32) &&
+        !(one_of(dataPrc, Precision::U8, Precision::I8) && weightsPrc == Precision::I8))
+        return -1.f;
+
+    return SparseFCKernel::sparsity(weights->get_data_ptr(), weightsPrc, ngraph::shape_size(weights->get_shape()));
+}
+
+void MKLDNNFullyConnectedNode::setSparseWeightsDecompressionRate(float rate) {
+    sparseWeights = weightsSparsity >= 0.f && weightsSparsity >= rate;
+}
+
 std::vector<memory::format_tag> MKLDNNFullyConnectedNode::getAvailableFormatsForDims(const MKLDNNDims &dims) const {
     if (dims.ndims() == 0)
         return {memory::format_tag::x};
@@ -112,6 +133,16 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     }
     biasesDims.push_back(weightsDims[0]);
 
+    if (sparseWeights) {
+        // precisions may be changed by the graph (e.g. enforced BF16) after the node creation
+        const bool f32 = inputDataType == memory::data_type::f32 && weightsDataType == memory::data_type::f32;
+        const bool int8 = one_of(inputDataType, memory::data_type::u8, memory::data_type::s8) && weightsDataType == memory::data_type::s8;
+        sparseWeights = (f32 || int8) && fusedWith.empty() && getParentEdgeAt(WEIGHTS_ID)->getParent()->isConstant();
+        sparseInputDataType = inputDataType;
+    }
+    if (sparseWeights)
+        return;
+
     for (auto format : getAvailableFormatsForDims(inDims)) {
         MKLDNNMemoryDesc in_candidate(inDims, inputDataType, format);
         MKLDNNMemoryDesc out_candidate(outDims, outputDataType, memory::format_tag::any);
@@ -120,10 +151,92 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     }
 }
 
+void MKLDNNFullyConnectedNode::initSupportedPrimitiveDescriptors() {
+    if (!sparseWeights) {
+        MKLDNNNode::initSupportedPrimitiveDescriptors();
+        return;
+    }
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = false;
+    config.inConfs.resize(getParentEdges().size());
+    config.outConfs.resize(1);
+
+    const auto& inDims = getParentEdgeAt(DATA_ID)->getDims();
+    const auto& outDims = getChildEdgeAt(0)->getDims();
+    const auto weightsDataType = sparseInputDataType == memory::data_type::f32 ? memory::data_type::f32 : memory::data_type::s8;
+    config.inConfs[DATA_ID].desc = MKLDNNMemoryDesc(inDims, sparseInputDataType, MKLDNNMemory::GetPlainFormat(inDims));
+    config.inConfs[WEIGHTS_ID].desc = MKLDNNMemoryDesc(getParentEdgeAt(WEIGHTS_ID)->getDims(), weightsDataType, memory::format_tag::nc);
+    if (withBiases) {
+        const auto& biasDims = getParentEdgeAt(BIAS_ID)->getDims();
+        config.inConfs[BIAS_ID].desc = MKLDNNMemoryDesc(biasDims, memory::data_type::f32, MKLDNNMemory::GetPlainFormat(biasDims));
+    }
+    config.outConfs[0].desc = MKLDNNMemoryDesc(outDims, memory::data_type::f32, MKLDNNMemory::GetPlainFormat(outDims));
+
+    namespace x64 = mkldnn::impl::cpu::x64;
+    impl_desc_type impl_type;
+    if (x64::mayiuse(x64::avx512_common)) {
+        impl_type = impl_desc_type::jit_avx512;
+    } else if (x64::mayiuse(x64::avx2)) {
+        impl_type = impl_desc_type::jit_avx2;
+    } else if (x64::mayiuse(x64::sse41)) {
+        impl_type = impl_desc_type::jit_sse42;
+    } else {
+        impl_type = impl_desc_type::ref;
+    }
+    supportedPrimitiveDescriptors.push_back({config, impl_type, MKLDNNMemory::GetPlainFormat(outDims)});
+}
+
+void MKLDNNFullyConnectedNode::prepareSparseWeights() {
+    const auto& weightsMemory = getParentEdgeAt(WEIGHTS_ID)->getMemory();
+    const auto* weights = weightsMemory.GetPtr();
+    const size_t weightsSize = weightsMemory.GetSize();
+
+    auto create = [&] () {
+        return sparseKernel->packWeights(weights, getEngine());
+    };
+
+    MKLDNNMemoryPtr packed;
+    if (weightCache != nullptr) {
+        const uint64_t data_hash = weightCache->GetHashFunc().hash(static_cast<const unsigned char*>(weights), weightsSize);
+        const std::string string_hash = getName() + "_sparse_" + std::to_string(sparseKernel->getTileSize())
+                                        + "_" + std::to_string(weightsSize) + "_" + std::to_string(data_hash);
+        packed = *weightCache->findOrCreate(string_hash, create);
+    } else {
+        packed = create();
+    }
+    sparseKernel->setPackedWeights(packed);
+    sparseWeightsPrepared = true;
+}
+
+void MKLDNNFullyConnectedNode::executeSparse() {
+    // the weights produced by the constant subgraph are ready on the first inference only
+    if (!sparseWeightsPrepared)
+        prepareSparseWeights();
+
+    const auto* src = reinterpret_cast<const uint8_t*>(getParentEdgeAt(DATA_ID)->getMemoryPtr()->GetPtr());
+    const auto* bias = withBiases ? reinterpret_cast<const float*>(getParentEdgeAt(BIAS_ID)->getMemoryPtr()->GetPtr()) : nullptr;
+    auto* dst = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+    sparseKernel->execute(src, bias, dst);
+}
+
 void MKLDNNFullyConnectedNode::createPrimitive() {
-    if (prim)
+    if (prim || sparseKernel)
         return;
 
+    if (sparseWeights) {
+        const auto inDims = getParentEdgeAt(DATA_ID)->getDims().ToSizeVector();
+        const size_t K = inDims.back();
+        const size_t M = getParentEdgeAt(DATA_ID)->getDims().size() / K;
+        const size_t N = weightsDims[0];
+        sparseKernel = std::make_shared<SparseFCKernel>(MKLDNNExtensionUtils::DataTypeToIEPrecision(sparseInputDataType), M, N, K);
+        if (getParentEdgeAt(WEIGHTS_ID)->getParent()->getType() == Input)
+            prepareSparseWeights();
+        return;
+    }
+
     std::shared_ptr<mkldnn::primitive_attr> attr = initPrimitiveAttr();
     std::shared_ptr<inner_product_forward::primitive_desc> prim_desc;
     prim_desc = std::make_shared<inner_product_forward::primitive_desc>(
@@ -141,7 +254,9 @@ void MKLDNNFullyConnectedNode::createPrimitive() {
 }
 
 void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
-    if (prim) {
+    if (sparseKernel) {
+        executeSparse();
+    } else if (prim) {
         auto reshapeMemory = [this](int argType) {
             auto param = primArgs.find(argType);
             if (param != primArgs.end()) {
@@ -164,6 +279,8 @@ void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
 }
 
 bool MKLDNNFullyConnectedNode::canFuse(const MKLDNNNodePtr& node) const {
+    if (sparseWeights)
+        return false;
     return canFuseSimpleOperation(node);
 }
 
@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include "common/sparse_fc_kernel.h"
 #include <memory>
 #include <string>
 #include <vector>
@@ -18,6 +19,7 @@ public:
 
     std::vector<mkldnn::memory::format_tag> getAvailableFormatsForDims(const MKLDNNDims &dims) const override;
     void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
@@ -26,6 +28,12 @@ public:
         return false;
     }
 
+    /**
+     * Enables the sparse kernel if the fraction of zero weights is not less than the rate, must be called before
+     * the node initialization.
+     */
+    void setSparseWeightsDecompressionRate(float rate);
+
     const std::vector<impl_desc_type>& getPrimitivesPriority() override;
     void createDescriptor(const std::vector<InferenceEngine::TensorDesc>& inputDesc,
                           const std::vector<InferenceEngine::TensorDesc>& outputDesc) override;
@@ -55,6 +63,21 @@ private:
 
     bool withBiases = false;
 
+    /**
+     * Constant weights with the fraction of zeros above the threshold are multiplied by the sparse kernel instead of
+     * the dense inner product. Such node doesn't fuse the following operations.
+     * Returns the fraction of zero weights, or a negative value if the sparse kernel isn't applicable.
+     */
+    static float getWeightsSparsity(const std::shared_ptr<ngraph::Node>& op);
+    void prepareSparseWeights();
+    void executeSparse();
+
+    float weightsSparsity = -1.f;
+    bool sparseWeights = false;
+    mkldnn::memory::data_type sparseInputDataType = mkldnn::memory::data_type::f32;
+    std::shared_ptr<SparseFCKernel> sparseKernel;
+    bool sparseWeightsPrepared = false;
+
     std::string errorPrefix;
     static const size_t DATA_ID = 0;
     static const size_t WEIGHTS_ID = 1;
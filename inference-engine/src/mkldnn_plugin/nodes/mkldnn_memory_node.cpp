@@ -92,7 +92,8 @@ bool MKLDNNMemoryInputNode::isSupportedOperation(const std::shared_ptr<const ngr
 }
 
 MKLDNNMemoryInputNode::MKLDNNMemoryInputNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
-        : MKLDNNInputNode(op, eng, cache), MKLDNNMemoryNode(op), dataStore(new MKLDNNMemory{eng}) {
+        : MKLDNNInputNode(op, eng, cache), MKLDNNMemoryNode(op), dataStore(new MKLDNNMemory{eng}),
+          storeBuffer(new MKLDNNMemory{eng}) {
     std::string errorMessage;
     if (!isSupportedOperation(op, errorMessage)) {
         IE_THROW(NotImplemented) << errorMessage;
@@ -106,7 +107,9 @@ void MKLDNNMemoryInputNode::createPrimitive() {
     MKLDNNInputNode::createPrimitive();
 
     auto mem_desc = getChildEdgeAt(0)->getMemoryPtr()->GetDescriptor();
-    dataStore->Create(mem_desc);
+    // the store doesn't own its buffer, so it can be bound to the state of an infer request and back
+    storeBuffer->Create(mem_desc);
+    dataStore->Create(mem_desc, storeBuffer->GetData());
 
     // default memory state is zero filled
     dataStore->FillZero();
@@ -138,6 +141,14 @@ MKLDNNMemoryPtr MKLDNNMemoryInputNode::getStore() {
     return dataStore;
 }
 
+void MKLDNNMemoryInputNode::bindStore(void* ptr) {
+    dataStore->GetPrimitivePtr()->set_data_handle(ptr);
+}
+
+void MKLDNNMemoryInputNode::unbindStore() {
+    dataStore->GetPrimitivePtr()->set_data_handle(storeBuffer->GetData());
+}
+
 void MKLDNNMemoryInputNode::storeState(const MKLDNNMemory &new_state) {
     // TODO: Should be next one call:
     //           dataStore.SetData(new_state, false);
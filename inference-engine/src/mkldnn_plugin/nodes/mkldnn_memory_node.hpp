@@ -96,8 +96,18 @@ public:
     void setInputNode(MKLDNNNode* node) override {}
     void storeState(const MKLDNNMemory& mem);
     MKLDNNMemoryPtr getStore();
+    /**
+     * @brief Makes the state storage use the external buffer (e.g. state blob owned by the infer request)
+     * @param ptr pointer to the buffer of the same size as the storage
+     */
+    void bindStore(void* ptr);
+    /**
+     * @brief Makes the state storage use the node's own buffer again
+     */
+    void unbindStore();
  private:
     MKLDNNMemoryPtr dataStore;
+    MKLDNNMemoryPtr storeBuffer;
     MKLDNNMemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
@@ -184,7 +184,7 @@ void MKLDNNProposalNode::execute(mkldnn::stream strm) {
         }
 
         InferenceEngine::Extensions::Cpu::XARCH::proposal_exec(probabilitiesData, anchorsData, inProbDims,
-                {imgHeight, imgWidth, scaleHeight, scaleWidth}, anchors.data(), roi_indices.data(), outRoiData, outProbData, conf);
+                {imgHeight, imgWidth, scaleHeight, scaleWidth}, anchors.data(), roi_indices.data(), outRoiData, outProbData, conf, scratch);
     } catch (const InferenceEngine::Exception& e) {
         std::string errorMsg = e.what();
         IE_THROW() << errorMsg;
@@ -9,6 +9,7 @@
 #include "proposal_imp.hpp"
 
 using proposal_conf = InferenceEngine::Extensions::Cpu::proposal_conf;
+using proposal_scratch = InferenceEngine::Extensions::Cpu::proposal_scratch;
 
 namespace MKLDNNPlugin {
 
@@ -34,6 +35,7 @@ private:
     proposal_conf conf;
     std::vector<float> anchors;
     std::vector<int> roi_indices;
+    proposal_scratch scratch;
     bool store_prob;  // store blob with proposal probabilities
 
     std::string errorPrefix;
@@ -133,6 +133,7 @@ void MKLDNNReorderNode::createReorderPrimitive(const mkldnn::memory::desc &srcDe
         attr.set_output_scales(mask, scales);
     }
 
+    std::shared_ptr<mkldnn::primitive> reorderPrim;
     auto createReorder = [&]() -> bool {
         // No autoblocking. Reorder can be applied as is
         reorder::primitive_desc pd = mkldnn::reorder::primitive_desc(src_blocked->GetPrimitive(), dst_blocked->GetPrimitive(), attr, true);
@@ -143,7 +144,8 @@ void MKLDNNReorderNode::createReorderPrimitive(const mkldnn::memory::desc &srcDe
         auto info = pd.impl_info_str();
         supportedPrimitiveDescriptors[0].setImplementationType(parse_impl_name(info));
 
-        prim.reset(new mkldnn::reorder(pd));
+        reorderPrim = std::make_shared<mkldnn::reorder>(pd);
+        prim = reorderPrim;
         return true;
     };
 
@@ -175,6 +177,9 @@ void MKLDNNReorderNode::createReorderPrimitive(const mkldnn::memory::desc &srcDe
         IE_THROW() << "Cannot create reorder primitive: unsupported reorder case";
     }
 
+    if (dstDesc.data.ndims > 0)
+        batchPrimitives[static_cast<int>(dstDesc.data.dims[0])] = {reorderPrim, src_blocked, dst_blocked};
+
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     primArgs = {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}};
@@ -193,7 +198,7 @@ void MKLDNNReorderNode::optimizedNcsp2Nspc() {
     auto parentEdge = getParentEdgeAt(0);
     auto childEdge = getChildEdgeAt(0);
     const int ndims = parentEdge->getDims().ndims();
-    const size_t DIM0 = parentEdge->getDims()[0];
+    const size_t DIM0 = batchToProcess();
     const size_t DIM1 = parentEdge->getDims()[1];
     const size_t DIM2 = ndims == 5 ? parentEdge->getDims()[ndims - 3] : 1;
     const size_t DIM3 = parentEdge->getDims()[ndims - 2];
@@ -222,7 +227,7 @@ void MKLDNNReorderNode::optimizedNspc2Ncsp() {
     auto parentEdge = getParentEdgeAt(0);
     auto childEdge = getChildEdgeAt(0);
     const int ndims = parentEdge->getDims().ndims();
-    const size_t DIM0 = parentEdge->getDims()[0];
+    const size_t DIM0 = batchToProcess();
     const size_t DIM1 = parentEdge->getDims()[1];
     const size_t DIM2 = ndims == 5 ? parentEdge->getDims()[ndims - 3] : 1;
     const size_t DIM3 = parentEdge->getDims()[ndims - 2];
@@ -263,6 +268,14 @@ void MKLDNNReorderNode::execute(mkldnn::stream strm) {
 void MKLDNNReorderNode::setDynamicBatchLim(int lim) {
     dynBatchLim = lim;
     if (prim) {
+        auto cached = batchPrimitives.find(batchToProcess());
+        if (cached != batchPrimitives.end()) {
+            prim = cached->second.prim;
+            src_blocked = cached->second.src_blocked;
+            dst_blocked = cached->second.dst_blocked;
+            return;
+        }
+
         auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
         auto &srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
         memory::desc src_d = srcMemPtr->GetDescriptor();
@@ -9,6 +9,7 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include <unordered_map>
 
 namespace MKLDNNPlugin {
 
@@ -54,6 +55,14 @@ private:
     MKLDNNMemoryPtr dst_blocked;
     MKLDNNMemoryPtr src_blocked;
 
+    struct BatchPrimitive {
+        std::shared_ptr<mkldnn::primitive> prim;
+        MKLDNNMemoryPtr src_blocked;
+        MKLDNNMemoryPtr dst_blocked;
+    };
+    // reorder primitives created for the different batch sizes (dynamic batch case)
+    std::unordered_map<int, BatchPrimitive> batchPrimitives;
+
     bool isOptimized = false;
     bool canUseOptimizedNspc2Ncsp = false;
     bool canUseOptimizedNcsp2Nspc = false;
@@ -14,15 +14,179 @@
 #include "ie_parallel.hpp"
 #include <mkldnn_selective_build.h>
 #include <ngraph/opsets/opset3.hpp>
+#include "emitters/jit_load_store_emitters.hpp"
+
+#include <cpu/x64/jit_generator.hpp>
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 using namespace mkldnn;
+using namespace mkldnn::impl;
 using namespace mkldnn::impl::cpu;
 using namespace mkldnn::impl::cpu::x64;
+using namespace Xbyak;
 
 using ngPoolingMode = ngraph::op::v3::ROIAlign::PoolingMode;
 
+#define GET_OFF(field) offsetof(jit_roi_align_call_args, field)
+
+template <cpu_isa_t isa>
+struct jit_uni_roi_align_kernel_f32 : public jit_uni_roi_align_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_roi_align_kernel_f32);
+
+    explicit jit_uni_roi_align_kernel_f32(jit_roi_align_params jcp) : jit_uni_roi_align_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    };
+
+    void generate() override {
+        load_emitter.reset(new jit_load_emitter(this, isa, nullptr));
+        store_emitter.reset(new jit_store_emitter(this, isa, nullptr));
+
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_offsets, ptr[reg_params + GET_OFF(offsets)]);
+        mov(reg_weights, ptr[reg_params + GET_OFF(weights)]);
+        mov(reg_c_groups, ptr[reg_params + GET_OFF(c_groups)]);
+        // each sample consists of 4 offsets
+        mov(reg_offsets_end, ptr[reg_params + GET_OFF(num_samples)]);
+        shl(reg_offsets_end, 4);
+        add(reg_offsets_end, reg_offsets);
+        if (jcp_.alg == Algorithm::ROIAlignAvg)
+            uni_vbroadcastss(vmm_scale, ptr[reg_params + GET_OFF(scale)]);
+
+        load_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx()), static_cast<size_t>(reg_load_table.getIdx())};
+        store_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx())};
+        store_pool_vec_idxs = {static_cast<size_t>(vmm_zero.getIdx())};
+        uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+
+        const int full_chunks = jcp_.c_inner / step;
+        const int tail = jcp_.c_inner % step;
+
+        Label group_loop_label;
+        Label exit_label;
+        L(group_loop_label); {
+            cmp(reg_c_groups, 0);
+            je(exit_label, T_NEAR);
+
+            mov(aux_reg_src, reg_src);
+            mov(aux_reg_dst, reg_dst);
+            if (full_chunks > 0) {
+                Label chunk_loop_label;
+                mov(reg_chunks, full_chunks);
+                L(chunk_loop_label); {
+                    pool(step);
+
+                    add(aux_reg_src, step * jcp_.data_size);
+                    add(aux_reg_dst, step * jcp_.data_size);
+                    dec(reg_chunks);
+                    jnz(chunk_loop_label, T_NEAR);
+                }
+            }
+            if (tail > 0)
+                pool(tail);
+
+            add(reg_src, jcp_.src_group_stride * jcp_.data_size);
+            add(reg_dst, jcp_.dst_group_stride * jcp_.data_size);
+            dec(reg_c_groups);
+            jmp(group_loop_label, T_NEAR);
+        }
+        L(exit_label);
+
+        this->postamble();
+
+        load_emitter->emit_data();
+        store_emitter->emit_data();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xbyak::Xmm, isa == cpu::x64::avx2,
+            Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int step = vlen / sizeof(float);
+
+    Vmm vmm_zero = Vmm(0);
+    Vmm vmm_acc = Vmm(1);
+    Vmm vmm_src = Vmm(2);
+    Vmm vmm_weight = Vmm(3);
+    Vmm vmm_sample = Vmm(4);
+    Vmm vmm_scale = Vmm(5);
+
+    std::unique_ptr<jit_load_emitter> load_emitter = nullptr;
+    std::vector<size_t> load_pool_gpr_idxs;
+
+    std::unique_ptr<jit_store_emitter> store_emitter = nullptr;
+    std::vector<size_t> store_pool_gpr_idxs;
+    std::vector<size_t> store_pool_vec_idxs;
+
+    using reg64_t = const Xbyak::Reg64;
+    reg64_t reg_src = r8;
+    reg64_t reg_dst = r9;
+    reg64_t reg_offsets = r10;
+    reg64_t reg_weights = r11;
+    reg64_t reg_offsets_end = r12;
+    reg64_t reg_c_groups = r13;
+    reg64_t reg_chunks = r14;
+    reg64_t aux_reg_src = rax;
+    reg64_t aux_reg_dst = rbx;
+    reg64_t aux_reg_offsets = rdx;
+    reg64_t aux_reg_weights = rsi;
+    reg64_t reg_tmp = rbp;
+
+    reg64_t reg_load_table = r15;
+    reg64_t reg_params = abi_param1;
+    // params are read in the very beginning, so the register is reused
+    reg64_t reg_load_store_mask = abi_param1;
+
+    // pools load_num channels over all the samples of the bin
+    void pool(int load_num) {
+        Label sample_loop_label;
+
+        uni_vpxor(vmm_acc, vmm_acc, vmm_acc);
+        mov(aux_reg_offsets, reg_offsets);
+        mov(aux_reg_weights, reg_weights);
+
+        const auto load_context = std::make_shared<load_emitter_context>(jcp_.data_prc, Precision::FP32, load_num);
+        L(sample_loop_label); {
+            for (int i = 0; i < 4; i++) {
+                movsxd(reg_tmp, dword[aux_reg_offsets + i * sizeof(int)]);
+                lea(reg_tmp, ptr[aux_reg_src + reg_tmp * jcp_.data_size]);
+                load_emitter->emit_code({static_cast<size_t>(reg_tmp.getIdx())}, {static_cast<size_t>(vmm_src.getIdx())},
+                                        load_context, {}, load_pool_gpr_idxs);
+                uni_vbroadcastss(vmm_weight, ptr[aux_reg_weights + i * sizeof(float)]);
+
+                if (jcp_.alg == Algorithm::ROIAlignAvg) {
+                    uni_vfmadd231ps(vmm_acc, vmm_src, vmm_weight);
+                } else if (i == 0) {
+                    uni_vmulps(vmm_sample, vmm_src, vmm_weight);
+                } else {
+                    uni_vmulps(vmm_src, vmm_src, vmm_weight);
+                    uni_vmaxps(vmm_sample, vmm_sample, vmm_src);
+                }
+            }
+            if (jcp_.alg == Algorithm::ROIAlignMax)
+                uni_vmaxps(vmm_acc, vmm_acc, vmm_sample);
+
+            add(aux_reg_offsets, 4 * sizeof(int));
+            add(aux_reg_weights, 4 * sizeof(float));
+            cmp(aux_reg_offsets, reg_offsets_end);
+            jb(sample_loop_label, T_NEAR);
+        }
+
+        if (jcp_.alg == Algorithm::ROIAlignAvg)
+            uni_vmulps(vmm_acc, vmm_acc, vmm_scale);
+
+        store_emitter->emit_code({static_cast<size_t>(vmm_acc.getIdx())}, {static_cast<size_t>(aux_reg_dst.getIdx())},
+                                 std::make_shared<store_emitter_context>(Precision::FP32, jcp_.data_prc, load_num),
+                                 store_pool_vec_idxs, store_pool_gpr_idxs);
+    }
+};
+
 bool MKLDNNROIAlignNode::isSupportedOperation(const std::shared_ptr<ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
         const auto roiAlign = std::dynamic_pointer_cast<const ngraph::opset3::ROIAlign>(op);
@@ -46,7 +210,7 @@ MKLDNNROIAlignNode::MKLDNNROIAlignNode(const std::shared_ptr<ngraph::Node>& op,
                                        MKLDNNWeightsSharing::Ptr &cache) : MKLDNNNode(op, eng, cache) {
     std::string errorMessage;
     if (isSupportedOperation(op, errorMessage)) {
-        errorPrefix = "ROIPooling layer with name '" + getName() + "' ";
+        errorPrefix = "ROIAlign layer with name '" + getName() + "' ";
 
         const auto roiAlign = std::dynamic_pointer_cast<const ngraph::opset3::ROIAlign>(op);
         pooledH = roiAlign->get_pooled_h();
@@ -128,13 +292,66 @@ void MKLDNNROIAlignNode::initSupportedPrimitiveDescriptors() {
             {memory::format_tag::nChw8c, memory::format_tag::nChw8c}
     };
 
+    impl_desc_type impl_type;
+    if (mayiuse(cpu::x64::avx512_common)) {
+        impl_type = impl_desc_type::jit_avx512;
+    } else if (mayiuse(cpu::x64::avx2)) {
+        impl_type = impl_desc_type::jit_avx2;
+    } else if (mayiuse(cpu::x64::sse41)) {
+        impl_type = impl_desc_type::jit_sse42;
+    } else {
+        impl_type = impl_desc_type::ref;
+    }
+
     for (auto fmts : supportedFormats) {
         config.inConfs[0].desc = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), inputDataType, fmts.first);
         config.inConfs[1].desc = MKLDNNMemoryDesc(getParentEdgeAt(1)->getDims(), memory::data_type::f32, memory::format_tag::nc);
         config.inConfs[2].desc = MKLDNNMemoryDesc(getParentEdgeAt(2)->getDims(), memory::data_type::s32, memory::format_tag::x);
         config.outConfs[0].desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, fmts.second);
-        supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown, fmts.second});
+        supportedPrimitiveDescriptors.push_back({config, impl_type, fmts.second});
+    }
+}
+
+void MKLDNNROIAlignNode::createPrimitive() {
+    auto selectedPD = getSelectedPrimitiveDescriptor();
+    if (!selectedPD)
+        IE_THROW() << errorPrefix << "doesn't have primitive descriptors.";
+
+    auto &srcMemory = getParentEdgeAt(0)->getMemory();
+    auto &dstMemory = getChildEdgeAt(0)->getMemory();
+    const auto &srcBlockDesc = srcMemory.GetDescriptor().data.format_desc.blocking;
+    const auto &dstBlockDesc = dstMemory.GetDescriptor().data.format_desc.blocking;
+
+    // channels are split into groups of contiguous values: blocks for the blocked layouts, all channels for nhwc
+    // and single channel for nchw
+    const int C = static_cast<int>(srcMemory.GetDims()[1]);
+    if (srcBlockDesc.inner_nblks > 0) {
+        jcp.c_inner = srcBlockDesc.inner_blks[0];
+        cGroups = srcMemory.GetDescriptor().data.padded_dims[1] / jcp.c_inner;
+    } else if (srcMemory.GetDesc().isTailCFormat()) {
+        jcp.c_inner = C;
+        cGroups = 1;
+    } else {
+        jcp.c_inner = 1;
+        cGroups = C;
+    }
+    jcp.src_group_stride = srcBlockDesc.strides[1];
+    jcp.dst_group_stride = dstBlockDesc.strides[1];
+
+    jcp.alg = getAlgorithm();
+    jcp.data_prc = selectedPD->getConfig().inConfs[0].desc.getPrecision();
+    jcp.data_size = jcp.data_prc.size();
+
+    if (mayiuse(cpu::x64::avx512_common)) {
+        roi_align_kernel.reset(new jit_uni_roi_align_kernel_f32<cpu::x64::avx512_common>(jcp));
+    } else if (mayiuse(cpu::x64::avx2)) {
+        roi_align_kernel.reset(new jit_uni_roi_align_kernel_f32<cpu::x64::avx2>(jcp));
+    } else if (mayiuse(cpu::x64::sse41)) {
+        roi_align_kernel.reset(new jit_uni_roi_align_kernel_f32<cpu::x64::sse41>(jcp));
     }
+
+    if (roi_align_kernel)
+        roi_align_kernel->create_ker();
 }
 
 namespace {
@@ -177,10 +394,6 @@ void MKLDNNROIAlignNode::executeSpecified() {
     auto srcBlockDesc = srcMemory0.GetDescriptor().data.format_desc.blocking;
     auto dstBlockDesc = dstMemory.GetDescriptor().data.format_desc.blocking;
 
-    int blockSize = srcBlockDesc.inner_nblks > 0 ? srcBlockDesc.inner_blks[0] : 1;
-    auto isPlainFmt = srcMemory0.GetDesc().isPlainFormat();
-    auto isNhwcFmt = srcMemory0.GetDesc().isTailCFormat();
-
     const auto *srcData = reinterpret_cast<const inputType *>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr());
     const auto *srcRoi = reinterpret_cast<const float *>(getParentEdgeAt(1)->getMemoryPtr()->GetPtr());
     const auto *srcRoiIdx = reinterpret_cast<const int *>(getParentEdgeAt(2)->getMemoryPtr()->GetPtr());
@@ -189,18 +402,17 @@ void MKLDNNROIAlignNode::executeSpecified() {
     auto nominalRoiCount = static_cast<int>(srcMemory1.GetDims()[0]);
     int realRois = 0;
     auto inputDimVector = srcMemory0.GetDims();
-    const int C = static_cast<int>(inputDimVector[1]);
     const int H = static_cast<int>(inputDimVector[2]);
     const int W = static_cast<int>(inputDimVector[3]);
 
     const int binCount = pooledH * pooledW;
 
+    const size_t batchInputStride = srcBlockDesc.strides[0];
     const int hInputStride = srcBlockDesc.strides[2];
     const int wInputStride = srcBlockDesc.strides[3];
+    const size_t roiOutputStride = dstBlockDesc.strides[0];
     const int hOutputStride = dstBlockDesc.strides[2];
     const int wOutputStride = dstBlockDesc.strides[3];
-    const int chPadding = srcMemory0.GetDescriptor().data.padded_dims[1];
-    const int blockCount = chPadding / blockSize;
 
     for (; realRois < nominalRoiCount; realRois++) {
         auto roiBatchInd = srcRoiIdx[realRois];
@@ -210,163 +422,151 @@ void MKLDNNROIAlignNode::executeSpecified() {
     }
 
     for (int n = 0; n < realRois; ++n) {
-        int roiOff = n * 4;
-        const float* srcRoiPtr = &srcRoi[roiOff];
         int roiBatchInd = srcRoiIdx[n];
         if (roiBatchInd < -1) {  // -1 means switched off region
             IE_THROW() << "Batch index cannot be less, than -1";
         } else if (roiBatchInd >= inputDimVector[0]) {
             IE_THROW() << "Demanded batch (id = " << roiBatchInd << ") doesn't exist";
         }
+    }
 
-        float x1 = srcRoiPtr[0] * spatialScale;
-        float y1 = srcRoiPtr[1] * spatialScale;
-        float x2 = srcRoiPtr[2] * spatialScale;
-        float y2 = srcRoiPtr[3] * spatialScale;
-
-        float roiHeight = std::max(y2 - y1, 1.0f);
-        float roiWidth = std::max(x2 - x1, 1.0f);
-        float binHeight = roiHeight / pooledH;
-        float binWidth = roiWidth / pooledW;
-
-        auto samplingRatioX = samplingRatio == 0 ? static_cast<int>(ceil(binWidth)) : samplingRatio;
-        auto samplingRatioY = samplingRatio == 0 ? static_cast<int>(ceil(binHeight)) : samplingRatio;
-
-        uint64_t numSamplesInBin = samplingRatioX * samplingRatioY;
-
-        float sampleDistanceX = binWidth / samplingRatioX;
-        float sampleDistanceY = binHeight / samplingRatioY;
-        // prepare arrays for sampling points and weights
-        std::vector<std::pair<int, int>> pointVector;
-        std::vector<float> weightVector;
-        pointVector.reserve(4 * numSamplesInBin * binCount);
-        weightVector.reserve(4 * numSamplesInBin * binCount);
-
-        for (int yBinInd = 0; yBinInd < pooledH; ++yBinInd) {
-            for (int xBinInd = 0; xBinInd < pooledW; ++xBinInd) {
-                // run into bin
-                for (int ySampleInd = 0; ySampleInd < samplingRatioY; ySampleInd++) {
-                    float sampleY = y1 + yBinInd * binHeight + sampleDistanceY * (0.5f + ySampleInd);
-                    for (int xSampleInd = 0; xSampleInd < samplingRatioX; xSampleInd++) {
-                        float sampleX = x1 + xBinInd * binWidth + sampleDistanceX * (0.5f + xSampleInd);
-                        if (sampleX < -1.0 || sampleX > W ||
-                            sampleY < -1.0 || sampleY > H) {
-                            // For this sample we save 4x point (0,0) with weight 0
-                            pointVector.insert(pointVector.end(), 4, {0, 0});
-                            weightVector.insert(weightVector.end(), 4, float{0});
-                            continue;
-                        }
-                        sampleX = std::max(sampleX, float{0});
-                        sampleY = std::max(sampleY, float{0});
-
-                        auto sampleYLow = static_cast<unsigned int>(sampleY);
-                        auto sampleXLow = static_cast<unsigned int>(sampleX);
-                        unsigned int sampleYHigh;
-                        unsigned int sampleXHigh;
-                        if (sampleYLow >= H - 1) {
-                            sampleYHigh = sampleYLow = H - 1;
-                            sampleY = static_cast<float>(sampleYLow);
-                        } else {
-                            sampleYHigh = sampleYLow + 1;
-                        }
-                        if (sampleXLow >= W - 1) {
-                            sampleXHigh = sampleXLow = W - 1;
-                            sampleX = static_cast<float>(sampleXLow);
-                        } else {
-                            sampleXHigh = sampleXLow + 1;
-                        }
-                        pointVector.push_back({sampleYLow, sampleXLow});
-                        pointVector.push_back({sampleYLow, sampleXHigh});
-                        pointVector.push_back({sampleYHigh, sampleXLow});
-                        pointVector.push_back({sampleYHigh, sampleXHigh});
-
-                        // weight calculation for bilinear interpolation
-                        auto ly = sampleY - sampleYLow;
-                        auto lx = sampleX - sampleXLow;
-                        auto hy = 1.0f - ly;
-                        auto hx = 1.0f - lx;
-
-                        weightVector.push_back(hy * hx);
-                        weightVector.push_back(hy * lx);
-                        weightVector.push_back(ly * hx);
-                        weightVector.push_back(ly * lx);
+    const bool isMaxMode = getAlgorithm() == Algorithm::ROIAlignMax;
+
+    // reference pooling of all the channels of the bin with the same semantic as the jit kernel has
+    auto pool = [&](const inputType* binSrc, outputType* binDst, const std::vector<int>& offsets, const std::vector<float>& weights,
+                    size_t numSamplesInBin) {
+        for (int g = 0; g < cGroups; g++) {
+            for (int c = 0; c < jcp.c_inner; c++) {
+                const inputType* channelSrc = binSrc + g * jcp.src_group_stride + c;
+                float pooledValue = 0;
+                for (size_t sampleIndex = 0; sampleIndex < 4 * numSamplesInBin; sampleIndex += 4) {
+                    if (isMaxMode) {
+                        float sampleValue = std::max(
+                                {weights[sampleIndex] * channelSrc[offsets[sampleIndex]],
+                                 weights[sampleIndex + 1] * channelSrc[offsets[sampleIndex + 1]],
+                                 weights[sampleIndex + 2] * channelSrc[offsets[sampleIndex + 2]],
+                                 weights[sampleIndex + 3] * channelSrc[offsets[sampleIndex + 3]]});
+                        pooledValue = sampleValue > pooledValue ? sampleValue : pooledValue;
+                    } else {
+                        pooledValue += weights[sampleIndex] * channelSrc[offsets[sampleIndex]] +
+                                       weights[sampleIndex + 1] * channelSrc[offsets[sampleIndex + 1]] +
+                                       weights[sampleIndex + 2] * channelSrc[offsets[sampleIndex + 2]] +
+                                       weights[sampleIndex + 3] * channelSrc[offsets[sampleIndex + 3]];
                     }
                 }
+                if (!isMaxMode)
+                    pooledValue /= numSamplesInBin;
+                binDst[g * jcp.dst_group_stride + c] = pooledValue;
             }
         }
-        auto pool = [&] (int xBinInd_, int yBinInd_, int binOffsetInput_, int binOffsetOutput_, int blockResidual_) {
-            float pooledValue = 0;
-            unsigned int sampleIndex = 4 * (yBinInd_ * pooledW + xBinInd_) * numSamplesInBin;
-            for (unsigned int binSampleInd = 0; binSampleInd < numSamplesInBin; binSampleInd++) {
-                size_t part1Index = binOffsetInput_ + pointVector[sampleIndex].first * hInputStride +
-                                    pointVector[sampleIndex].second * wInputStride + blockResidual_;
-                float part1 = srcData[part1Index];
-                size_t part2Index = binOffsetInput_ + pointVector[sampleIndex + 1].first * hInputStride +
-                                    pointVector[sampleIndex + 1].second * wInputStride + blockResidual_;
-                float part2 = srcData[part2Index];
-                size_t part3Index = binOffsetInput_ + pointVector[sampleIndex + 2].first * hInputStride +
-                                    pointVector[sampleIndex + 2].second * wInputStride + blockResidual_;
-                float part3 = srcData[part3Index];
-                size_t part4Index = binOffsetInput_ + pointVector[sampleIndex + 3].first * hInputStride +
-                                    pointVector[sampleIndex + 3].second * wInputStride + blockResidual_;
-                float part4 = srcData[part4Index];
-
-                switch (getAlgorithm()) {
-                    case Algorithm::ROIAlignMax:
-                    {
-                        float sampleValue = std::max(
-                                {weightVector[sampleIndex] * part1,
-                                 weightVector[sampleIndex + 1] * part2,
-                                 weightVector[sampleIndex + 2] * part3,
-                                 weightVector[sampleIndex + 3] * part4});
-                        pooledValue = sampleValue > pooledValue ? sampleValue : pooledValue;
-                        break;
+    };
+
+    // every ROI bin is an independent work item: sampling points are computed for the bin and all its channels
+    // are pooled at once
+    const size_t workAmount = static_cast<size_t>(realRois) * binCount;
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(workAmount, nthr, ithr, start, end);
+
+        std::vector<int> offsets;
+        std::vector<float> weights;
+        for (size_t iwork = start; iwork < end; ++iwork) {
+            const int n = static_cast<int>(iwork / binCount);
+            const int yBinInd = static_cast<int>(iwork % binCount) / pooledW;
+            const int xBinInd = static_cast<int>(iwork % binCount) % pooledW;
+
+            const float* srcRoiPtr = &srcRoi[n * 4];
+            const int roiBatchInd = srcRoiIdx[n];
+
+            float x1 = srcRoiPtr[0] * spatialScale;
+            float y1 = srcRoiPtr[1] * spatialScale;
+            float x2 = srcRoiPtr[2] * spatialScale;
+            float y2 = srcRoiPtr[3] * spatialScale;
+
+            float roiHeight = std::max(y2 - y1, 1.0f);
+            float roiWidth = std::max(x2 - x1, 1.0f);
+            float binHeight = roiHeight / pooledH;
+            float binWidth = roiWidth / pooledW;
+
+            auto samplingRatioX = samplingRatio == 0 ? static_cast<int>(ceil(binWidth)) : samplingRatio;
+            auto samplingRatioY = samplingRatio == 0 ? static_cast<int>(ceil(binHeight)) : samplingRatio;
+
+            size_t numSamplesInBin = samplingRatioX * samplingRatioY;
+
+            float sampleDistanceX = binWidth / samplingRatioX;
+            float sampleDistanceY = binHeight / samplingRatioY;
+
+            offsets.clear();
+            weights.clear();
+            for (int ySampleInd = 0; ySampleInd < samplingRatioY; ySampleInd++) {
+                float sampleY = y1 + yBinInd * binHeight + sampleDistanceY * (0.5f + ySampleInd);
+                for (int xSampleInd = 0; xSampleInd < samplingRatioX; xSampleInd++) {
+                    float sampleX = x1 + xBinInd * binWidth + sampleDistanceX * (0.5f + xSampleInd);
+                    if (sampleX < -1.0 || sampleX > W ||
+                        sampleY < -1.0 || sampleY > H) {
+                        // For this sample we save 4x point (0,0) with weight 0
+                        offsets.insert(offsets.end(), 4, 0);
+                        weights.insert(weights.end(), 4, float{0});
+                        continue;
+                    }
+                    sampleX = std::max(sampleX, float{0});
+                    sampleY = std::max(sampleY, float{0});
+
+                    auto sampleYLow = static_cast<unsigned int>(sampleY);
+                    auto sampleXLow = static_cast<unsigned int>(sampleX);
+                    unsigned int sampleYHigh;
+                    unsigned int sampleXHigh;
+                    if (sampleYLow >= H - 1) {
+                        sampleYHigh = sampleYLow = H - 1;
+                        sampleY = static_cast<float>(sampleYLow);
+                    } else {
+                        sampleYHigh = sampleYLow + 1;
                     }
-                    case Algorithm::ROIAlignAvg:
-                    default:
-                    {
-                        float sampleValue =
-                                weightVector[sampleIndex] * part1 +
-                                weightVector[sampleIndex + 1] * part2 +
-                                weightVector[sampleIndex + 2] * part3 +
-                                weightVector[sampleIndex + 3] * part4;
-                        pooledValue += sampleValue / numSamplesInBin;
+                    if (sampleXLow >= W - 1) {
+                        sampleXHigh = sampleXLow = W - 1;
+                        sampleX = static_cast<float>(sampleXLow);
+                    } else {
+                        sampleXHigh = sampleXLow + 1;
                     }
+                    offsets.push_back(sampleYLow * hInputStride + sampleXLow * wInputStride);
+                    offsets.push_back(sampleYLow * hInputStride + sampleXHigh * wInputStride);
+                    offsets.push_back(sampleYHigh * hInputStride + sampleXLow * wInputStride);
+                    offsets.push_back(sampleYHigh * hInputStride + sampleXHigh * wInputStride);
+
+                    // weight calculation for bilinear interpolation
+                    auto ly = sampleY - sampleYLow;
+                    auto lx = sampleX - sampleXLow;
+                    auto hy = 1.0f - ly;
+                    auto hx = 1.0f - lx;
+
+                    weights.push_back(hy * hx);
+                    weights.push_back(hy * lx);
+                    weights.push_back(ly * hx);
+                    weights.push_back(ly * lx);
                 }
-                sampleIndex += 4;
             }
-            size_t dstIndex = binOffsetOutput_ + yBinInd_ * hOutputStride +
-                              xBinInd_ * wOutputStride + blockResidual_;
-            dst[dstIndex] = pooledValue;
-        };
-        if (isNhwcFmt) {
-            parallel_for2d(pooledH, pooledW, [&](int yBinInd, int xBinInd) {
-                for (int c = 0; c < C; c++) {
-                    size_t binOffsetInput = roiBatchInd * C * H * W + c;
-                    size_t binOffsetOutput = n * C * binCount + c;
-                    pool(xBinInd, yBinInd, binOffsetInput, binOffsetOutput, 0);
-                }
-            });
-        } else {  // nchw, nChw16c, nChw8c
-            parallel_for3d(blockCount, pooledH, pooledW, [&](int blkIdx, int yBinInd, int xBinInd) {
-                int cStart = blkIdx * blockSize;
-                int cEnd = (blkIdx == blockCount - 1 ? C : cStart + blockSize);
-                for (int c = cStart; c < cEnd; c++) {
-                    const int blockResidual = (isPlainFmt ? 0 : c % blockSize);
-                    const int blockIdx = (c / blockSize) * blockSize;
-                    size_t binOffsetInput = (roiBatchInd * chPadding + blockIdx) * H * W;
-                    size_t binOffsetOutput = (n * chPadding + blockIdx) * binCount;
-                    pool(xBinInd, yBinInd, binOffsetInput, binOffsetOutput, blockResidual);
-                }
-            });
+
+            const inputType* binSrc = srcData + roiBatchInd * batchInputStride;
+            outputType* binDst = dst + n * roiOutputStride + yBinInd * hOutputStride + xBinInd * wOutputStride;
+            if (roi_align_kernel) {
+                auto arg = jit_roi_align_call_args();
+                arg.src = binSrc;
+                arg.dst = binDst;
+                arg.offsets = offsets.data();
+                arg.weights = weights.data();
+                arg.num_samples = numSamplesInBin;
+                arg.c_groups = cGroups;
+                arg.scale = 1.0f / numSamplesInBin;
+                (*roi_align_kernel)(&arg);
+            } else {
+                pool(binSrc, binDst, offsets, weights, numSamplesInBin);
+            }
         }
-    }
+    });
 }
 
 bool MKLDNNROIAlignNode::created() const {
     return getType() == ROIAlign;
 }
 
-void MKLDNNROIAlignNode::createPrimitive() {}
-
 REG_MKLDNN_PRIM_FOR(MKLDNNROIAlignNode, ROIAlign)
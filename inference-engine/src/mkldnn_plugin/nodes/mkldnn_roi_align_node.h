@@ -13,6 +13,44 @@
 
 namespace MKLDNNPlugin {
 
+struct jit_roi_align_params {
+    Algorithm alg;
+    InferenceEngine::Precision data_prc;
+    int data_size;
+
+    // channels are processed in groups of c_inner contiguous values
+    int c_inner;
+    size_t src_group_stride;
+    size_t dst_group_stride;
+};
+
+struct jit_roi_align_call_args {
+    const void *src;
+    void *dst;
+    // 4 offsets (in elements relative to src) and 4 bilinear weights per sample
+    const int *offsets;
+    const float *weights;
+    size_t num_samples;
+    size_t c_groups;
+    float scale;
+};
+
+struct jit_uni_roi_align_kernel {
+    void (*ker_)(const jit_roi_align_call_args *);
+
+    void operator()(const jit_roi_align_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_roi_align_kernel(jit_roi_align_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_roi_align_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_roi_align_params jcp_;
+};
+
 class MKLDNNROIAlignNode : public MKLDNNNode {
 public:
     MKLDNNROIAlignNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
@@ -35,6 +73,10 @@ private:
     template<typename T>
     struct ROIAlignExecute;
 
+    jit_roi_align_params jcp = {};
+    int cGroups = 0;
+    std::shared_ptr<jit_uni_roi_align_kernel> roi_align_kernel = nullptr;
+
     std::string errorPrefix;
 };
 
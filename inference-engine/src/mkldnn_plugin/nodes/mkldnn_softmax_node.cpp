@@ -5,18 +5,33 @@
 #include "mkldnn_softmax_node.h"
 
 #include <string>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include <mkldnn_selective_build.h>
+#include <ie_parallel.hpp>
+#include "mkldnn_fake_quantize_node.h"
+#include "mkldnn_eltwise_node.h"
+#include "utils/bfloat16.hpp"
+#include "utils/general_utils.h"
+#include "utils/cpu_utils.hpp"
+#include <cpu/x64/cpu_isa_traits.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
 
 MKLDNNSoftMaxNode::MKLDNNSoftMaxNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache) :
         MKLDNNNode(op, eng, cache) {
     const auto softmaxOp = ngraph::as_type_ptr<ngraph::op::v1::Softmax>(op);
     if (softmaxOp) {
         axis = softmaxOp->get_axis();
+        errorPrefix = "Softmax node with name '" + op->get_friendly_name() + "'";
     } else {
         IE_THROW(NotImplemented)
                 << "CPU Softmax node doesn't support ngraph operation " << op->get_type_name() << " with name " << op->get_friendly_name();
@@ -32,11 +47,15 @@ void MKLDNNSoftMaxNode::getSupportedDescriptors() {
         precision = InferenceEngine::Precision::FP32;
     auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(precision);
 
-    if (getParentEdges().size() != 1)
+    if (getParentEdges().size() != (withMask ? 2 : 1))
         IE_THROW() << "Incorrect number of input edges for layer " << getName();
     if (!getChildEdges().size())
         IE_THROW() << "Incorrect number of output edges for layer " << getName();
 
+    // oneDNN softmax primitive doesn't support pre/post operations, so fused case is handled by the node itself
+    if (useFusedImpl())
+        return;
+
     if (getParentEdgeAt(0)->getDims().ndims() == 3) {
         MKLDNNMemoryDesc in_candidate(getParentEdgeAt(0)->getDims(), inputDataType, memory::format_tag::abc);
         createDescriptor({in_candidate}, {});
@@ -53,7 +72,173 @@ void MKLDNNSoftMaxNode::getSupportedDescriptors() {
     }
 }
 
+void MKLDNNSoftMaxNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    if (!useFusedImpl()) {
+        MKLDNNNode::initSupportedPrimitiveDescriptors();
+        return;
+    }
+
+    setPostOps(attr);
+
+    inputPrecision = getOriginalInputPrecisionAtPort(DATA);
+    if (!one_of(inputPrecision, Precision::FP32, Precision::BF16))
+        inputPrecision = Precision::FP32;
+
+    outputPrecision = getOriginalOutputPrecisionAtPort(0);
+    if (!fusedWith.empty())
+        outputPrecision = fusedWith[fusedWith.size() - 1]->getOriginalOutputPrecisionAtPort(0);
+    if (!one_of(outputPrecision, Precision::FP32, Precision::BF16, Precision::I8, Precision::U8))
+        outputPrecision = Precision::FP32;
+
+    std::vector<DataConfigurator> inDataConf = {{TensorDescCreatorTypes::ncsp, inputPrecision}};
+    if (withMask)
+        inDataConf.push_back({TensorDescCreatorTypes::ncsp, Precision::FP32});
+
+    impl_desc_type impl_type;
+    if (mayiuse(cpu::x64::avx512_common)) {
+        impl_type = impl_desc_type::jit_avx512;
+    } else if (mayiuse(cpu::x64::avx2)) {
+        impl_type = impl_desc_type::jit_avx2;
+    } else if (mayiuse(cpu::x64::sse41)) {
+        impl_type = impl_desc_type::jit_sse42;
+    } else {
+        impl_type = impl_desc_type::ref_any;
+    }
+
+    addSupportedPrimDesc(inDataConf,
+                         {{TensorDescCreatorTypes::ncsp, outputPrecision}},
+                         impl_type);
+}
+
+bool MKLDNNSoftMaxNode::canFuse(const MKLDNNNodePtr& node) const {
+    if (node->getType() == Convert)
+        return one_of(node->getOriginalOutputPrecisionAtPort(0), Precision::FP32, Precision::BF16);
+
+    // the kernel vectorizes over the inner dimensions, so channels may differ between lanes of softmax over batch
+    const auto dims = getParentEdgeAt(DATA)->getDims().ToSizeVector();
+    if (axis == 0 && std::accumulate(dims.begin() + 1, dims.end(), size_t(1), std::multiplies<size_t>()) > 1)
+        return false;
+
+    return canFuseSimpleOperation(node);
+}
+
+void MKLDNNSoftMaxNode::fuseScale(float value) {
+    scale *= value;
+    withScale = true;
+}
+
+void MKLDNNSoftMaxNode::fuseMask() {
+    withMask = true;
+}
+
+void MKLDNNSoftMaxNode::setPostOps(mkldnn::primitive_attr &attr) {
+    mkldnn::post_ops ops;
+
+    for (auto &node : fusedWith) {
+        // Convert is fully described by the output precision
+        if (node->getType() == Convert)
+            continue;
+
+        auto* fakeQuantizeNode = dynamic_cast<MKLDNNFakeQuantizeNode *>(node.get());
+        if (fakeQuantizeNode) {
+            fakeQuantizeNode->appendPostOps(ops);
+            continue;
+        }
+
+        auto* eltwiseNode = dynamic_cast<MKLDNNEltwiseNode *>(node.get());
+        if (eltwiseNode) {
+            eltwiseNode->appendPostOps(ops);
+            continue;
+        }
+
+        IE_THROW() << "Fusing of " << NameFromType(node->getType()) << " operation to " << NameFromType(this->getType()) << " node is not implemented";
+    }
+
+    attr.set_post_ops(ops);
+}
+
 void MKLDNNSoftMaxNode::createPrimitive() {
+    if (useFusedImpl()) {
+        if (getSelectedPrimitiveDescriptor() == nullptr)
+            IE_THROW() << errorPrefix << " has nullable preferable primitive descriptor";
+
+        dataDims = getParentEdgeAt(DATA)->getDims().ToSizeVector();
+        const size_t rank = dataDims.size();
+        if (axis >= rank)
+            IE_THROW() << errorPrefix << " has incorrect axis " << axis << " for input rank " << rank;
+
+        outerSize = std::accumulate(dataDims.begin(), dataDims.begin() + axis, size_t(1), std::multiplies<size_t>());
+        axisSize = dataDims[axis];
+        innerSize = std::accumulate(dataDims.begin() + axis + 1, dataDims.end(), size_t(1), std::multiplies<size_t>());
+        channelsNum = rank > 1 ? dataDims[1] : 1;
+        channelAxisStride = rank > 1 ? std::accumulate(dataDims.begin() + 2, dataDims.end(), size_t(1), std::multiplies<size_t>()) : 1;
+
+        maskStrides.assign(rank, 0);
+        if (withMask) {
+            const auto maskDims = getNormalizedDimsBySize(getParentEdgeAt(MASK)->getDims().ToSizeVector(), rank);
+            if (maskDims.size() != rank)
+                IE_THROW() << errorPrefix << " has mask with rank greater than data rank";
+            size_t stride = 1;
+            for (int i = static_cast<int>(rank) - 1; i >= 0; i--) {
+                if (maskDims[i] != dataDims[i] && maskDims[i] != 1)
+                    IE_THROW() << errorPrefix << " has mask which is not broadcastable to data shape";
+                maskStrides[i] = maskDims[i] == 1 ? 0 : stride;
+                stride *= maskDims[i];
+            }
+        }
+
+        if (getSelectedPrimitiveDescriptor()->getImplementationType() != impl_desc_type::ref_any) {
+            blockSize = mayiuse(cpu::x64::avx512_common) ? 16 : mayiuse(cpu::x64::avx2) ? 8 : 4;
+
+            auto jcp = jit_softmax_config_params();
+            jcp.src_dt = inputPrecision;
+            jcp.dst_dt = outputPrecision;
+            jcp.along_axis = innerSize == 1;
+            jcp.with_scale = withScale;
+            jcp.scale = scale;
+            jcp.with_mask = withMask;
+            jcp.channel_along_axis = rank > 1 && axis == 1;
+
+            if (jcp.along_axis) {
+                jcp.tail = static_cast<int>(axisSize % blockSize);
+                jcp.broadcast_mask = maskStrides[axis] == 0;
+            } else {
+                // the mask has to be either broadcasted or dense over the inner dimensions
+                const auto maskDims = withMask ? getNormalizedDimsBySize(getParentEdgeAt(MASK)->getDims().ToSizeVector(), rank) : dataDims;
+                jcp.broadcast_mask = std::all_of(maskDims.begin() + axis + 1, maskDims.end(), [](size_t dim) { return dim == 1; });
+                if (!jcp.broadcast_mask && !std::equal(maskDims.begin() + axis + 1, maskDims.end(), dataDims.begin() + axis + 1))
+                    IE_THROW() << errorPrefix << " has mask which is partially broadcasted over the dimensions after the axis";
+            }
+
+            softmaxKernel = createSoftmaxKernel(jcp, *attr.get());
+            if (!jcp.along_axis && innerSize % blockSize != 0) {
+                jcp.tail = static_cast<int>(innerSize % blockSize);
+                softmaxTailKernel = createSoftmaxKernel(jcp, *attr.get());
+            }
+            if (!softmaxKernel)
+                IE_THROW() << errorPrefix << " cannot create jit kernel";
+            return;
+        }
+
+        eltwise_injectors_ref.clear();
+        depthwise_injectors_ref.clear();
+        const auto &p = (*attr.get()).post_ops_;
+        for (int i = 0; i < p.len(); i++) {
+            auto &post_op = p.entry_[i];
+            if (post_op.is_eltwise()) {
+                eltwise_injectors_ref.push_back(std::make_shared<cpu::ref_eltwise_scalar_fwd_t>(
+                    post_op.eltwise.alg, post_op.eltwise.alpha, post_op.eltwise.beta, post_op.eltwise.scale));
+            } else if (post_op.is_depthwise()) {
+                depthwise_injectors_ref.push_back(std::make_shared<cpu::ref_depthwise_scalar_fwd_t>(
+                        post_op.depthwise.alg));
+            }
+        }
+        return;
+    }
+
     if (prim)
         return;
 
@@ -93,6 +278,11 @@ bool MKLDNNSoftMaxNode::created() const {
 }
 
 void MKLDNNSoftMaxNode::initOptimalPrimitiveDescriptor() {
+    if (useFusedImpl()) {
+        MKLDNNNode::initOptimalPrimitiveDescriptor();
+        return;
+    }
+
     auto selected_pd = getSelectedPrimitiveDescriptor();
     if (selected_pd == nullptr)
         IE_THROW() << "Preferable primitive descriptor is not set.";
@@ -118,10 +308,209 @@ void MKLDNNSoftMaxNode::initOptimalPrimitiveDescriptor() {
 
 void MKLDNNSoftMaxNode::createDescriptor(const std::vector<InferenceEngine::TensorDesc> &inputDesc,
                                          const std::vector<InferenceEngine::TensorDesc> &outputDesc) {
+    if (useFusedImpl())
+        return;
+
     MKLDNNMemoryDesc in_candidate(inputDesc[0]);
 
     MKLDNNDescriptor desc(std::shared_ptr<softmax_forward::desc>(
             new softmax_forward::desc(prop_kind::forward_scoring, in_candidate, axis)));
     descs.push_back(desc);
 }
+namespace {
+
+struct SoftmaxContext {
+    MKLDNNSoftMaxNode &node;
+    const uint8_t *src;
+    const float *mask;
+    uint8_t *dst;
+};
+
+template <typename T>
+inline T saturateTo(float value) {
+    return static_cast<T>(value);
+}
+
+template <>
+inline uint8_t saturateTo<uint8_t>(float value) {
+    return static_cast<uint8_t>(std::nearbyint(std::min(std::max(value, 0.f), 255.f)));
+}
+
+template <>
+inline int8_t saturateTo<int8_t>(float value) {
+    return static_cast<int8_t>(std::nearbyint(std::min(std::max(value, -128.f), 127.f)));
+}
+
+}   // namespace
+
+template<typename T>
+struct MKLDNNSoftMaxNode::SoftmaxExecute {
+    using src_t = typename std::tuple_element<0, T>::type;
+    using dst_t = typename std::tuple_element<1, T>::type;
+
+    void operator()(SoftmaxContext & ctx) {
+        auto src = reinterpret_cast<const src_t *>(ctx.src);
+        auto dst = reinterpret_cast<dst_t *>(ctx.dst);
+        ctx.node.softmaxFused<src_t, dst_t>(src, ctx.mask, dst);
+    }
+};
+
+void MKLDNNSoftMaxNode::execute(mkldnn::stream strm) {
+    if (!useFusedImpl()) {
+        MKLDNNNode::execute(strm);
+        return;
+    }
+
+    const uint8_t *src = reinterpret_cast<const uint8_t*>(getParentEdgeAt(DATA)->getMemoryPtr()->GetPtr());
+    const float *mask = withMask ? reinterpret_cast<const float*>(getParentEdgeAt(MASK)->getMemoryPtr()->GetPtr()) : nullptr;
+    uint8_t *dst = reinterpret_cast<uint8_t*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    SoftmaxContext ctx = {
+        *this,
+        src,
+        mask,
+        dst
+    };
+
+    if (softmaxKernel) {
+        softmaxFusedJit(src, mask, dst);
+        return;
+    }
+
+    OV_SWITCH(MKLDNNPlugin, SoftmaxExecute, ctx, std::tie(inputPrecision, outputPrecision),
+    OV_CASE2(Precision::FP32, Precision::FP32, float, float),
+    OV_CASE2(Precision::FP32, Precision::BF16, float, bfloat16_t),
+    OV_CASE2(Precision::FP32, Precision::U8, float, uint8_t),
+    OV_CASE2(Precision::FP32, Precision::I8, float, int8_t),
+    OV_CASE2(Precision::BF16, Precision::FP32, bfloat16_t, float),
+    OV_CASE2(Precision::BF16, Precision::BF16, bfloat16_t, bfloat16_t),
+    OV_CASE2(Precision::BF16, Precision::U8, bfloat16_t, uint8_t),
+    OV_CASE2(Precision::BF16, Precision::I8, bfloat16_t, int8_t));
+}
+
+size_t MKLDNNSoftMaxNode::getMaskOffset(size_t dataOffset) const {
+    size_t maskOffset = 0;
+    for (int d = static_cast<int>(dataDims.size()) - 1; d >= 0; d--) {
+        maskOffset += (dataOffset % dataDims[d]) * maskStrides[d];
+        dataOffset /= dataDims[d];
+    }
+    return maskOffset;
+}
+
+void MKLDNNSoftMaxNode::softmaxFusedJit(const uint8_t* src, const float* mask, uint8_t* dst) {
+    const size_t srcDataSize = inputPrecision.size();
+    const size_t dstDataSize = outputPrecision.size();
+    const size_t maskAxisStride = withMask ? maskStrides[axis] : 0;
+
+    auto initArgs = [&](size_t offset) {
+        auto arg = jit_args_softmax();
+        arg.src = src + offset * srcDataSize;
+        arg.dst = dst + offset * dstDataSize;
+        arg.mask = withMask ? mask + getMaskOffset(offset) : nullptr;
+        arg.oc_off = ((offset / channelAxisStride) % channelsNum) * sizeof(float);
+        return arg;
+    };
+
+    if (innerSize == 1) {
+        parallel_for(outerSize, [&](size_t o) {
+            auto arg = initArgs(o * axisSize);
+            arg.src_stride = blockSize * srcDataSize;
+            arg.dst_stride = blockSize * dstDataSize;
+            arg.mask_stride = blockSize * maskAxisStride * sizeof(float);
+            arg.work_amount = axisSize / blockSize;
+            (*softmaxKernel)(&arg);
+        });
+    } else {
+        const size_t blocksNum = (innerSize + blockSize - 1) / blockSize;
+        parallel_for2d(outerSize, blocksNum, [&](size_t o, size_t ib) {
+            auto arg = initArgs(o * axisSize * innerSize + ib * blockSize);
+            arg.src_stride = innerSize * srcDataSize;
+            arg.dst_stride = innerSize * dstDataSize;
+            arg.mask_stride = maskAxisStride * sizeof(float);
+            arg.work_amount = axisSize;
+            if ((ib + 1) * blockSize > innerSize)
+                (*softmaxTailKernel)(&arg);
+            else
+                (*softmaxKernel)(&arg);
+        });
+    }
+}
+
+template <typename in_data_t, typename out_data_t>
+void MKLDNNSoftMaxNode::softmaxFused(const in_data_t* src, const float* mask, out_data_t* dst) {
+    const size_t maskAxisStride = withMask ? maskStrides[axis] : 0;
+
+    parallel_for(outerSize * innerSize, [&](size_t iwork) {
+        const size_t o = iwork / innerSize;
+        const size_t i = iwork % innerSize;
+        const size_t base = o * axisSize * innerSize + i;
+        const size_t maskBase = withMask ? getMaskOffset(base) : 0;
+
+        auto getValue = [&](size_t a) {
+            float val = static_cast<float>(src[base + a * innerSize]) * scale;
+            if (withMask)
+                val += mask[maskBase + a * maskAxisStride];
+            return val;
+        };
+
+        // exponents are recomputed instead of being stored, so that low precision outputs are rounded only once
+        float max = -std::numeric_limits<float>::infinity();
+        for (size_t a = 0; a < axisSize; a++)
+            max = std::max(max, getValue(a));
+
+        float expSum = 0.f;
+        for (size_t a = 0; a < axisSize; a++)
+            expSum += std::exp(getValue(a) - max);
+
+        const float expSumInv = 1.f / expSum;
+        for (size_t a = 0; a < axisSize; a++) {
+            const size_t dstIdx = base + a * innerSize;
+            float dstValue = std::exp(getValue(a) - max) * expSumInv;
+            applyPostOpsScalar(dstValue, (dstIdx / channelAxisStride) % channelsNum);
+            dst[dstIdx] = saturateTo<out_data_t>(dstValue);
+        }
+    });
+}
+
+inline void MKLDNNSoftMaxNode::applyPostOpsScalar(float &dst_value, size_t index_c) const {
+    const auto &p = (*attr.get()).post_ops_;
+    int eltwise_inj_idx = 0;
+    int depthwise_inj_idx = 0;
+    for (int i = 0; i < p.len(); i++) {
+        auto &post_op = p.entry_[i];
+        if (post_op.is_eltwise()) {
+            dst_value = eltwise_injectors_ref[eltwise_inj_idx]->compute_scalar(dst_value);
+            eltwise_inj_idx++;
+        } else if (post_op.is_depthwise()) {
+            auto depthwise_weights = post_op.depthwise.weights_data + index_c;
+            auto depthwise_bias = post_op.depthwise.biases_data + index_c;
+            dst_value = depthwise_injectors_ref[depthwise_inj_idx]->compute_scalar(dst_value, depthwise_weights, depthwise_bias);
+            depthwise_inj_idx++;
+        } else if (post_op.is_quantization()) {
+            bool do_dequantization = post_op.quantization.alg == alg_kind::quantization_quantize_dequantize;
+            bool do_rounding = do_dequantization || one_of(outputPrecision, Precision::FP32, Precision::BF16) || i != p.len() - 1;
+
+            auto quant = post_op.quantization;
+
+            float crop_low = quant.crop_low_data->shifts_[quant.crop_low_data->count_ == 1 ? 0 : index_c];
+            float crop_high = quant.crop_high_data->shifts_[quant.crop_high_data->count_ == 1 ? 0 : index_c];
+            float input_scale = quant.input_scale_data->scales_[quant.input_scale_data->count_ == 1 ? 0 : index_c];
+            float input_shift = quant.input_shift_data->shifts_[quant.input_shift_data->count_ == 1 ? 0 : index_c];
+
+            dst_value = nstl::min(crop_high, nstl::max(crop_low, dst_value));
+            dst_value = dst_value * input_scale + input_shift;
+
+            if (do_rounding) {
+                dst_value = roundf(dst_value);
+            }
+
+            if (do_dequantization) {
+                float output_scale = quant.output_scale_data->scales_[quant.output_scale_data->count_ == 1 ? 0 : index_c];
+                float output_shift = quant.output_shift_data->shifts_[quant.output_shift_data->count_ == 1 ? 0 : index_c];
+                dst_value = dst_value * output_scale + output_shift;
+            }
+        }
+    }
+}
+
 REG_MKLDNN_PRIM_FOR(MKLDNNSoftMaxNode, Softmax);
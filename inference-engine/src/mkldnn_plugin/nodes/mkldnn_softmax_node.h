@@ -10,6 +10,10 @@
 #include <memory>
 #include <vector>
 
+#include <cpu/ref_eltwise.hpp>
+#include <cpu/ref_depthwise_injector.hpp>
+#include <nodes/common/softmax.h>
+
 namespace MKLDNNPlugin {
 
 class MKLDNNSoftMaxNode : public MKLDNNNode {
@@ -20,11 +24,79 @@ public:
     void createDescriptor(const std::vector<InferenceEngine::TensorDesc>& inputDesc,
                           const std::vector<InferenceEngine::TensorDesc>& outputDesc) override;
     void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
     void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
     bool created() const override;
+    bool canFuse(const MKLDNNNodePtr& node) const override;
+
+    /**
+     * @brief Fuses a preceding multiplication of the softmax input by a scalar (e.g. 1/sqrt(d) in attention blocks).
+     * Must be called by the graph optimizer after the Multiply/Divide node has been removed from the graph.
+     */
+    void fuseScale(float value);
+    /**
+     * @brief Marks the node as having an additive mask on the second input port. The mask is broadcasted to the data shape.
+     * Must be called by the graph optimizer after the mask edge has been connected to port MASK.
+     */
+    void fuseMask();
+
+    size_t getAxis() const {
+        return axis;
+    }
+
+    bool withFusedPreOps() const {
+        return withScale || withMask;
+    }
+
+    static const size_t DATA = 0;
+    static const size_t MASK = 1;
 
 private:
+    bool useFusedImpl() const {
+        return withFusedPreOps() || !fusedWith.empty();
+    }
+
+    template <typename T>
+    struct SoftmaxExecute;
+
+    void softmaxFusedJit(const uint8_t* src, const float* mask, uint8_t* dst);
+    template <typename in_data_t, typename out_data_t>
+    void softmaxFused(const in_data_t* src, const float* mask, out_data_t* dst);
+    size_t getMaskOffset(size_t dataOffset) const;
+
+    void setPostOps(mkldnn::primitive_attr &attr);
+    inline void applyPostOpsScalar(float &dst_value, size_t index_c) const;
+
     size_t axis = 0;
+
+    float scale = 1.f;
+    bool withScale = false;
+    bool withMask = false;
+
+    // softmax input is viewed as [outer, axis, inner]
+    size_t outerSize = 1;
+    size_t axisSize = 1;
+    size_t innerSize = 1;
+    size_t channelAxisStride = 0;
+    size_t channelsNum = 1;
+    // per-dimension strides of the mask in the data index space (zero for broadcasted dimensions)
+    std::vector<size_t> maskStrides;
+    std::vector<size_t> dataDims;
+
+    InferenceEngine::Precision inputPrecision = InferenceEngine::Precision::FP32;
+    InferenceEngine::Precision outputPrecision = InferenceEngine::Precision::FP32;
+
+    mkldnn::primitive_attr attr;
+    // number of fp32 lanes processed by the kernel at once
+    size_t blockSize = 1;
+    std::shared_ptr<jit_uni_softmax_kernel> softmaxKernel;
+    // processes the last incomplete block of inner dimensions
+    std::shared_ptr<jit_uni_softmax_kernel> softmaxTailKernel;
+    std::vector<std::shared_ptr<mkldnn::impl::cpu::ref_eltwise_scalar_fwd_t>> eltwise_injectors_ref;
+    std::vector<std::shared_ptr<mkldnn::impl::cpu::ref_depthwise_scalar_fwd_t>> depthwise_injectors_ref;
+
+    std::string errorPrefix;
 };
 
 }  // namespace MKLDNNPlugin
@@ -7,6 +7,8 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <unordered_set>
+#include <unordered_map>
 #include <mkldnn_extension_utils.h>
 #include <ie_ngraph_utils.hpp>
 #include <utils/general_utils.h>
@@ -124,6 +126,32 @@ public:
     }
 };
 
+/**
+ * Back edge which avoids copy of the data by swapping buffers of body output and body input (double buffering).
+ * Output of the previous iteration becomes input of the next one, while the previous input buffer is reused for
+ * the next output. All the memory objects which point to these buffers are updated.
+ */
+class BackEdgeSwapPortHelper : public PortMapHelper {
+public:
+    BackEdgeSwapPortHelper(const std::vector<MKLDNNMemoryPtr> &from, const std::vector<MKLDNNMemoryPtr> &to)
+        : from(from), to(to) {}
+
+    void execute(mkldnn::stream strm, int iter) override {
+        if (iter != 0) {
+            void *from_ptr = from.front()->GetPrimitive().get_data_handle();
+            void *to_ptr = to.front()->GetPrimitive().get_data_handle();
+            for (auto &mem : from)
+                mem->GetPrimitivePtr()->set_data_handle(to_ptr);
+            for (auto &mem : to)
+                mem->GetPrimitivePtr()->set_data_handle(from_ptr);
+        }
+    }
+
+private:
+    std::vector<MKLDNNMemoryPtr> from;
+    std::vector<MKLDNNMemoryPtr> to;
+};
+
 class IterCountPortHelper : public PortMapHelper {
 public:
     IterCountPortHelper(const MKLDNNMemoryPtr &to, const mkldnn::engine& eng) {
@@ -296,6 +324,15 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
         IE_THROW() << "Can't cast TensorIterator node with name: " << getName() << " to ngraph::op::util::SubGraphOp";
     }
     const std::shared_ptr<const ngraph::Function> body = tiOp->get_function();
+
+    // Invariant inputs are written once before the loop, so the body part which depends only on them is executed once
+    std::unordered_set<std::string> invariantInputs;
+    for (const auto& desc : tiOp->get_input_descriptions()) {
+        if (std::dynamic_pointer_cast<ngraph::op::util::SubGraphOp::InvariantInputDescription>(desc))
+            invariantInputs.insert(body->get_parameters()[desc->m_body_parameter_index]->get_friendly_name());
+    }
+    sub_graph.SetInvariantInputs(invariantInputs);
+
     sub_graph.CreateGraph(body, ext_mng, weightCache);
 
     const auto &inMap = sub_graph.GetInputNodesMap();
@@ -304,6 +341,7 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
         if (inNode != inMap.end()) {
             auto inMem = inNode->second->getChildEdgeAt(0)->getMemoryPtr();
             input_mem.push_back(inMem);
+            input_nodes.push_back(inNode->second);
         }
     }
 
@@ -318,6 +356,7 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
         if (outNode != outMap.end()) {
             auto outMem = outNode->second->getParentEdgeAt(0)->getMemoryPtr();
             output_mem.push_back(outMem);
+            output_nodes.push_back(outNode->second);
         }
     }
 
@@ -420,11 +459,24 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
             after_mappers.emplace_back(new PortIteratorHelper(from_mem, to_mem, false, map_rule, eng));
     }
 
+    // A body output feeding several back edges must stay in place, otherwise it would be swapped more than once
+    std::unordered_map<int, int> backEdgesPerOutput;
+    for (const auto &map_rule : backEdges)
+        backEdgesPerOutput[map_rule.from]++;
+
     for (auto map_rule : backEdges) {
         auto from_mem = output_mem[map_rule.from];
         auto to_mem = input_mem[map_rule.to];
 
-        before_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
+        if (backEdgesPerOutput[map_rule.from] == 1 && canSwapBackEdge(output_nodes[map_rule.from], input_nodes[map_rule.to])) {
+            std::vector<MKLDNNMemoryPtr> to_group;
+            for (size_t i = 0; i < input_nodes[map_rule.to]->getChildEdges().size(); i++)
+                to_group.push_back(input_nodes[map_rule.to]->getChildEdgeAt(i)->getMemoryPtr());
+
+            before_mappers.emplace_back(new BackEdgeSwapPortHelper({from_mem}, to_group));
+        } else {
+            before_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
+        }
     }
 
     // special purpose ports
@@ -455,6 +507,59 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
     }
 }
 
+bool MKLDNNTensorIteratorNode::canSwapBackEdge(const MKLDNNNodePtr &bodyOutput, const MKLDNNNodePtr &bodyInput) {
+    // Nodes which resolve data pointers of their edges on each execute call (directly or through mkldnn memory
+    // objects), so they are not affected by the handles being changed between iterations
+    const auto readsPointersOnExecute = [](const MKLDNNNodePtr &node) {
+        return one_of(node->getType(), Convolution, Deconvolution, FullyConnected, MatMul, Eltwise, Reorder, Pooling,
+                      Softmax, Lrn, MVN, Transpose);
+    };
+
+    const auto outEdge = bodyOutput->getParentEdgeAt(0);
+    const auto producer = outEdge->getParent();
+    // Producer must write directly into the body output buffer on each iteration
+    if (!readsPointersOnExecute(producer) || producer->isConstant() || producer->isInplace() ||
+            producer->getChildEdges().size() != 1 || sub_graph.isInvariantNode(producer))
+        return false;
+
+    std::unordered_set<MKLDNNEdge*> inEdges;
+    for (size_t i = 0; i < bodyInput->getChildEdges().size(); i++) {
+        const auto inEdge = bodyInput->getChildEdgeAt(i);
+        const auto child = inEdge->getChild();
+        // Consumers caching pointers to the input buffer (Split, in-place nodes, extensions, etc.) are not allowed
+        if (!readsPointersOnExecute(child) || child->isConstant() || child->isInplace())
+            return false;
+        if (inEdge->getMemory().GetPrimitive().get_data_handle() !=
+                bodyInput->getChildEdgeAt(0)->getMemory().GetPrimitive().get_data_handle())
+            return false;
+        inEdges.insert(inEdge.get());
+    }
+
+    const auto &fromMem = outEdge->getMemory();
+    const auto &toMem = bodyInput->getChildEdgeAt(0)->getMemory();
+    if (fromMem.GetDescriptor() != toMem.GetDescriptor())
+        return false;
+
+    const auto isOverlapped = [](const MKLDNNMemory &lhs, const MKLDNNMemory &rhs) {
+        const auto lhsBegin = static_cast<const uint8_t *>(lhs.GetPrimitive().get_data_handle());
+        const auto rhsBegin = static_cast<const uint8_t *>(rhs.GetPrimitive().get_data_handle());
+        return lhsBegin < rhsBegin + rhs.GetSize() && rhsBegin < lhsBegin + lhs.GetSize();
+    };
+
+    // Neither of the buffers may be shared with any other edge of the body, even partially
+    for (const auto &edge : sub_graph.GetEdges()) {
+        const auto &mem = edge->getMemory();
+        if (mem.GetPrimitive().get_data_handle() == nullptr)
+            continue;
+        if (isOverlapped(mem, fromMem) && edge != outEdge)
+            return false;
+        if (isOverlapped(mem, toMem) && !inEdges.count(edge.get()))
+            return false;
+    }
+
+    return true;
+}
+
 void MKLDNNTensorIteratorNode::execute(mkldnn::stream strm) {
     sub_graph.ResetInferCount();
 
@@ -470,7 +575,11 @@ void MKLDNNTensorIteratorNode::execute(mkldnn::stream strm) {
         for (auto &mapper : before_mappers)
             mapper->execute(strm, i);
 
-        sub_graph.Infer();
+        // loop invariant part of the body is computed on the first iteration only
+        if (i == 0)
+            sub_graph.Infer();
+        else
+            sub_graph.InferVariantPart();
 
         continue_cond = continue_cond_check->getStatus();
 
@@ -69,11 +69,14 @@ public:
     void setExtManager(const MKLDNNExtensionManager::Ptr& extMgr) { ext_mng = extMgr; }
 
 private:
+    bool canSwapBackEdge(const MKLDNNNodePtr &bodyOutput, const MKLDNNNodePtr &bodyInput);
+
     int n_iter = 0;
 
     MKLDNNExtensionManager::Ptr ext_mng;
     MKLDNNGraph sub_graph;
     std::vector<MKLDNNMemoryPtr> input_mem, output_mem;
+    std::vector<MKLDNNNodePtr> input_nodes, output_nodes;
 
     std::vector<std::shared_ptr<PortMapHelper>>
         first_mappers,   /// < Applied once before loop
@@ -6,7 +6,8 @@
 #include <string>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
-#include "common/cpu_memcpy.h"
+#include "common/strided_copy_kernel.h"
+#include "common/tensor_desc_creator.h"
 #include <ngraph/opsets/opset1.hpp>
 
 using namespace mkldnn;
@@ -85,20 +86,26 @@ void MKLDNNTileNode::initSupportedPrimitiveDescriptors() {
         precision.size() != sizeof(PrecisionTrait<Precision::I8>::value_type)) {
         IE_THROW() << errorPrefix << " has unsupported input precision: " << precision;
     }
-    auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(precision);
-
-    auto& inDims = getParentEdgeAt(0)->getDims();
-    memory::format_tag fmt = MKLDNNMemory::GetPlainFormat(inDims);
-
-    InferenceEngine::LayerConfig config;
-    config.dynBatchSupport = true;
-    config.inConfs.resize(2);
-    config.outConfs.resize(1);
-    config.inConfs[TILE_INPUT].desc = MKLDNNMemoryDesc(getParentEdgeAt(TILE_INPUT)->getDims(), inputDataType, fmt);
-    config.inConfs[TILE_REPEATS].desc = MKLDNNMemoryDesc(getParentEdgeAt(TILE_REPEATS)->getDims(), memory::data_type::s32, memory::format_tag::x);
-    config.outConfs[0].desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), inputDataType, fmt);
-    config.outConfs[0].inPlace = noTiling ? 0 : -1;
-    supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown, fmt});
+
+    const int inPlace = noTiling ? 0 : -1;
+    addSupportedPrimDesc({{TensorDescCreatorTypes::ncsp, precision},
+                          {TensorDescCreatorTypes::ncsp, Precision::I32}},
+                         {{TensorDescCreatorTypes::ncsp, precision, false, inPlace}},
+                         impl_desc_type::ref_any, true);
+
+    // tiling along the channels can't be done in the channels last and blocked layouts
+    if (axis != 1) {
+        addSupportedPrimDesc({{TensorDescCreatorTypes::nspc, precision},
+                              {TensorDescCreatorTypes::ncsp, Precision::I32}},
+                             {{TensorDescCreatorTypes::nspc, precision, false, inPlace}},
+                             impl_desc_type::ref_any, true);
+        for (auto blockedType : {TensorDescCreatorTypes::nCsp8c, TensorDescCreatorTypes::nCsp16c}) {
+            addSupportedPrimDesc({{blockedType, precision},
+                                  {TensorDescCreatorTypes::ncsp, Precision::I32}},
+                                 {{blockedType, precision, false, inPlace}},
+                                 impl_desc_type::ref_any, true);
+        }
+    }
 }
 
 void MKLDNNTileNode::createPrimitive() {
@@ -110,6 +117,35 @@ void MKLDNNTileNode::createPrimitive() {
         IE_THROW() << errorPrefix << " can't get input memory";
     if (getSelectedPrimitiveDescriptor() == nullptr)
         IE_THROW() << errorPrefix << " has nullable preferable primitive descriptor";
+
+    if (noTiling)
+        return;
+
+    const auto& srcBlk = getParentEdgeAt(TILE_INPUT)->getDesc().getBlockingDesc();
+    const auto& dstBlk = getChildEdgeAt(0)->getDesc().getBlockingDesc();
+    const auto& order = srcBlk.getOrder();
+    const auto& srcBlockDims = srcBlk.getBlockDims();
+    const auto& srcStrides = srcBlk.getStrides();
+    const auto& dstBlockDims = dstBlk.getBlockDims();
+    const auto& dstStrides = dstBlk.getStrides();
+
+    // the tiled dimension is split into the (tiles, src dim) pair where the src is broadcasted along the tiles
+    StridedCopyParams params;
+    params.data_size = getParentEdgeAt(TILE_INPUT)->getDesc().getPrecision().size();
+    for (size_t i = 0; i < order.size(); i++) {
+        if (order[i] == static_cast<size_t>(axis)) {
+            params.dims.push_back(tiles);
+            params.src_strides.push_back(0);
+            params.dst_strides.push_back(dstStrides[i] * srcBlockDims[i]);
+            params.dims.push_back(srcBlockDims[i]);
+        } else {
+            params.dims.push_back(dstBlockDims[i]);
+        }
+        params.src_strides.push_back(srcStrides[i]);
+        params.dst_strides.push_back(dstStrides[i]);
+    }
+
+    copyKernel = std::unique_ptr<StridedCopyKernel>(new StridedCopyKernel(params));
 }
 
 void MKLDNNTileNode::execute(mkldnn::stream strm) {
@@ -117,45 +153,14 @@ void MKLDNNTileNode::execute(mkldnn::stream strm) {
         return;
     }
 
-    auto& srcMemory = getParentEdgeAt(0)->getMemory();
-
-    const uint8_t* src_ptr = reinterpret_cast<const uint8_t*>(srcMemory.GetPtr());
-    uint8_t* dst_ptr = reinterpret_cast<uint8_t*>(getChildEdgeAt(0)->getMemory().GetPtr());
+    const uint8_t* srcData = reinterpret_cast<const uint8_t*>(getParentEdgeAt(TILE_INPUT)->getMemory().GetPtr());
+    uint8_t* dstData = reinterpret_cast<uint8_t*>(getChildEdgeAt(0)->getMemory().GetPtr());
 
-    int m_inner_dim = 1;
-    int m_outer_dim = 1;
-    memory::dims inDims = srcMemory.GetDims();
-    for (int i=0; i < axis; i++ ) m_outer_dim *= inDims[i];
-    for (int i=axis; i < inDims.size(); i++ ) m_inner_dim *= inDims[i];
-    if (axis > 0) {
-        m_outer_dim /= inDims[0];
-        m_outer_dim *= batchToProcess();
+    // tiling along the batch breaks the batch dimension, so the whole tensor is processed
+    if (axis == 0) {
+        copyKernel->execute(srcData, dstData);
     } else {
-        m_inner_dim /= inDims[0];
-        m_inner_dim *= batchToProcess();
-    }
-
-    if (m_inner_dim == 1 && m_outer_dim % 8 == 0 && srcMemory.GetDesc().isBlockedCFormat(8)) {
-        /*
-         * We may enable tile processing directly to appropriate output format (nChw8c)
-         */
-        m_inner_dim *= 8;
-        m_outer_dim /= 8;
-    } else if (m_inner_dim == 1 && m_outer_dim % 16 == 0 && srcMemory.GetDesc().isBlockedCFormat(16)) {
-        /*
-         * We may enable tile processing directly to appropriate output format (nChw16c)
-         */
-        m_inner_dim *= 16;
-        m_outer_dim /= 16;
-    }
-
-    m_inner_dim *= srcMemory.GetDesc().GetElementSize();
-    for (int i = 0; i < m_outer_dim; ++i) {
-        for (int t = 0; t < tiles; ++t) {
-            cpu_memcpy(dst_ptr, src_ptr, m_inner_dim);
-            dst_ptr += m_inner_dim;
-        }
-        src_ptr += m_inner_dim;
+        copyKernel->execute(srcData, dstData, batchToProcess());
     }
 }
 
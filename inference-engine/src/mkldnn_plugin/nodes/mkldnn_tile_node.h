@@ -7,6 +7,8 @@
 #include <ie_common.h>
 #include <mkldnn_node.h>
 #include <string>
+#include <memory>
+#include "common/strided_copy_kernel.h"
 
 namespace MKLDNNPlugin {
 
@@ -30,6 +32,8 @@ private:
     int tiles = 0;
     bool noTiling = false;
 
+    std::unique_ptr<StridedCopyKernel> copyKernel;
+
     std::string errorPrefix;
 };
 
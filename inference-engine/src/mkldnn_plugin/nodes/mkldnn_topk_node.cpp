@@ -2,7 +2,10 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cmath>
+#include <utility>
+#include <vector>
 
 #include <ngraph/op/topk.hpp>
 #include "ie_parallel.hpp"
@@ -135,7 +138,12 @@ void MKLDNNTopKNode::execute(mkldnn::stream strm) {
 
     SizeVector in_dims = getParentEdgeAt(TOPK_DATA)->getDims().ToSizeVector();
 
-    if (src_k == 1) {
+    if (useSelection(in_dims)) {
+        if (mode_max)
+            topk_selection<cmpgt_ps, std::greater>(src, dst_data, dst_idx, in_dims);
+        else
+            topk_selection<cmplt_ps, std::less>(src, dst_data, dst_idx, in_dims);
+    } else if (src_k == 1) {
         if (is_last_dim) {
             if (mode_max)
                 top1<std::greater>(src, dst_data, dst_idx, in_dims);
@@ -464,6 +472,142 @@ void MKLDNNTopKNode::topk(const float* src_data, float* dst_data, int* dst_idx,
     });
 }
 
+bool MKLDNNTopKNode::useSelection(const SizeVector& in_dims) {
+    if (dim < selection_min_dim)
+        return false;
+    // the innermost axis is processed by the scalar code otherwise, and a single row is processed by the single thread
+    if (is_last_dim)
+        return true;
+    if (src_k == 1)
+        return false;
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    const int after_num = count(in_dims, axis + 1, in_dims.size());
+    return src_k >= count_vec || after_num < block_size;
+#else
+    return true;
+#endif
+}
+
+template <class Compare1, template <typename> class Compare2>
+void MKLDNNTopKNode::topk_selection(const float* src_data, float* dst_data, int* dst_idx, SizeVector in_dims) {
+    typedef std::pair<float, int> candidate;
+
+    const int after_num = count(in_dims, axis + 1, in_dims.size());
+    const int rows = before_num * after_num;
+    const int k = src_k;
+
+    // the heap keeps the worst of the selected candidates on the top, equal values are ordered by the index
+    auto better = [](const candidate& a, const candidate& b) {
+        return Compare2<float>()(a.first, b.first) || (a.first == b.first && a.second < b.second);
+    };
+
+    auto select = [&](const float* row, int start, int end, std::vector<candidate>& heap) {
+        heap.clear();
+        int i = start;
+        for (; i < end && static_cast<int>(heap.size()) < k; i++)
+            heap.emplace_back(row[i * after_num], i);
+        std::make_heap(heap.begin(), heap.end(), better);
+
+        // indexes grow, so the element equal to the threshold is never better than the selected one
+        auto insert = [&](int index) {
+            const float value = row[index * after_num];
+            if (Compare2<float>()(value, heap.front().first)) {
+                std::pop_heap(heap.begin(), heap.end(), better);
+                heap.back() = candidate(value, index);
+                std::push_heap(heap.begin(), heap.end(), better);
+            }
+        };
+
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        if (after_num == 1) {
+            vec_type_f vthreshold = _mm_uni_set1_ps(heap.front().first);
+            for (; i + block_size <= end; i += block_size) {
+                vmask_type vmask = Compare1::cmp_ps(_mm_uni_loadu_ps(row + i), vthreshold);
+#if defined(HAVE_AVX512F)
+                if (!vmask)
+                    continue;
+#else
+                if (!_mm_uni_movemask_ps(vmask))
+                    continue;
+#endif
+                for (int j = 0; j < block_size; j++)
+                    insert(i + j);
+                vthreshold = _mm_uni_set1_ps(heap.front().first);
+            }
+        }
+#endif
+        for (; i < end; i++)
+            insert(i);
+    };
+
+    auto store = [&](int row_idx, std::vector<candidate>& selected) {
+        if (sort_value) {
+            std::sort(selected.begin(), selected.end(), better);
+        } else {
+            std::sort(selected.begin(), selected.end(), [](const candidate& a, const candidate& b) {
+                return a.second < b.second;
+            });
+        }
+        const int i0 = row_idx / after_num;
+        const int i1 = row_idx % after_num;
+        for (int i2 = 0; i2 < k; i2++) {
+            const int d_index = (i0 * k + i2) * after_num + i1;
+            if (dst_data)
+                dst_data[d_index] = selected[i2].first;
+            if (dst_idx)
+                dst_idx[d_index] = selected[i2].second;
+        }
+    };
+
+    auto row_ptr = [&](int row_idx) {
+        return src_data + (row_idx / after_num) * dim * after_num + row_idx % after_num;
+    };
+
+    // split the axis between threads when there are not enough rows to load all of them
+    const int threads_num = parallel_get_max_threads();
+    int chunks = 1;
+    if (rows > 0 && rows < threads_num)
+        chunks = std::max(1, std::min(threads_num / rows, dim / std::max(selection_min_chunk, k)));
+
+    if (chunks == 1) {
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            int start = 0, end = 0;
+            splitter(rows, nthr, ithr, start, end);
+            std::vector<candidate> heap;
+            heap.reserve(k);
+            for (int r = start; r < end; r++) {
+                select(row_ptr(r), 0, dim, heap);
+                store(r, heap);
+            }
+        });
+        return;
+    }
+
+    std::vector<candidate> candidates(static_cast<size_t>(rows) * chunks * k);
+    std::vector<int> candidates_num(static_cast<size_t>(rows) * chunks);
+    parallel_for(rows * chunks, [&](int w) {
+        int start = 0, end = 0;
+        splitter(dim, chunks, w % chunks, start, end);
+        std::vector<candidate> heap;
+        heap.reserve(k);
+        select(row_ptr(w / chunks), start, end, heap);
+        std::copy(heap.begin(), heap.end(), candidates.begin() + static_cast<size_t>(w) * k);
+        candidates_num[w] = static_cast<int>(heap.size());
+    });
+
+    parallel_for(rows, [&](int r) {
+        std::vector<candidate> merged;
+        merged.reserve(static_cast<size_t>(chunks) * k);
+        for (int c = 0; c < chunks; c++) {
+            auto first = candidates.begin() + static_cast<size_t>(r * chunks + c) * k;
+            merged.insert(merged.end(), first, first + candidates_num[r * chunks + c]);
+        }
+        std::nth_element(merged.begin(), merged.begin() + k - 1, merged.end(), better);
+        merged.resize(k);
+        store(r, merged);
+    });
+}
+
 inline int MKLDNNTopKNode::count(SizeVector dims, size_t start_ind, size_t end_ind) {
     size_t count = 1;
     for (size_t i = start_ind; i < end_ind; i++)
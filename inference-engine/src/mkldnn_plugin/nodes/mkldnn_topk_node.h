@@ -79,6 +79,14 @@ public:
     template<template<typename> class Compare>
     void topk(const float *src_data, float *dst_data, int *dst_idx, InferenceEngine::SizeVector in_dims);
 
+    /**
+     * Threshold selection for the long axes: elements which are not better than the worst of the selected ones are
+     * rejected by the vector compare, the rest are inserted into the heap of K candidates. A few long rows are split
+     * between threads, the candidates of the parts are merged afterwards.
+     */
+    template<class Compare1, template<typename> class Compare2>
+    void topk_selection(const float *src_data, float *dst_data, int *dst_idx, InferenceEngine::SizeVector in_dims);
+
 private:
     const size_t TOPK_DATA = 0;
     const size_t TOPK_K = 1;
@@ -106,6 +114,13 @@ private:
     const int count_vec = 16;
 #endif
 
+    // the insertion based kernels are faster for the short axes
+    const int selection_min_dim = 256;
+    // minimal length of the axis part processed by the single thread
+    const int selection_min_chunk = 4096;
+
+    bool useSelection(const InferenceEngine::SizeVector& in_dims);
+
     inline int count(InferenceEngine::SizeVector dims, size_t start_ind, size_t end_ind);
 
     inline int count(InferenceEngine::SizeVector dims, size_t start_ind = 0);
@@ -305,7 +305,7 @@ static void retrieve_rois_cpu(const int num_rois, const int item_index,
 void proposal_exec(const float* input0, const float* input1,
              std::vector<size_t> dims0, std::array<float, 4> img_info,
              const float* anchors, int* roi_indices,
-             float* output0, float* output1, proposal_conf &conf) {
+             float* output0, float* output1, proposal_conf &conf, proposal_scratch &scratch) {
     // Prepare memory
     const float *p_bottom_item = input0;
     const float *p_d_anchor_item = input1;
@@ -350,32 +350,36 @@ void proposal_exec(const float* input0, const float* input1,
         float y1;
         float score;
     };
-    std::vector<ProposalBox> proposals_(num_proposals);
+    static_assert(sizeof(ProposalBox) == 5 * sizeof(float), "ProposalBox must be packed");
+    scratch.proposals.resize(5 * num_proposals);
+    ProposalBox* proposals_ = reinterpret_cast<ProposalBox *>(scratch.proposals.data());
     const int unpacked_boxes_buffer_size = store_prob ? 5 * pre_nms_topn : 4 * pre_nms_topn;
-    std::vector<float> unpacked_boxes(unpacked_boxes_buffer_size);
-    std::vector<int> is_dead(pre_nms_topn);
+    scratch.unpacked_boxes.resize(unpacked_boxes_buffer_size);
+    float* unpacked_boxes = scratch.unpacked_boxes.data();
+    scratch.is_dead.resize(pre_nms_topn);
+    int* is_dead = scratch.is_dead.data();
 
     // Execute
     int nn = dims0[0];
     for (int n = 0; n < nn; ++n) {
         enumerate_proposals_cpu(p_bottom_item + num_proposals + n * num_proposals * 2,
                                 p_d_anchor_item + n * num_proposals * 4,
-                                anchors, reinterpret_cast<float *>(&proposals_[0]),
+                                anchors, reinterpret_cast<float *>(proposals_),
                                 conf.anchors_shape_0, bottom_H, bottom_W, img_H, img_W,
                                 min_box_H, min_box_W, conf.feat_stride_,
                                 conf.box_coordinate_scale_, conf.box_size_scale_,
                                 conf.coordinates_offset, conf.initial_clip, conf.swap_xy, conf.clip_before_nms);
-        std::partial_sort(proposals_.begin(), proposals_.begin() + pre_nms_topn, proposals_.end(),
+        std::partial_sort(proposals_, proposals_ + pre_nms_topn, proposals_ + num_proposals,
                           [](const ProposalBox &struct1, const ProposalBox &struct2) {
                               return (struct1.score > struct2.score);
                           });
 
-        unpack_boxes(reinterpret_cast<float *>(&proposals_[0]), &unpacked_boxes[0], pre_nms_topn, store_prob);
-        nms_cpu(pre_nms_topn, &is_dead[0], &unpacked_boxes[0], roi_indices, &num_rois, 0, conf.nms_thresh_,
+        unpack_boxes(reinterpret_cast<float *>(proposals_), unpacked_boxes, pre_nms_topn, store_prob);
+        nms_cpu(pre_nms_topn, is_dead, unpacked_boxes, roi_indices, &num_rois, 0, conf.nms_thresh_,
                 conf.post_nms_topn_, conf.coordinates_offset);
 
         float* p_probs = store_prob ? p_prob_item + n * conf.post_nms_topn_ : nullptr;
-        retrieve_rois_cpu(num_rois, n, pre_nms_topn, &unpacked_boxes[0], roi_indices,
+        retrieve_rois_cpu(num_rois, n, pre_nms_topn, unpacked_boxes, roi_indices,
                           p_roi_item + n * conf.post_nms_topn_ * 5,
                           conf.post_nms_topn_, conf.normalize_, img_H, img_W, conf.clip_after_nms, p_probs);
     }
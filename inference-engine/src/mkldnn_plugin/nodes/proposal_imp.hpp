@@ -35,12 +35,19 @@ struct proposal_conf {
     bool shift_anchors;    // shift anchors by half size of the box
 };
 
+// buffers of the intermediate results, they are resized on the first call and reused by the next ones
+struct proposal_scratch {
+    std::vector<float> proposals;       // (x0, y0, x1, y1, score) for each proposal
+    std::vector<float> unpacked_boxes;  // top-n proposals in the planar layout
+    std::vector<int> is_dead;
+};
+
 namespace XARCH {
 
 void proposal_exec(const float* input0, const float* input1,
         std::vector<size_t> dims0, std::array<float, 4> img_info,
         const float* anchors, int* roi_indices,
-        float* output0, float* output1, proposal_conf &conf);
+        float* output0, float* output1, proposal_conf &conf, proposal_scratch &scratch);
 
 }  // namespace XARCH
 }  // namespace Cpu
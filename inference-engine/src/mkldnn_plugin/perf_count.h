@@ -5,6 +5,9 @@
 #pragma once
 
 #include <chrono>
+#include <memory>
+
+#include "latency_histogram.h"
 
 namespace MKLDNNPlugin {
 
@@ -15,11 +18,19 @@ class PerfCount {
     std::chrono::high_resolution_clock::time_point __start = {};
     std::chrono::high_resolution_clock::time_point __finish = {};
 
+    std::unique_ptr<LatencyHistogram> histogram;
+
 public:
     PerfCount(): duration(0), num(0) {}
 
     uint64_t avg() { return (num == 0) ? 0 : duration / num; }
 
+    void enableHistogram() {
+        if (!histogram)
+            histogram.reset(new LatencyHistogram());
+    }
+    const LatencyHistogram* getHistogram() const { return histogram.get(); }
+
 private:
     void start_itr() {
         __start = std::chrono::high_resolution_clock::now();
@@ -28,8 +39,11 @@ private:
     void finish_itr() {
         __finish = std::chrono::high_resolution_clock::now();
 
-        duration += std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
+        const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(__finish - __start).count();
+        duration += ns / 1000;
         num++;
+        if (histogram)
+            histogram->add(ns);
     }
 
     friend class PerfHelper;
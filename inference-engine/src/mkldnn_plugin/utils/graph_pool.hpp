@@ -0,0 +1,59 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <mutex>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Leases a graph of the workspace pool for a stream running on the given NUMA node.
+ * Preference order:
+ *  1. the stream's own graph if it is idle and not created yet (the caller creates it on its NUMA node);
+ *  2. an idle created graph bound to the same NUMA node;
+ *  3. any idle created graph;
+ * otherwise the stream waits for a busy graph bound to the same NUMA node (or for its own one if there is none),
+ * so it never blocks on a remote graph while a local one may become free.
+ * @param graphs
+ * pool of graphs, graph type provides Lock (blocking and std::try_to_lock), IsCreated() which may be called without
+ * the lock and getNumaNodeId() which is valid once the graph is created
+ * @param ownId
+ * index of the graph assigned to the stream
+ * @param numaNodeId
+ * NUMA node of the stream
+ * @return lock of the selected graph
+ */
+template <typename GraphT>
+typename GraphT::Lock leaseGraph(std::deque<GraphT>& graphs, size_t ownId, int numaNodeId) {
+    using Lock = typename GraphT::Lock;
+    std::unique_ptr<Lock> remoteLock;
+    for (size_t i = 0; i < graphs.size(); i++) {
+        auto& graph = graphs[(ownId + i) % graphs.size()];
+        Lock graphLock(graph, std::try_to_lock);
+        if (!graphLock.owns_lock())
+            continue;
+        if (graph.IsCreated()) {
+            if (graph.getNumaNodeId() == numaNodeId)
+                return graphLock;
+            if (!remoteLock)
+                remoteLock.reset(new Lock(std::move(graphLock)));
+        } else if (i == 0) {
+            return graphLock;
+        }
+    }
+    if (remoteLock)
+        return std::move(*remoteLock);
+
+    for (size_t i = 0; i < graphs.size(); i++) {
+        auto& graph = graphs[(ownId + i) % graphs.size()];
+        if (graph.IsCreated() && graph.getNumaNodeId() == numaNodeId)
+            return Lock(graph);
+    }
+    return Lock(graphs[ownId]);
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,279 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "huge_pages_allocator.h"
+#include "numa_utils.h"
+
+#include <algorithm>
+#include <fstream>
+#include <new>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+// Values of the kernel API which may be missing in the old headers
+#if defined(__linux__)
+#ifndef MAP_HUGETLB
+#define MAP_HUGETLB 0x40000
+#endif
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
+#ifndef MADV_HUGEPAGE
+#define MADV_HUGEPAGE 14
+#endif
+#endif
+
+constexpr size_t gigantic = 1ul << 30;
+
+size_t getPageSize() {
+#if defined(__linux__)
+    static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return pageSize;
+#else
+    return 4096;
+#endif
+}
+
+size_t roundUp(size_t size, size_t alignment) {
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+size_t readHugePageSize() {
+#if defined(__linux__)
+    std::ifstream meminfo("/proc/meminfo");
+    std::string line;
+    const std::string field = "Hugepagesize:";
+    while (std::getline(meminfo, line)) {
+        if (line.compare(0, field.size(), field) != 0)
+            continue;
+        try {
+            return static_cast<size_t>(std::stoull(line.substr(field.size()))) * 1024;
+        } catch (const std::exception&) {
+            return 0;
+        }
+    }
+#endif
+    return 0;
+}
+
+}  // namespace
+
+HugePagesAllocator::HugePagesAllocator(Mode mode, int numaNodeId) : mode(mode), numaNodeId(numaNodeId) {}
+
+HugePagesAllocator::~HugePagesAllocator() {
+    // the huge pages come from the pool shared by all processes, so the mappings which were not freed by their owners
+    // (the graph workspace and the request blobs) are returned to the system here rather than left until the exit
+    std::vector<void*> handles;
+    for (auto& mapping : mappings)
+        handles.push_back(mapping.first);
+    for (auto handle : handles)
+        free(handle);
+}
+
+size_t HugePagesAllocator::hugePageSize() {
+    static const size_t size = readHugePageSize();
+    return size;
+}
+
+bool HugePagesAllocator::map(size_t size, Mapping& mapping) {
+#if defined(__linux__)
+    const size_t hugePage = hugePageSize();
+    if (hugePage == 0 || size < hugePage)
+        return false;
+
+    mapping.size = size;
+    if (mode == Mode::Explicit) {
+        std::vector<size_t> pageSizes;
+        if (size >= gigantic && hugePage != gigantic)
+            pageSizes.push_back(gigantic);
+        pageSizes.push_back(hugePage);
+        for (auto pageSize : pageSizes) {
+            int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB;
+            if (pageSize != hugePage) {
+                int log2 = 0;
+                while ((size_t(1) << log2) < pageSize) log2++;
+                flags |= log2 << MAP_HUGE_SHIFT;
+            }
+            const size_t mappedSize = roundUp(size, pageSize);
+            // fails immediately if the pool doesn't have enough pages since the pages are reserved on mmap
+            void* ptr = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, flags, -1, 0);
+            if (ptr == MAP_FAILED)
+                continue;
+            mapping.base = ptr;
+            mapping.mappedSize = mappedSize;
+            mapping.pageSize = pageSize;
+            mapping.explicitPages = true;
+            return true;
+        }
+        explicitFallbacks++;
+    }
+
+    // the transparent huge pages are only used for the aligned ranges, so the mapping is aligned by trimming
+    const size_t mappedSize = roundUp(size, hugePage);
+    void* raw = mmap(nullptr, mappedSize + hugePage, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED)
+        return false;
+    auto rawBegin = reinterpret_cast<uintptr_t>(raw);
+    auto begin = roundUp(rawBegin, hugePage);
+    if (begin != rawBegin)
+        munmap(raw, begin - rawBegin);
+    const size_t tail = rawBegin + mappedSize + hugePage - (begin + mappedSize);
+    if (tail != 0)
+        munmap(reinterpret_cast<void*>(begin + mappedSize), tail);
+
+    auto ptr = reinterpret_cast<void*>(begin);
+    // the memory is still usable if THP are disabled, the statistics show it
+    madvise(ptr, mappedSize, MADV_HUGEPAGE);
+    mapping.base = ptr;
+    mapping.mappedSize = mappedSize;
+    mapping.pageSize = getPageSize();
+    mapping.explicitPages = false;
+    return true;
+#else
+    return false;
+#endif
+}
+
+void HugePagesAllocator::prefault(const Mapping& mapping) const {
+    placeOnNumaNode(mapping.base, mapping.mappedSize, numaNodeId);
+    // the first write of each page makes the kernel allocate it (a whole huge page for THP aligned ranges)
+    auto bytes = static_cast<volatile uint8_t*>(mapping.base);
+    for (size_t offset = 0; offset < mapping.mappedSize; offset += mapping.pageSize)
+        bytes[offset] = 0;
+}
+
+void* HugePagesAllocator::alloc(size_t size) noexcept {
+    Mapping mapping {nullptr, 0, size, 0, false};
+    void* handle = nullptr;
+    if (map(size, mapping)) {
+        prefault(mapping);
+        handle = mapping.base;
+    } else {
+        handle = new (std::nothrow) char[size];
+        if (handle == nullptr)
+            return nullptr;
+    }
+
+    try {
+        std::lock_guard<std::mutex> lock(guard);
+        mappings.emplace(handle, mapping);
+    } catch (...) {
+#if defined(__linux__)
+        if (mapping.mappedSize != 0)
+            munmap(mapping.base, mapping.mappedSize);
+        else
+#endif
+            delete[] static_cast<char*>(handle);
+        return nullptr;
+    }
+    allocations++;
+    allocatedBytes += size;
+    return handle;
+}
+
+bool HugePagesAllocator::free(void* handle) noexcept {
+    Mapping mapping;
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        auto it = mappings.find(handle);
+        if (it == mappings.end())
+            return false;
+        mapping = it->second;
+        mappings.erase(it);
+    }
+    allocations--;
+    allocatedBytes -= mapping.size;
+#if defined(__linux__)
+    if (mapping.mappedSize != 0)
+        return munmap(mapping.base, mapping.mappedSize) == 0;
+#endif
+    delete[] static_cast<char*>(handle);
+    return true;
+}
+
+std::map<std::string, uint64_t> HugePagesAllocator::getStatistics() const {
+    std::vector<Mapping> transparent;
+    uint64_t mappedBytes = 0;
+    uint64_t explicitBytes = 0;
+    uint64_t explicitPages = 0;
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        for (auto& entry : mappings) {
+            auto& mapping = entry.second;
+            mappedBytes += mapping.mappedSize;
+            if (mapping.explicitPages) {
+                explicitBytes += mapping.mappedSize;
+                explicitPages += mapping.mappedSize / mapping.pageSize;
+            } else if (mapping.mappedSize != 0) {
+                transparent.push_back(mapping);
+            }
+        }
+    }
+
+    uint64_t transparentBytes = 0;
+#if defined(__linux__)
+    if (!transparent.empty()) {
+        // the kernel reports the huge pages per VMA, VMAs of the adjacent mappings may be merged
+        std::ifstream smaps("/proc/self/smaps");
+        std::string line;
+        const std::string field = "AnonHugePages:";
+        uint64_t overlap = 0;
+        while (std::getline(smaps, line)) {
+            if (line.compare(0, field.size(), field) == 0) {
+                if (overlap != 0) {
+                    try {
+                        transparentBytes += std::min<uint64_t>(std::stoull(line.substr(field.size())) * 1024, overlap);
+                    } catch (const std::exception&) {}
+                }
+                continue;
+            }
+            const auto dash = line.find('-');
+            const auto space = line.find(' ');
+            if (dash == std::string::npos || space == std::string::npos || dash > space)
+                continue;
+            try {
+                const uint64_t vmaBegin = std::stoull(line.substr(0, dash), nullptr, 16);
+                const uint64_t vmaEnd = std::stoull(line.substr(dash + 1, space - dash - 1), nullptr, 16);
+                overlap = 0;
+                for (auto& mapping : transparent) {
+                    const auto begin = std::max<uint64_t>(vmaBegin, reinterpret_cast<uintptr_t>(mapping.base));
+                    const auto end = std::min<uint64_t>(vmaEnd, reinterpret_cast<uintptr_t>(mapping.base) + mapping.mappedSize);
+                    if (begin < end)
+                        overlap += end - begin;
+                }
+            } catch (const std::exception&) {
+                // not a VMA header
+            }
+        }
+    }
+#endif
+
+    const uint64_t allocated = allocatedBytes.load();
+    const uint64_t hugeBytes = explicitBytes + transparentBytes;
+    const uint64_t smallBytes = allocated > hugeBytes ? allocated - hugeBytes : 0;
+    const uint64_t hugePage = hugePageSize();
+    const uint64_t tlbEntries = explicitPages + (hugePage ? transparentBytes / hugePage : 0) +
+                                roundUp(smallBytes, getPageSize()) / getPageSize();
+
+    return {
+        {"allocations", allocations.load()},
+        {"allocated_bytes", allocated},
+        {"mapped_bytes", mappedBytes},
+        {"explicit_huge_page_bytes", explicitBytes},
+        {"transparent_huge_page_bytes", transparentBytes},
+        {"small_page_bytes", smallBytes},
+        {"tlb_entries", tlbEntries},
+        {"explicit_fallbacks", explicitFallbacks.load()},
+    };
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,92 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_allocator.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Allocator backing the large buffers (graph workspaces, request blobs) with huge pages to reduce TLB misses
+ *
+ * Allocations of at least one huge page are mapped separately and rounded up to the huge page size. The Explicit mode
+ * maps them from the hugetlbfs pool (MAP_HUGETLB, 1G pages for the buffers of 1G and larger if the pool has them) and
+ * falls back to the transparent huge pages if the pool is exhausted. The Transparent mode aligns the mapping to the
+ * huge page and advises the kernel to back it with huge pages (madvise(MADV_HUGEPAGE)).
+ * The mapped memory is placed on the NUMA node of the allocator and pre-faulted, so the page faults happen on the
+ * network loading rather than on the first inference. Smaller allocations go to the regular heap.
+ * On the systems other than Linux all allocations go to the regular heap.
+ */
+class HugePagesAllocator : public InferenceEngine::IAllocator {
+public:
+    enum class Mode {
+        Transparent,
+        Explicit
+    };
+
+    using Ptr = std::shared_ptr<HugePagesAllocator>;
+
+    explicit HugePagesAllocator(Mode mode, int numaNodeId = -1);
+    ~HugePagesAllocator();
+
+    void* lock(void* handle, InferenceEngine::LockOp = InferenceEngine::LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(size_t size) noexcept override;
+    bool free(void* handle) noexcept override;
+
+    /**
+     * @brief Statistics of the memory currently allocated, in bytes unless stated otherwise:
+     *  - allocations: number of the live allocations
+     *  - allocated_bytes: requested size of the live allocations
+     *  - mapped_bytes: size of the huge page aligned mappings
+     *  - explicit_huge_page_bytes: memory mapped from the hugetlbfs pool
+     *  - transparent_huge_page_bytes: memory backed with the transparent huge pages by the kernel (from /proc/self/smaps)
+     *  - small_page_bytes: the rest of the allocated memory
+     *  - tlb_entries: estimated number of the TLB entries covering the allocated memory
+     *  - explicit_fallbacks: number of the explicit huge page allocations mapped as transparent ones
+     */
+    std::map<std::string, uint64_t> getStatistics() const;
+
+    /**
+     * @brief Default huge page size of the system, 0 if the huge pages are not supported
+     */
+    static size_t hugePageSize();
+
+private:
+    struct Mapping {
+        void* base;
+        size_t mappedSize;
+        size_t size;
+        size_t pageSize;
+        bool explicitPages;
+    };
+
+    bool map(size_t size, Mapping& mapping);
+    void prefault(const Mapping& mapping) const;
+
+    const Mode mode;
+    const int numaNodeId;
+
+    mutable std::mutex guard;
+    std::unordered_map<void*, Mapping> mappings;
+
+    std::atomic<uint64_t> allocations {0};
+    std::atomic<uint64_t> allocatedBytes {0};
+    std::atomic<uint64_t> explicitFallbacks {0};
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,164 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "numa_utils.h"
+
+#include <ie_system_conf.h>
+
+#include <cstdint>
+#include <new>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+// Values of the kernel API, numaif.h is a part of libnuma which is not required
+constexpr int mpolPreferred = 1;
+constexpr unsigned mpolMfMove = 1u << 1;
+constexpr unsigned long mpolFNode = 1ul << 0;
+constexpr unsigned long mpolFAddr = 1ul << 1;
+
+bool hasSeveralNumaNodes() {
+    static const bool several = InferenceEngine::getAvailableNUMANodes().size() > 1;
+    return several;
+}
+
+size_t getPageSize() {
+#if defined(__linux__)
+    static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return pageSize;
+#else
+    return 4096;
+#endif
+}
+
+bool bindPages(void* ptr, size_t size, int numaNodeId) {
+#if defined(__linux__) && defined(SYS_mbind)
+    constexpr size_t bitsPerLong = sizeof(unsigned long) * 8;
+    std::vector<unsigned long> nodeMask(numaNodeId / bitsPerLong + 1, 0);
+    nodeMask[numaNodeId / bitsPerLong] |= 1ul << (numaNodeId % bitsPerLong);
+    // the kernel reads maxnode - 1 bits
+    const unsigned long maxNode = nodeMask.size() * bitsPerLong + 1;
+    return syscall(SYS_mbind, ptr, size, mpolPreferred, nodeMask.data(), maxNode, mpolMfMove) == 0;
+#else
+    return false;
+#endif
+}
+
+}  // namespace
+
+bool canPlaceOnNumaNode(int numaNodeId) {
+#if defined(__linux__) && defined(SYS_mbind)
+    return numaNodeId >= 0 && hasSeveralNumaNodes();
+#else
+    return false;
+#endif
+}
+
+bool placeOnNumaNode(void* ptr, size_t size, int numaNodeId) {
+    if (ptr == nullptr || !canPlaceOnNumaNode(numaNodeId))
+        return false;
+
+    const size_t pageSize = getPageSize();
+    const auto begin = reinterpret_cast<uintptr_t>(ptr);
+    const auto alignedBegin = (begin + pageSize - 1) / pageSize * pageSize;
+    const auto alignedEnd = (begin + size) / pageSize * pageSize;
+    // the pages shared with other allocations are left as is
+    if (alignedEnd <= alignedBegin)
+        return false;
+
+    return bindPages(reinterpret_cast<void*>(alignedBegin), alignedEnd - alignedBegin, numaNodeId);
+}
+
+int getNumaNodeOf(const void* ptr) {
+#if defined(__linux__) && defined(SYS_get_mempolicy)
+    if (ptr == nullptr || !hasSeveralNumaNodes())
+        return -1;
+    int node = -1;
+    if (syscall(SYS_get_mempolicy, &node, nullptr, 0ul, ptr, mpolFNode | mpolFAddr) != 0)
+        return -1;
+    return node;
+#else
+    return -1;
+#endif
+}
+
+NumaAllocator::NumaAllocator(int numaNodeId) : numaNodeId(numaNodeId) {}
+
+NumaAllocator::~NumaAllocator() {
+    // the owners of the memory hold the allocator, so nothing is expected to be left here
+    std::vector<void*> handles;
+    for (auto& mapping : mappings)
+        handles.push_back(mapping.first);
+    for (auto handle : handles)
+        free(handle);
+}
+
+size_t NumaAllocator::minPlacedSize() {
+    return getPageSize();
+}
+
+void* NumaAllocator::alloc(size_t size) noexcept {
+    void* handle = nullptr;
+    size_t mappedSize = 0;
+#if defined(__linux__)
+    if (size >= minPlacedSize() && canPlaceOnNumaNode(numaNodeId)) {
+        const size_t pageSize = getPageSize();
+        const size_t alignedSize = (size + pageSize - 1) / pageSize * pageSize;
+        void* ptr = mmap(nullptr, alignedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ptr != MAP_FAILED) {
+            // the pages are not touched yet, so they are allocated on the node
+            placeOnNumaNode(ptr, alignedSize, numaNodeId);
+            handle = ptr;
+            mappedSize = alignedSize;
+        }
+    }
+#endif
+    if (handle == nullptr) {
+        handle = new (std::nothrow) char[size];
+        if (handle == nullptr)
+            return nullptr;
+    }
+
+    try {
+        std::lock_guard<std::mutex> lock(guard);
+        mappings.emplace(handle, mappedSize);
+    } catch (...) {
+#if defined(__linux__)
+        if (mappedSize != 0)
+            munmap(handle, mappedSize);
+        else
+#endif
+            delete[] static_cast<char*>(handle);
+        return nullptr;
+    }
+    return handle;
+}
+
+bool NumaAllocator::free(void* handle) noexcept {
+    size_t mappedSize = 0;
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        auto it = mappings.find(handle);
+        if (it == mappings.end())
+            return false;
+        mappedSize = it->second;
+        mappings.erase(it);
+    }
+#if defined(__linux__)
+    if (mappedSize != 0)
+        return munmap(handle, mappedSize) == 0;
+#endif
+    delete[] static_cast<char*>(handle);
+    return true;
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,78 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_allocator.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Returns true if the memory can be placed on the NUMA node: the node is not negative, the system has several
+ * NUMA nodes and supports the memory binding
+ */
+bool canPlaceOnNumaNode(int numaNodeId);
+
+/**
+ * @brief Places the memory on the NUMA node
+ *
+ * On Linux the pages are bound with the mbind system call (the preferred policy, so the allocation does not fail if
+ * the node is out of memory). The pages which are already allocated are moved to the node, the others are allocated
+ * there on the first touch.
+ * The memory must be a mapping of its own (e.g. allocated with mmap) rather than a part of the heap: the binding splits
+ * the mapping covering the memory and stays on the pages after they are freed and reused by the other allocations.
+ * Does nothing on the systems with a single NUMA node.
+ * @param ptr memory to place
+ * @param size size of the memory in bytes, only the pages lying completely inside the memory are placed
+ * @param numaNodeId NUMA node, negative values mean no placement
+ * @return true if the memory was placed
+ */
+bool placeOnNumaNode(void* ptr, size_t size, int numaNodeId);
+
+/**
+ * @brief Returns the NUMA node where the page containing the address is allocated, -1 if it can't be determined
+ */
+int getNumaNodeOf(const void* ptr);
+
+/**
+ * @brief Allocator of the memory placed on the NUMA node
+ *
+ * Allocations of at least one page are mapped separately and placed on the node before their pages are touched.
+ * Smaller allocations, and all of them if the memory can't be placed on the node, go to the regular heap.
+ */
+class NumaAllocator : public InferenceEngine::IAllocator {
+public:
+    using Ptr = std::shared_ptr<NumaAllocator>;
+
+    explicit NumaAllocator(int numaNodeId);
+    ~NumaAllocator();
+
+    void* lock(void* handle, InferenceEngine::LockOp = InferenceEngine::LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(size_t size) noexcept override;
+    bool free(void* handle) noexcept override;
+
+    /**
+     * @brief Minimal size of the allocations placed on the node
+     */
+    static size_t minPlacedSize();
+
+private:
+    const int numaNodeId;
+
+    std::mutex guard;
+    // size of the mapping, 0 for the heap allocations
+    std::unordered_map<void*, size_t> mappings;
+};
+
+}  // namespace MKLDNNPlugin
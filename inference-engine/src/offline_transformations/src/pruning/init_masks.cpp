@@ -16,6 +16,7 @@ namespace pass {
 namespace init_masks {
 
 class InitConvMask;
+class InitMatMulMask;
 
 } // namespace init_masks
 } // namespace pass
@@ -57,8 +58,49 @@ public:
     }
 };
 
+class ngraph::pass::init_masks::InitMatMulMask : public MatcherPass {
+public:
+    InitMatMulMask() {
+        auto a = pattern::any_input();
+        auto b = pattern::any_input(pattern::has_static_rank());
+        auto matmul = pattern::wrap_type<opset6::MatMul>({a, b});
+
+        ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+            const auto & pattern_map = m.get_pattern_value_map();
+            const auto & m_output = pattern_map.at(matmul);
+            auto matmul_node = std::dynamic_pointer_cast<opset6::MatMul>(m_output.get_node_shared_ptr());
+            if (!matmul_node) return false;
+
+            const auto b_rank = pattern_map.at(b).get_partial_shape().rank().get_length();
+            if (b_rank < 2) return false;
+
+            // Looking for Const node with weights, only the decompression and quantization nodes keeping the weights
+            // layout are expected between it and MatMul (the second input may be an activation, e.g. in attention)
+            auto cur_node = m_output.get_node()->get_input_node_shared_ptr(1);
+            while (ngraph::is_type<opset6::Convert>(cur_node) || ngraph::is_type<opset6::FakeQuantize>(cur_node)) {
+                cur_node = cur_node->get_input_node_shared_ptr(0);
+            }
+            if (!ngraph::is_type<opset6::Constant>(cur_node) ||
+                cur_node->get_shape().size() != static_cast<size_t>(b_rank)) {
+                NGRAPH_DEBUG << "Can't find Constant weights for MatMul: " <<
+                m_output.get_node()->get_friendly_name() << std::endl;
+                return false;
+            }
+
+            // Init mask for the output channels dim of the weights
+            const size_t out_channel_dim = matmul_node->get_transpose_b() ? b_rank - 2 : b_rank - 1;
+            InitConstMask({out_channel_dim}).apply(cur_node);
+            return true;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(matmul, "MatMulInitMask");
+        register_matcher(m, callback);
+    }
+};
+
 
 ngraph::pass::InitMasks::InitMasks() {
     add_matcher<init_masks::InitConvMask>();
+    add_matcher<init_masks::InitMatMulMask>();
 }
 
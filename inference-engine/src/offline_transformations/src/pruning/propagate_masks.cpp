@@ -5,10 +5,15 @@
 #include "pruning.hpp"
 #include "mask_attribute.hpp"
 
+#include <algorithm>
+
 #include <ngraph/pattern/op/wrap_type.hpp>
+#include <ngraph/pattern/op/or.hpp>
 #include <ngraph/opsets/opset6.hpp>
 #include <ngraph/opsets/opset5.hpp>
+#include <ngraph/opsets/opset7.hpp>
 #include <ngraph/log.hpp>
+#include <ngraph/validation_util.hpp>
 #include <ngraph/rt_info.hpp>
 
 NGRAPH_RTTI_DEFINITION(ngraph::pass::PropagateMasks, "PropagateMasks", 0);
@@ -19,11 +24,13 @@ namespace mask_propagation {
 
 class Convolution;
 class GroupConvolution;
+class MatMul;
 class Elementwise;
 class PassThrough;
 class StopPropagation;
 class FakeQuantize;
 class Concat;
+class Split;
 class Reshape;
 
 } // namespace mask_propagation
@@ -137,7 +144,7 @@ public:
             auto weights_mask = getMask(m_weights);
             if (!weights_mask) {
                 // Setting mask only if weights are constant
-                if (ngraph::is_type<opset6::Constant>(m_output.get_node_shared_ptr())) {
+                if (ngraph::is_type<opset6::Constant>(m_weights.get_node_shared_ptr())) {
                     weights_mask = std::make_shared<Mask>(weights_shape.size());
                     setMask(m_weights, weights_mask);
                 } else {
@@ -192,6 +199,87 @@ public:
     }
 };
 
+class ngraph::pass::mask_propagation::MatMul : public MatcherPass {
+public:
+    MatMul() {
+        auto a = pattern::any_input(pattern::has_static_rank());
+        auto b = pattern::any_input(pattern::has_static_shape());
+        auto matmul = pattern::wrap_type<opset6::MatMul>({a, b}, pattern::has_static_rank());
+
+        ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+            const auto & pattern_map = m.get_pattern_value_map();
+            const auto & m_a = pattern_map.at(a);
+            const auto & m_b = pattern_map.at(b);
+            const auto & m_output = pattern_map.at(matmul);
+            auto matmul_node = std::dynamic_pointer_cast<opset6::MatMul>(m_output.get_node_shared_ptr());
+            if (!matmul_node) return false;
+
+            const auto a_rank = m_a.get_partial_shape().rank().get_length();
+            const auto b_rank = static_cast<int64_t>(m_b.get_shape().size());
+            const auto out_rank = m_output.get_partial_shape().rank().get_length();
+            // 1D inputs are unsqueezed, so there is no channel dim to prune
+            if (a_rank < 2 || b_rank < 2) return false;
+
+            // Weights mask is initialized in the InitMasks pass, if it's absent the MatMul can't be pruned
+            auto weights_mask = getMask(m_b);
+            if (!weights_mask) {
+                NGRAPH_DEBUG << "No weights mask for " << m_output.get_node()->get_friendly_name() << "\n";
+                return false;
+            }
+            auto weights_mask_row = weights_mask.get();
+
+            const size_t a_reduce_dim = matmul_node->get_transpose_a() ? a_rank - 2 : a_rank - 1;
+            const size_t b_reduce_dim = matmul_node->get_transpose_b() ? b_rank - 1 : b_rank - 2;
+            const size_t b_out_dim = matmul_node->get_transpose_b() ? b_rank - 2 : b_rank - 1;
+            const size_t out_dim = out_rank - 1;
+
+            if (auto input_mask = getMask(m_a)) {
+                auto input_mask_row = input_mask.get();
+                // Reduction dim of the weights is connected to the channel dim of the input
+                weights_mask->add_callback([input_mask_row, a_reduce_dim, b_reduce_dim](Mask::Ptr cur_mask) -> bool {
+                    cur_mask->at(b_reduce_dim) = input_mask_row->at(a_reduce_dim);
+                    return true;
+                }, input_mask);
+
+                // Other input dims are not propagated to the output mask, so they can't be pruned
+                input_mask->add_callback([weights_mask_row, a_reduce_dim, b_reduce_dim](Mask::Ptr cur_mask) -> bool {
+                    cur_mask->clean_dim_values();
+                    cur_mask->at(a_reduce_dim) = weights_mask_row->at(b_reduce_dim);
+                    return true;
+                }, weights_mask);
+
+                if (!weights_mask->apply_callback(input_mask)) {
+                    return false;
+                }
+            }
+
+            // Output mask describes which channels (the last dim) will be removed
+            auto matmul_mask = std::make_shared<Mask>(out_rank);
+            auto matmul_mask_row = matmul_mask.get();
+
+            matmul_mask->add_callback([weights_mask_row, b_out_dim, out_dim](Mask::Ptr cur_mask) -> bool {
+                cur_mask->at(out_dim) = weights_mask_row->at(b_out_dim);
+                return true;
+            }, weights_mask);
+
+            weights_mask->add_callback([matmul_mask_row, b_out_dim, out_dim](Mask::Ptr cur_mask) -> bool {
+                cur_mask->at(b_out_dim) = matmul_mask_row->at(out_dim);
+                return true;
+            }, matmul_mask);
+
+            if (!matmul_mask->apply_callback(weights_mask)) {
+                return false;
+            }
+
+            setMask(m_output, matmul_mask);
+            return true;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(matmul, "MatMulMaskPropagation");
+        register_matcher(m, callback);
+    }
+};
+
 class ngraph::pass::mask_propagation::Reshape : public MatcherPass {
 public:
     Reshape() {
@@ -287,18 +375,22 @@ public:
             const auto & input_rank = m_input.get_partial_shape().rank().get_length();
             const auto & weights_rank = m_weights.get_partial_shape().rank().get_length();
             // Here assuming that masks can be propagated only through 3/4 dimensional tensors
-            // (since channel dim is necessary)
-            if (weights_rank < 3 || input_rank < 3) return false;
+            // (since channel dim is necessary) and through 2 dimensional MatMul outputs with the broadcasted
+            // per-channel constants (e.g. biases of shape [C])
+            const bool is_2d = std::max(input_rank, weights_rank) == 2;
+            if (is_2d ? std::min(input_rank, weights_rank) < 1 : (weights_rank < 3 || input_rank < 3)) return false;
+            const AxisSet input_const_dims = input_rank == 1 ? AxisSet{0} : AxisSet{0, 1};
+            const AxisSet weights_const_dims = weights_rank == 1 ? AxisSet{0} : AxisSet{0, 1};
 
             // In case if first of the inputs is constant
-            InitConstMask({0, 1/* potential output channel dim */}).apply(m_input.get_node_shared_ptr());
+            InitConstMask(input_const_dims/* potential output channel dim */).apply(m_input.get_node_shared_ptr());
             auto input_mask = getMask(m_input);
             if (!input_mask) {
                 NGRAPH_DEBUG << "No input mask for: " << m_output.get_node()->get_friendly_name() << std::endl;
                 return false;
             }
 
-            InitConstMask({0, 1}).apply(m_weights.get_node_shared_ptr());
+            InitConstMask(weights_const_dims).apply(m_weights.get_node_shared_ptr());
 
             auto weights_mask = getMask(m_weights);
             if (!weights_mask) {
@@ -557,12 +649,90 @@ public:
     }
 };
 
+class ngraph::pass::mask_propagation::Split : public MatcherPass {
+public:
+    Split() {
+        auto input = pattern::any_input(pattern::has_static_rank());
+        auto axis = pattern::wrap_type<opset6::Constant>();
+        auto split = pattern::wrap_type<opset6::Split>({input, axis});
+        auto variadic_split = pattern::wrap_type<opset6::VariadicSplit>({input, axis, pattern::any_input()});
+        auto any_split = std::make_shared<pattern::op::Or>(OutputVector{split, variadic_split});
+
+        ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+            const auto & pattern_map = m.get_pattern_value_map();
+            const auto & m_input = pattern_map.at(input);
+            auto split_node = m.get_match_root();
+
+            auto input_mask = getMask(m_input);
+            if (!input_mask) return false;
+            auto input_mask_row = input_mask.get();
+
+            const auto rank = m_input.get_partial_shape().rank().get_length();
+            auto axis_value = std::dynamic_pointer_cast<opset6::Constant>(pattern_map.at(axis).get_node_shared_ptr())
+                    ->cast_vector<int64_t>();
+            if (axis_value.size() != 1) return false;
+            const size_t split_dim = axis_value[0] < 0 ? axis_value[0] + rank : axis_value[0];
+
+            // Pruning along the split dim would change the split lengths, so the channels are pruned only if
+            // the tensor is split by the other dim. The outputs share the input mask except the split dim which
+            // is cleared in the input mask as well when the output masks are propagated back.
+            for (auto & output : split_node->outputs()) {
+                auto output_mask = std::make_shared<Mask>(rank);
+                auto output_mask_row = output_mask.get();
+
+                output_mask->add_callback([input_mask_row, split_dim](Mask::Ptr cur_mask) -> bool {
+                    cur_mask->copy_value_from_mask(input_mask_row);
+                    cur_mask->at(split_dim).clear();
+                    return true;
+                }, input_mask);
+
+                input_mask->add_callback([output_mask_row, split_dim](Mask::Ptr cur_mask) -> bool {
+                    cur_mask->copy_value_from_mask(output_mask_row);
+                    return true;
+                }, output_mask);
+
+                if (!output_mask->apply_callback(input_mask)) {
+                    return false;
+                }
+                setMask(output, output_mask);
+            }
+            return true;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(any_split, "SplitMaskPropagation");
+        register_matcher(m, callback);
+    }
+};
+
+// The pruned channels are zero, so the mask passes through the operation only if it keeps the zero channels zero.
+// Clamp with bounds not containing zero and Pad with non-zero constant value don't.
+bool keeps_zeros(const ngraph::Output<ngraph::Node>& output) {
+    const auto node = output.get_node_shared_ptr();
+    if (auto clamp = ngraph::as_type_ptr<ngraph::opset6::Clamp>(node))
+        return clamp->get_min() <= 0. && clamp->get_max() >= 0.;
+    if (auto pad = ngraph::as_type_ptr<ngraph::opset6::Pad>(node)) {
+        if (pad->get_pad_mode() != ngraph::op::PadMode::CONSTANT || pad->get_input_size() < 4)
+            return true;
+        auto pad_value = ngraph::get_constant_from_source(pad->input_value(3));
+        if (!pad_value)
+            return false;
+        const auto values = pad_value->cast_vector<double>();
+        return std::all_of(values.begin(), values.end(), [](double value) { return value == 0.; });
+    }
+    return true;
+}
+
 class ngraph::pass::mask_propagation::PassThrough : public MatcherPass {
 public:
     PassThrough() {
-        auto unary_op = pattern::wrap_type<op::util::UnaryElementwiseArithmetic, opset6::Clamp,
+        // Elementwise operations with f(0) = 0, the others (e.g. Sigmoid, Exp, Cos) are handled by StopPropagation
+        auto unary_op = pattern::wrap_type<opset6::Relu, opset6::Abs, opset6::Negative, opset6::Sign,
+                                            opset6::Floor, opset6::Ceiling, opset6::Sqrt, opset6::Erf,
+                                            opset6::Sin, opset6::Sinh, opset6::Asin, opset6::Asinh,
+                                            opset6::Tan, opset6::Tanh, opset6::Atan, opset6::Atanh,
+                                            opset6::Gelu, opset7::Gelu, opset6::HSwish, opset6::Clamp,
                                             opset6::Convert, opset6::ConvertLike, opset6::AvgPool, opset6::MaxPool,
-                                            opset6::ROIPooling, opset6::PSROIPooling, opset6::Pad>();
+                                            opset6::ROIPooling, opset6::PSROIPooling, opset6::Pad>(keeps_zeros);
 
         ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
             const auto & pattern_map = m.get_pattern_value_map();
@@ -606,10 +776,12 @@ public:
 ngraph::pass::PropagateMasks::PropagateMasks() {
     add_matcher<mask_propagation::Convolution>();
     add_matcher<mask_propagation::GroupConvolution>();
+    add_matcher<mask_propagation::MatMul>();
     add_matcher<mask_propagation::Elementwise>();
     add_matcher<mask_propagation::PassThrough>();
     add_matcher<mask_propagation::FakeQuantize>();
     add_matcher<mask_propagation::Concat>();
+    add_matcher<mask_propagation::Split>();
     add_matcher<mask_propagation::Reshape>();
     add_matcher<mask_propagation::StopPropagation>();
 }
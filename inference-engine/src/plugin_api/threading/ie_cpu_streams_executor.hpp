@@ -42,6 +42,24 @@ public:
 
     void run(Task task) override;
 
+    /**
+     * @brief Enqueues the task with the priority. Streams take tasks with the higher priority from the shared queue
+     *        first, tasks with the same priority are executed in the FIFO order. run(Task) uses the zero priority.
+     * @param task A task to start
+     * @param priority The task priority
+     * @param owner The task owner, e.g. an executable network. Tasks with the owner may be executed by
+     *        RunPreemptingTasks(), except the tasks of the owners which already have tasks running on the same stream thread.
+     *        Tasks without the owner are never executed in place of the preempted task.
+     */
+    void run(Task task, int priority, const void* owner = nullptr);
+
+    /**
+     * @brief Cooperative preemption point. Being called from a task running on the stream thread, executes in place
+     *        the queued tasks which have higher priority than the running task.
+     * @return true if any task was executed
+     */
+    bool RunPreemptingTasks();
+
     void Execute(Task task) override;
 
     int GetStreamId() override;
@@ -9,6 +9,7 @@
 #include <deque>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <ngraph/ngraph.hpp>
 #include <ngraph/op/util/sub_graph_base.hpp>
 #include <ngraph/op/util/variable.hpp>
@@ -30,6 +31,7 @@
 
 #include <cpp/ie_cnn_network.h>
 #include <ie_ngraph_utils.hpp>
+#include <ie_parallel.hpp>
 #include "blob_factory.hpp"
 #include "caseless.hpp"
 #include "precision_utils.h"
@@ -71,11 +73,14 @@ bool getParameters(const pugi::xml_node& node, const std::string& name, std::vec
     if (!getStrAttribute(node, name, param)) return false;
     std::stringstream ss(param);
     std::string field;
+    // construction of the stream is much more expensive than parsing of the short field
+    std::istringstream fs;
     while (getline(ss, field, ',')) {
         if (field.empty())
             IE_THROW() << "Cannot get vector of parameters! \"" << param
                                << "\" is incorrect";
-        std::stringstream fs(field);
+        fs.clear();
+        fs.str(field);
         T val;
         fs >> val;
         value.emplace_back(val);
@@ -83,6 +88,28 @@ bool getParameters(const pugi::xml_node& node, const std::string& name, std::vec
     return true;
 }
 
+/// \brief Calls func(i) for each i in [0, size) in parallel
+/// If some calls throw, the exception of the call with the lowest index is rethrown to make errors deterministic
+template <typename F>
+void parallelForEach(size_t size, const F& func) {
+    std::mutex errorMutex;
+    std::exception_ptr error;
+    size_t errorIndex = size;
+    parallel_for(size, [&](size_t i) {
+        try {
+            func(i);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (i < errorIndex) {
+                errorIndex = i;
+                error = std::current_exception();
+            }
+        }
+    });
+    if (error)
+        std::rethrow_exception(error);
+}
+
 template <class T>
 T stringToType(const std::string& valStr) {
     T ret{0};
@@ -114,8 +141,8 @@ public:
         std::transform(val.begin(), val.end(), val.begin(), [](char ch) {
             return std::tolower(static_cast<unsigned char>(ch));
         });
-        std::set<std::string> true_names{"true", "1"};
-        std::set<std::string> false_names{"false", "0"};
+        static const std::set<std::string> true_names{"true", "1"};
+        static const std::set<std::string> false_names{"false", "0"};
 
         bool is_true = true_names.find(val) != true_names.end();
         bool is_false = false_names.find(val) != false_names.end();
@@ -592,15 +619,25 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     std::unordered_set<std::string> opName;
 
     // Read all layers and store their parameters in params map
+    std::vector<pugi::xml_node> layers;
     FOREACH_CHILD(node, root.child("layers"), "layer") {
-        auto node_param = parseGenericParams(node);
+        layers.push_back(node);
+    }
+    // Layers are independent, most of the time is spent on parsing of the ports dimensions
+    std::vector<V10Parser::GenericLayerParams> layers_params(layers.size());
+    parallelForEach(layers.size(), [&](size_t i) {
+        layers_params[i] = parseGenericParams(layers[i]);
+    });
+    for (size_t i = 0; i < layers.size(); i++) {
+        auto& node_param = layers_params[i];
         if (opName.find(node_param.name) != opName.end() && node_param.type != "Result")
             IE_THROW() << "Invalid IR! " << node_param.name << " name is not unique!";
         opName.insert(node_param.name);
-        params[node_param.layerId] = {node, node_param};
+        const size_t layer_id = node_param.layerId;
         if (node_param.type == "Result" || node_param.type == "Assign") {
-            outputs.push_back(node_param.layerId);
+            outputs.push_back(layer_id);
         }
+        params[layer_id] = {layers[i], std::move(node_param)};
     }
 
     std::map<size_t/*to-layer-id*/, std::vector<edge>> edges;
@@ -634,27 +671,53 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
 
     std::map<std::string, std::shared_ptr<ngraph::Node>> variable_id_to_read_value;
 
+    // Constants and parameters of the default opsets are usually most of the layers. They have no inputs, and
+    // their creation only reads the XML and the weights: the opset factories are guarded by the registry mutex and
+    // these operations don't use variables or bodies. So they are created in parallel. Extension opsets can't
+    // reuse the default opset names, and their operations are created in the topological order with the rest.
+    static const std::unordered_set<std::string> default_opsets = {
+        "opset1", "opset2", "opset3", "opset4", "opset5", "opset6", "opset7", "opset8"};
+    std::vector<size_t> sources;
+    for (auto& layer_id : order) {
+        const auto& p = params[layer_id].params;
+        if (edges[layer_id].empty() && (p.type == "Const" || p.type == "Parameter") &&
+            default_opsets.count(p.version)) {
+            sources.push_back(layer_id);
+        }
+    }
+    std::vector<std::shared_ptr<ngraph::Node>> source_nodes(sources.size());
+    parallelForEach(sources.size(), [&](size_t i) {
+        const auto& p = params.at(sources[i]);
+        source_nodes[i] = createNode({}, p.xml, weights, p.params);
+    });
+    for (size_t i = 0; i < sources.size(); i++) {
+        id_to_node[sources[i]] = source_nodes[i];
+    }
+
     //  Following topological order create nGraph operations
     for (auto& layer_id : order) {
         auto& p = params[layer_id];
-        ngraph::OutputVector inputs(edges[layer_id].size());
-        for (auto& e : edges[layer_id]) {
-            auto input_node = id_to_node[e.fromLayerId];
-            if (!input_node) {
-                IE_THROW() << "Attempt to access node " << e.fromLayerId
-                                   << " that not in graph.";
+        auto node = id_to_node[layer_id];
+        if (!node) {
+            ngraph::OutputVector inputs(edges[layer_id].size());
+            for (auto& e : edges[layer_id]) {
+                auto input_node = id_to_node[e.fromLayerId];
+                if (!input_node) {
+                    IE_THROW() << "Attempt to access node " << e.fromLayerId
+                                       << " that not in graph.";
+                }
+                auto& p_output = params[e.fromLayerId].params;
+                size_t const realInputPortId = p.params.getRealInputPortId(e.toPortId);
+                if (realInputPortId >= inputs.size())
+                    IE_THROW() << p.params.type << " layer " << p.params.name
+                                       << " with id: " << p.params.layerId << " is inconsistent!";
+                inputs[realInputPortId] =
+                    input_node->output(p_output.getRealOutputPortId(e.fromPortId));
             }
-            auto& p_output = params[e.fromLayerId].params;
-            size_t const realInputPortId = p.params.getRealInputPortId(e.toPortId);
-            if (realInputPortId >= inputs.size())
-                IE_THROW() << p.params.type << " layer " << p.params.name
-                                   << " with id: " << p.params.layerId << " is inconsistent!";
-            inputs[realInputPortId] =
-                input_node->output(p_output.getRealOutputPortId(e.fromPortId));
-        }
 
-        auto node = createNode(inputs, p.xml, weights, p.params);
-        id_to_node[layer_id] = node;
+            node = createNode(inputs, p.xml, weights, p.params);
+            id_to_node[layer_id] = node;
+        }
 
         // Check that output shape after nGraph node validation the same as in IR
         // because IR always right!
@@ -3,10 +3,13 @@
 //
 
 #include "itt.hpp"
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <cassert>
 #include <cstdint>
 #include <fstream>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -76,42 +79,125 @@ size_t hash_combine(const void* v, int64_t size) {
     return seed;
 }
 
+// Calls func(i) for each i in [0, size) on the hardware threads, func must not throw
+template <typename F>
+void parallel_for_each(size_t size, const F& func) {
+    const size_t threads = std::min<size_t>(size, std::max(1u, std::thread::hardware_concurrency()));
+    if (threads <= 1) {
+        for (size_t i = 0; i < size; ++i) {
+            func(i);
+        }
+        return;
+    }
+    std::atomic<size_t> next{0};
+    auto worker = [&] {
+        for (size_t i = next++; i < size; i = next++) {
+            func(i);
+        }
+    };
+    std::vector<std::thread> pool;
+    for (size_t t = 1; t < threads; ++t) {
+        pool.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : pool) {
+        thread.join();
+    }
+}
+
+// Constants are collected during the XML generation and written by flush(): the data is hashed in parallel
+// chunks, deduplicated and streamed to the bin file directly from the constants memory, so neither the
+// hashing is on the critical path of the XML generation nor the bin content is buffered.
 class ConstantWriter {
 public:
     using FilePosition = int64_t;
     using HashValue = size_t;
-    using ConstWritePositions = std::unordered_map<HashValue, std::pair<FilePosition, void const *>>;
 
     ConstantWriter(std::ostream& bin_data, bool enable_compression = true)
         : m_binary_output(bin_data)
         , m_enable_compression(enable_compression) {
     }
 
-    FilePosition write(const char* ptr, size_t size) {
-        const auto offset = m_binary_output.tellp();
-        if (!m_enable_compression) {
-            m_binary_output.write(ptr, size);
-            return offset;
-        }
+    // The offset of the data in the bin file is set to the attribute by flush()
+    void write(const char* ptr, size_t size, pugi::xml_attribute offset_attribute) {
+        m_constants.push_back({ptr, size, offset_attribute});
+    }
+
+    void flush() {
+        const std::vector<HashValue> hashes = m_enable_compression ? hash_constants() : std::vector<HashValue>{};
+
         // This hash is weak (but efficient) and must be replace with some other
         // more stable hash algorithm. For example current hash algorithms gives
         // the same hash for {2, 2} and {0, 128} arrays. So we have to compare
         // values when finding a match in hash map.
-        const HashValue hash = hash_combine(ptr, size);
-        const auto found = m_hash_to_file_positions.find(hash);
-        if (found != end(m_hash_to_file_positions) &&
-            memcmp(static_cast<void const*>(ptr), found->second.second, size) == 0) {
-            return found->second.first;
+        std::unordered_map<HashValue, size_t> hash_to_constant;
+        std::vector<FilePosition> offsets(m_constants.size());
+        FilePosition offset = m_binary_output.tellp();
+        for (size_t i = 0; i < m_constants.size(); ++i) {
+            auto& constant = m_constants[i];
+            if (m_enable_compression) {
+                const auto found = hash_to_constant.find(hashes[i]);
+                if (found != end(hash_to_constant)) {
+                    const auto& same_hash = m_constants[found->second];
+                    if (same_hash.size == constant.size &&
+                        memcmp(constant.ptr, same_hash.ptr, constant.size) == 0) {
+                        offsets[i] = offsets[found->second];
+                        constant.offset_attribute.set_value(offsets[i]);
+                        continue;
+                    }
+                } else {
+                    hash_to_constant.insert({hashes[i], i});
+                }
+            }
+
+            m_binary_output.write(constant.ptr, constant.size);
+            offsets[i] = offset;
+            constant.offset_attribute.set_value(offset);
+            offset += static_cast<FilePosition>(constant.size);
+        }
+        m_constants.clear();
+    }
+
+private:
+    struct Constant {
+        const char* ptr;
+        size_t size;
+        pugi::xml_attribute offset_attribute;
+    };
+
+    // Large constants are split into chunks, so they are hashed by several threads
+    std::vector<HashValue> hash_constants() const {
+        constexpr size_t chunk_size = 1 << 20;
+        struct Chunk {
+            size_t constant;
+            size_t begin;
+            size_t size;
+        };
+        std::vector<Chunk> chunks;
+        for (size_t i = 0; i < m_constants.size(); ++i) {
+            const size_t size = m_constants[i].size;
+            size_t begin = 0;
+            do {
+                chunks.push_back({i, begin, std::min(chunk_size, size - begin)});
+                begin += chunk_size;
+            } while (begin < size);
         }
 
-        m_binary_output.write(ptr, size);
-        m_hash_to_file_positions.insert({hash, {offset, static_cast<void const *>(ptr)}});
+        std::vector<HashValue> chunk_hashes(chunks.size());
+        parallel_for_each(chunks.size(), [&](size_t i) {
+            const auto& chunk = chunks[i];
+            chunk_hashes[i] = hash_combine(m_constants[chunk.constant].ptr + chunk.begin, chunk.size);
+        });
 
-        return offset;
+        std::vector<HashValue> hashes(m_constants.size());
+        for (size_t i = 0; i < chunks.size(); ++i) {
+            auto& seed = hashes[chunks[i].constant];
+            seed = chunks[i].begin == 0 ? chunk_hashes[i] : seed ^ (chunk_hashes[i] + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+        }
+        return hashes;
     }
 
-private:
-    ConstWritePositions m_hash_to_file_positions;
+    std::vector<Constant> m_constants;
     std::ostream& m_binary_output;
     bool m_enable_compression;
 };
@@ -319,10 +405,9 @@ public:
         } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter)) {
             if (name == "value" &&  translate_type_name(m_node_type_name) == "Const") {
                 const int64_t size = a->get()->size();
-                int64_t offset = m_constant_write_handler.write(
-                    static_cast<const char *>(a->get()->get_ptr()), size);
-
-                m_xml_node.append_attribute("offset").set_value(offset);
+                // the offset is known when the constants are written to the bin file
+                auto offset = m_xml_node.append_attribute("offset");
+                m_constant_write_handler.write(static_cast<const char *>(a->get()->get_ptr()), size, offset);
                 m_xml_node.append_attribute("size").set_value(size);
             }
         } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<op::FrameworkNodeAttrs>>(&adapter)) {
@@ -827,6 +912,7 @@ bool pass::Serialize::run_on_function(std::shared_ptr<ngraph::Function> f) {
                 ConstantWriter constant_write_handler(bin_file);
                 XmlSerializer visitor(net_node, name, m_custom_opsets, constant_write_handler);
                 visitor.on_attribute(name, f);
+                constant_write_handler.flush();
 
                 xml_doc.save(xml_file);
                 xml_file.flush();
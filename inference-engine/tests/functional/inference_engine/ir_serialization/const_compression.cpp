@@ -3,6 +3,7 @@
 //
 
 #include <fstream>
+#include <vector>
 
 #include "common_test_utils/ngraph_test_utils.hpp"
 #include "ie_core.hpp"
@@ -136,6 +137,61 @@ TEST_F(SerializatioConstantCompressionTest, NonIdenticalConstantsI64) {
     ASSERT_TRUE(file_size(bin_1) == unique_const_count * ngraph::shape_size(shape) * sizeof(int64_t));
 }
 
+TEST_F(SerializatioConstantCompressionTest, NonIdenticalConstantsDifferentSizesSameHash) {
+    if (sizeof(size_t) != sizeof(int64_t))
+        GTEST_SKIP();
+
+    // hash_combine mixes in the size and then each 8-byte word, the mixing step is invertible for a known seed,
+    // so the last word of B is chosen to give the same hash as A
+    const auto mix = [](size_t seed, size_t value) {
+        return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+    };
+    const size_t target = mix(sizeof(int64_t), 1);
+    const size_t seed = mix(2 * sizeof(int64_t), 2);
+    const size_t last = (target ^ seed) - 0x9e3779b9 - (seed << 6) - (seed >> 2);
+    const std::vector<int64_t> a_values{1};
+    const std::vector<int64_t> b_values{2, static_cast<int64_t>(last)};
+
+    auto A = ngraph::op::Constant::create(ngraph::element::i64, ngraph::Shape{1}, a_values);
+    auto B = ngraph::op::Constant::create(ngraph::element::i64, ngraph::Shape{2}, b_values);
+
+    auto ngraph_a = std::make_shared<ngraph::Function>(ngraph::NodeVector{A, B},
+        ngraph::ParameterVector{});
+
+    ngraph::pass::Serialize(m_out_xml_path_1, m_out_bin_path_1).run_on_function(ngraph_a);
+
+    std::ifstream bin_1(m_out_bin_path_1, std::ios::binary);
+
+    ASSERT_EQ((a_values.size() + b_values.size()) * sizeof(int64_t), file_size(bin_1));
+    std::vector<int64_t> bin_values(a_values.size() + b_values.size());
+    bin_1.read(reinterpret_cast<char*>(bin_values.data()), bin_values.size() * sizeof(int64_t));
+    ASSERT_EQ(std::vector<int64_t>({a_values[0], b_values[0], b_values[1]}), bin_values);
+}
+
+TEST_F(SerializatioConstantCompressionTest, IdenticalLargeConstants) {
+    constexpr int unique_const_count = 2;
+    // larger than the hashing chunk, so the constants are hashed by several chunks
+    const ngraph::Shape shape{3, 1024, 1024};
+
+    std::vector<float> values(ngraph::shape_size(shape));
+    for (size_t i = 0; i < values.size(); i++)
+        values[i] = static_cast<float>(i % 251);
+    auto A = ngraph::op::Constant::create(ngraph::element::f32, shape, values);
+    auto B = ngraph::op::Constant::create(ngraph::element::f32, shape, values);
+    // differs from A in the last chunk only
+    values.back() += 1.f;
+    auto C = ngraph::op::Constant::create(ngraph::element::f32, shape, values);
+
+    auto ngraph_a = std::make_shared<ngraph::Function>(ngraph::NodeVector{A, B, C},
+        ngraph::ParameterVector{});
+
+    ngraph::pass::Serialize(m_out_xml_path_1, m_out_bin_path_1).run_on_function(ngraph_a);
+
+    std::ifstream bin_1(m_out_bin_path_1, std::ios::binary);
+
+    ASSERT_TRUE(file_size(bin_1) == unique_const_count * ngraph::shape_size(shape) * sizeof(float));
+}
+
 TEST_F(SerializatioConstantCompressionTest, IdenticalConstantsTimesTwo) {
     constexpr int unique_const_count = 2;
     const ngraph::Shape shape{2, 2, 2};
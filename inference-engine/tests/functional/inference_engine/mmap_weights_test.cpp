@@ -0,0 +1,105 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+#include "common_test_utils/file_utils.hpp"
+#include "common_test_utils/test_common.hpp"
+
+using namespace InferenceEngine;
+
+class MmapWeightsTests : public CommonTestUtils::TestsCommon {
+protected:
+    const std::string modelPath = "MmapWeightsTests.xml";
+    const std::string weightsPath = "MmapWeightsTests.bin";
+    std::vector<float> weights;
+
+    void SetUp() override {
+        CommonTestUtils::TestsCommon::SetUp();
+        weights.resize(4096);
+        for (size_t i = 0; i < weights.size(); i++)
+            weights[i] = static_cast<float>(i);
+
+        auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{weights.size()});
+        auto constant = std::make_shared<ngraph::opset1::Constant>(ngraph::element::f32, ngraph::Shape{weights.size()},
+                                                                   weights);
+        auto add = std::make_shared<ngraph::opset1::Add>(param, constant);
+        auto function = std::make_shared<ngraph::Function>(ngraph::NodeVector{add}, ngraph::ParameterVector{param});
+        CNNNetwork(function).serialize(modelPath, weightsPath);
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeIRFiles(modelPath, weightsPath);
+        CommonTestUtils::TestsCommon::TearDown();
+    }
+
+    static std::vector<float> getConstantValues(const CNNNetwork& network) {
+        for (const auto& op : network.getFunction()->get_ops()) {
+            if (auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(op))
+                return constant->cast_vector<float>();
+        }
+        return {};
+    }
+
+    void rewriteWeights() const {
+        std::ofstream file(weightsPath, std::ios::binary | std::ios::trunc);
+        file << "truncated";
+    }
+};
+
+TEST_F(MmapWeightsTests, weightsAreCopiedByDefault) {
+    Core ie;
+    auto network = ie.ReadNetwork(modelPath);
+    rewriteWeights();
+    EXPECT_EQ(weights, getConstantValues(network));
+}
+
+TEST_F(MmapWeightsTests, canSerializeToSourceFileByDefault) {
+    Core ie;
+    auto network = ie.ReadNetwork(modelPath);
+    ASSERT_NO_THROW(network.serialize(modelPath, weightsPath));
+    EXPECT_EQ(weights, getConstantValues(ie.ReadNetwork(modelPath)));
+}
+
+TEST_F(MmapWeightsTests, weightsAreCopiedIfMappingIsDisabled) {
+    Core ie;
+    ie.SetConfig({{CONFIG_KEY(MMAP_WEIGHTS), CONFIG_VALUE(YES)}});
+    ie.SetConfig({{CONFIG_KEY(MMAP_WEIGHTS), CONFIG_VALUE(NO)}});
+    auto network = ie.ReadNetwork(modelPath);
+    rewriteWeights();
+    EXPECT_EQ(weights, getConstantValues(network));
+}
+
+TEST_F(MmapWeightsTests, canReadMappedWeights) {
+    CNNNetwork network;
+    {
+        Core ie;
+        ie.SetConfig({{CONFIG_KEY(MMAP_WEIGHTS), CONFIG_VALUE(YES)}});
+        network = ie.ReadNetwork(modelPath);
+    }
+    // the mapping is owned by the network weights, not by Core
+    EXPECT_EQ(weights, getConstantValues(network));
+}
+
+TEST_F(MmapWeightsTests, canReadMappedWeightsWithExplicitBinPath) {
+    Core ie;
+    ie.SetConfig({{CONFIG_KEY(MMAP_WEIGHTS), CONFIG_VALUE(YES)}});
+    auto network = ie.ReadNetwork(modelPath, weightsPath);
+    EXPECT_EQ(weights, getConstantValues(network));
+}
+
+TEST_F(MmapWeightsTests, throwsOnWrongValue) {
+    Core ie;
+    EXPECT_THROW(ie.SetConfig({{CONFIG_KEY(MMAP_WEIGHTS), "ON"}}), Exception);
+}
@@ -2,7 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <sstream>
 #include <string>
+#include <ngraph/opsets/opset1.hpp>
 #include "ngraph_reader_tests.hpp"
 
 using namespace InferenceEngine;
@@ -89,3 +91,77 @@ TEST_F(NGraphReaderTests, ReadConstantNetworkWithNegativeDimension) {
 
     EXPECT_THROW(ie.ReadNetwork(model, weights),  std::exception);
 }
+
+namespace {
+// Input -> Add(const_0) -> ... -> Add(const_{count-1}) -> Result, const_i holds the floats {2i, 2i + 1}
+std::string makeAddChainModel(size_t count, size_t lastConstOffset) {
+    const std::string port = "<dim>1</dim><dim>2</dim>";
+    std::ostringstream model;
+    model << R"V0G0N(<net name="Network" version="10"><layers>
+        <layer id="0" name="input" type="Parameter" version="opset1">
+            <data element_type="f32" shape="1,2"/>
+            <output><port id="0" precision="FP32">)V0G0N" << port << R"V0G0N(</port></output>
+        </layer>)V0G0N";
+    for (size_t i = 0; i < count; i++) {
+        const size_t offset = i + 1 == count ? lastConstOffset : i * 8;
+        model << "<layer id=\"" << 2 * i + 1 << "\" name=\"const_" << i << "\" type=\"Const\" version=\"opset1\">"
+              << "<data element_type=\"f32\" offset=\"" << offset << "\" shape=\"1,2\" size=\"8\"/>"
+              << "<output><port id=\"0\" precision=\"FP32\">" << port << "</port></output></layer>"
+              << "<layer id=\"" << 2 * i + 2 << "\" name=\"add_" << i << "\" type=\"Add\" version=\"opset1\">"
+              << "<input><port id=\"0\">" << port << "</port><port id=\"1\">" << port << "</port></input>"
+              << "<output><port id=\"2\" precision=\"FP32\">" << port << "</port></output></layer>";
+    }
+    model << "<layer id=\"" << 2 * count + 1 << "\" name=\"output\" type=\"Result\" version=\"opset1\">"
+          << "<input><port id=\"0\">" << port << "</port></input></layer></layers><edges>";
+    for (size_t i = 0; i < count; i++) {
+        model << "<edge from-layer=\"" << (i == 0 ? 0 : 2 * i) << "\" from-port=\"" << (i == 0 ? 0 : 2)
+              << "\" to-layer=\"" << 2 * i + 2 << "\" to-port=\"0\"/>"
+              << "<edge from-layer=\"" << 2 * i + 1 << "\" from-port=\"0\" to-layer=\"" << 2 * i + 2
+              << "\" to-port=\"1\"/>";
+    }
+    model << "<edge from-layer=\"" << 2 * count << "\" from-port=\"2\" to-layer=\"" << 2 * count + 1
+          << "\" to-port=\"0\"/></edges></net>";
+    return model.str();
+}
+
+Blob::Ptr makeAddChainWeights(size_t count) {
+    Blob::Ptr weights = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {count * 8}, Layout::C));
+    weights->allocate();
+    auto data = weights->buffer().as<float*>();
+    for (size_t i = 0; i < count * 2; i++)
+        data[i] = static_cast<float>(i);
+    return weights;
+}
+} // namespace
+
+TEST_F(NGraphReaderTests, ReadNetworkWithManyConstants) {
+    // the constants and parameters are created in parallel, the operations keep their names and weights
+    const size_t count = 256;
+    Core ie;
+    auto network = ie.ReadNetwork(makeAddChainModel(count, (count - 1) * 8), makeAddChainWeights(count));
+    auto function = network.getFunction();
+    ASSERT_NE(nullptr, function);
+    ASSERT_EQ(1, function->get_parameters().size());
+    ASSERT_EQ("input", function->get_parameters()[0]->get_friendly_name());
+    ASSERT_EQ(1, function->get_results().size());
+    ASSERT_EQ(2 * count + 2, function->get_ops().size());
+
+    auto node = function->get_results()[0]->get_input_node_shared_ptr(0);
+    for (size_t i = count; i-- > 0;) {
+        ASSERT_EQ("add_" + std::to_string(i), node->get_friendly_name());
+        auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(node->get_input_node_shared_ptr(1));
+        ASSERT_NE(nullptr, constant);
+        ASSERT_EQ("const_" + std::to_string(i), constant->get_friendly_name());
+        const std::vector<float> expected{static_cast<float>(2 * i), static_cast<float>(2 * i + 1)};
+        ASSERT_EQ(expected, constant->cast_vector<float>());
+        node = node->get_input_node_shared_ptr(0);
+    }
+    ASSERT_EQ(function->get_parameters()[0], node);
+}
+
+TEST_F(NGraphReaderTests, ReadNetworkWithManyConstantsThrowsOnWrongWeights) {
+    // the error of a constant created in parallel reaches the caller
+    const size_t count = 256;
+    Core ie;
+    EXPECT_THROW(ie.ReadNetwork(makeAddChainModel(count, count * 8), makeAddChainWeights(count)), std::exception);
+}
@@ -0,0 +1,115 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset3.hpp>
+
+#include "ngraph_reader_tests.hpp"
+
+TEST_F(NGraphReaderTests, ReadNetworkWithResultsAndAssign) {
+    std::string model = R"V0G0N(
+<net name="Network" version="10">
+    <layers>
+        <layer name="in1" type="Parameter" id="0" version="opset1">
+            <data element_type="f32" shape="1,2"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="init" type="Const" id="1" version="opset1">
+            <data element_type="f32" offset="0" shape="1,2" size="8"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="read" type="ReadValue" id="2" version="opset3">
+            <data variable_id="variable"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1" precision="FP32">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="add" type="Add" id="3" version="opset1">
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="FP32">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="assign" type="Assign" id="4" version="opset3">
+            <data variable_id="variable"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                </port>
+            </input>
+        </layer>
+        <layer name="output" type="Result" id="5" version="opset1">
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="0" from-port="0" to-layer="3" to-port="0"/>
+        <edge from-layer="2" from-port="1" to-layer="3" to-port="1"/>
+        <edge from-layer="3" from-port="2" to-layer="4" to-port="0"/>
+        <edge from-layer="3" from-port="2" to-layer="5" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+    Core ie;
+    Blob::Ptr weights = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {8}, Layout::C));
+    weights->allocate();
+    CommonTestUtils::fill_data(weights->buffer().as<float *>(), weights->size() / sizeof(float));
+
+    auto network = ie.ReadNetwork(model, weights);
+    auto function = network.getFunction();
+    ASSERT_NE(nullptr, function);
+
+    ASSERT_EQ(1, function->get_parameters().size());
+    ASSERT_EQ(1, function->get_results().size());
+    ASSERT_EQ("add", function->get_results()[0]->get_input_node_ptr(0)->get_friendly_name());
+
+    const auto& sinks = function->get_sinks();
+    ASSERT_EQ(1, sinks.size());
+    auto assign = std::dynamic_pointer_cast<ngraph::opset3::Assign>(sinks[0]);
+    ASSERT_NE(nullptr, assign);
+    ASSERT_EQ("assign", assign->get_friendly_name());
+    ASSERT_EQ("variable", assign->get_variable_id());
+
+    // all layers are reachable from the outputs
+    ASSERT_EQ(6, function->get_ops().size());
+}
@@ -21,6 +21,7 @@
 #include <ngraph/op/relu.hpp>
 #include <ngraph/op/result.hpp>
 #include <ngraph/opsets/opset.hpp>
+#include <ngraph/opsets/opset1.hpp>
 #include <ngraph/graph_util.hpp>
 
 #include <ie_core.hpp>
@@ -174,6 +175,38 @@ TEST_F(NGraphReshapeTests, CNNReshapeSpatialReLU) {
     ASSERT_EQ(ngraph->get_results()[0]->get_shape(), ngraph::Shape({1, 3, 22, 22}));
 }
 
+TEST_F(NGraphReshapeTests, CNNReshapeOnlyAffectedBranchRepeatedly) {
+    std::shared_ptr<ngraph::Function> ngraph;
+    {
+        auto data = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 22, 22});
+        data->set_friendly_name("data");
+        auto other = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 10});
+        other->set_friendly_name("other");
+
+        // the target shape is computed from the input shape, so it has to be recomputed on each reshape
+        auto shapeOf = std::make_shared<ngraph::opset1::ShapeOf>(data);
+        auto axis = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{}, {0});
+        auto indices = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{2}, {0, 1});
+        auto gather = std::make_shared<ngraph::opset1::Gather>(shapeOf, indices, axis);
+        auto minusOne = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{1}, {-1});
+        auto pattern = std::make_shared<ngraph::opset1::Concat>(ngraph::OutputVector{gather, minusOne}, 0);
+        auto reshape = std::make_shared<ngraph::opset1::Reshape>(data, pattern, false);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(other);
+
+        ngraph = std::make_shared<ngraph::Function>(ngraph::NodeVector{reshape, relu}, ngraph::ParameterVector{data, other});
+    }
+
+    CNNNetwork cnnNetwork(ngraph);
+    for (size_t spatial : {25, 22, 25}) {
+        ASSERT_NO_THROW(cnnNetwork.reshape({{"data", {2, 3, spatial, spatial}}}));
+
+        auto changedFunction = cnnNetwork.getFunction();
+        ASSERT_NE(nullptr, changedFunction);
+        ASSERT_EQ(changedFunction->get_results()[0]->get_shape(), ngraph::Shape({2, 3, spatial * spatial}));
+        ASSERT_EQ(changedFunction->get_results()[1]->get_shape(), ngraph::Shape({1, 10}));
+    }
+}
+
 TEST_F(NGraphReshapeTests, CNNReshapeSpatialReLUWithoutCloneFunction) {
     std::shared_ptr<ngraph::Function> ngraph;
     {
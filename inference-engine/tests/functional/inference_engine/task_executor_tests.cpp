@@ -211,3 +211,61 @@ static auto AsyncExecutors = ::testing::Values(
 
 INSTANTIATE_TEST_SUITE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
 
+
+class CPUStreamsExecutorPriorityTests : public ::testing::Test {
+protected:
+    // occupies the single stream until the returned promise is set
+    std::promise<void> blockStream(CPUStreamsExecutor& executor) {
+        std::promise<void> started, release;
+        auto released = release.get_future().share();
+        executor.run([&started, released] {
+            started.set_value();
+            released.wait();
+        });
+        started.get_future().wait();
+        return release;
+    }
+};
+
+TEST_F(CPUStreamsExecutorPriorityTests, tasksWithHigherPriorityAreStartedFirst) {
+    CPUStreamsExecutor executor{IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1, 1}};
+    std::vector<int> order;
+    std::promise<void> done;
+
+    auto release = blockStream(executor);
+    executor.run([&] { order.push_back(0); }, 0);
+    executor.run([&] { order.push_back(1); }, 0);
+    executor.run([&] { order.push_back(2); }, 2);
+    executor.run([&] { order.push_back(3); }, 1);
+    executor.run([&] { done.set_value(); }, -1);
+    release.set_value();
+    done.get_future().wait();
+
+    ASSERT_EQ(std::vector<int>({2, 3, 0, 1}), order);
+}
+
+TEST_F(CPUStreamsExecutorPriorityTests, preemptionPointRunsHigherPriorityTasksOfOtherOwners) {
+    CPUStreamsExecutor executor{IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1, 1}};
+    int lowOwner = 0, highOwner = 0;
+    std::vector<int> order;
+    std::promise<void> started, queued, done;
+    auto isQueued = queued.get_future().share();
+
+    executor.run([&] {
+        started.set_value();
+        isQueued.wait();
+        order.push_back(0);
+        executor.RunPreemptingTasks();
+        order.push_back(1);
+    }, 0, &lowOwner);
+    started.get_future().wait();
+    executor.run([&] { order.push_back(2); }, 1, &lowOwner);
+    executor.run([&] { order.push_back(3); }, 1, &highOwner);
+    executor.run([&] { order.push_back(4); }, 1);
+    executor.run([&] { done.set_value(); }, -1);
+    queued.set_value();
+    done.get_future().wait();
+
+    // the tasks of the same owner and the tasks without owner are not executed in place of the preempted task
+    ASSERT_EQ(std::vector<int>({0, 3, 1, 2, 4}), order);
+}
@@ -298,6 +298,43 @@ TEST(TransformationTests, PropagateMaskPassThrough) {
     compare_masks(*getMask(max_pool->output(0)),     Mask({{}, {1, 2, 3}, {}, {}}));
 }
 
+TEST(TransformationTests, PropagateMaskStopsOnNonZeroPreservingOps) {
+    // f(0) != 0 for these operations, so the pruned channels become non-zero after them
+    const std::vector<std::function<std::shared_ptr<Node>(const Output<Node>&)>> make_ops = {
+        [](const Output<Node>& input) { return std::make_shared<opset5::Sigmoid>(input); },
+        [](const Output<Node>& input) { return std::make_shared<opset5::Exp>(input); },
+        [](const Output<Node>& input) { return std::make_shared<opset5::Cos>(input); },
+        [](const Output<Node>& input) { return std::make_shared<opset5::Clamp>(input, 1, 6); },
+        [](const Output<Node>& input) {
+            auto pads_begin = opset5::Constant::create(element::i32, Shape{4}, {0, 0, 1, 1});
+            auto pads_end = opset5::Constant::create(element::i32, Shape{4}, {0, 0, 1, 1});
+            auto pad_value = opset5::Constant::create(element::f32, Shape{}, {1});
+            return std::make_shared<opset5::Pad>(input, pads_begin, pads_end, pad_value, op::PadMode::CONSTANT);
+        },
+    };
+
+    for (const auto& make_op : make_ops) {
+        auto input = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 3, 64, 64});
+        auto weights_const_1 = create_constant_with_zeros({8, 3, 3, 3}, {{1, 2, 3}, {}, {}, {}});
+        auto conv_1 = std::make_shared<opset5::Convolution>(input, weights_const_1, Strides(2, 1),
+                                                            CoordinateDiff(2, 0), CoordinateDiff(2, 0), Strides(2, 1));
+        auto op = make_op(conv_1);
+        auto weights2 = opset5::Constant::create(element::f32, Shape{3, 8, 3, 3}, {0});
+        auto conv2 = std::make_shared<opset5::Convolution>(op, weights2, Strides(2, 1),
+                                                           CoordinateDiff(2, 0), CoordinateDiff(2, 0), Strides(2, 1));
+        auto f = std::make_shared<Function>(NodeVector{conv2}, ParameterVector{input});
+
+        pass::Manager m;
+        m.register_pass<pass::InitMasks>();
+        m.register_pass<pass::PropagateMasks>();
+        m.run_passes(f);
+
+        compare_masks(*getMask(weights_const_1.get_node_shared_ptr()->output(0)), Mask({{}, {}, {}, {}}));
+        compare_masks(*getMask(conv_1->output(0)), Mask({{}, {}, {}, {}}));
+        EXPECT_EQ(nullptr, getMask(op->output(0))) << op->get_type_name();
+    }
+}
+
 TEST(TransformationTests, PropagateMasksHardDependencies) {
     Shape input_shape{1, 3, 3, 3};
 
@@ -699,3 +736,124 @@ TEST(TransformationTests, TestConcatMaskPropagationUpEmpty) {
 
     compare_masks(*getMask(concat->output(0)),  Mask({{}, {}, {}, {}}));
 }
+
+TEST(TransformationTests, PropagateMasksMatMul) {
+    Shape input_shape{2, 8};
+    auto input = std::make_shared<opset5::Parameter>(element::f32, input_shape);
+    auto weights_1 = create_constant_with_zeros(Shape{8, 6}, {{}, {1, 2}});
+    auto matmul_1 = std::make_shared<opset5::MatMul>(input, weights_1);
+
+    auto bias = create_constant_with_zeros(Shape{6}, {{1, 2, 3}});
+    auto add = std::make_shared<opset5::Add>(matmul_1, bias);
+    auto relu = std::make_shared<opset5::Relu>(add);
+
+    auto weights_2 = create_constant_with_zeros(Shape{4, 6}, {{}, {}});
+    auto matmul_2 = std::make_shared<opset5::MatMul>(relu, weights_2, false, true);
+
+    auto f = std::make_shared<Function>(NodeVector{matmul_2}, ParameterVector{input});
+
+    pass::Manager m;
+    m.register_pass<pass::InitMasks>();
+    m.register_pass<pass::PropagateMasks>();
+    m.run_passes(f);
+
+    compare_masks(*getMask(weights_1.get_node_shared_ptr()->output(0)), Mask({{}, {1, 2}}));
+    compare_masks(*getMask(matmul_1->output(0)), Mask({{}, {1, 2}}));
+    compare_masks(*getMask(bias.get_node_shared_ptr()->output(0)), Mask({{1, 2}}));
+    compare_masks(*getMask(add->output(0)), Mask({{}, {1, 2}}));
+    compare_masks(*getMask(relu->output(0)), Mask({{}, {1, 2}}));
+    compare_masks(*getMask(weights_2.get_node_shared_ptr()->output(0)), Mask({{}, {1, 2}}));
+    compare_masks(*getMask(matmul_2->output(0)), Mask({{}, {}}));
+}
+
+TEST(TransformationTests, PruningMatMul) {
+    Shape input_shape{2, 8};
+    auto input = std::make_shared<opset5::Parameter>(element::f32, input_shape);
+    auto weights_1 = create_constant_with_zeros(Shape{8, 6}, {{}, {1, 2}});
+    auto matmul_1 = std::make_shared<opset5::MatMul>(input, weights_1);
+
+    auto bias = create_constant_with_zeros(Shape{6}, {{1, 2, 3}});
+    auto add = std::make_shared<opset5::Add>(matmul_1, bias);
+    auto relu = std::make_shared<opset5::Relu>(add);
+
+    auto weights_2 = create_constant_with_zeros(Shape{4, 6}, {{}, {}});
+    auto matmul_2 = std::make_shared<opset5::MatMul>(relu, weights_2, false, true);
+
+    auto f = std::make_shared<Function>(NodeVector{matmul_2}, ParameterVector{input});
+
+    pass::Manager m;
+    m.register_pass<pass::Pruning>();
+    m.run_passes(f);
+
+    ASSERT_EQ(matmul_1->input_value(1).get_shape(), Shape({8, 4}));
+    ASSERT_EQ(add->input_value(1).get_shape(), Shape({4}));
+    ASSERT_EQ(relu->get_output_shape(0), Shape({2, 4}));
+    ASSERT_EQ(matmul_2->input_value(1).get_shape(), Shape({4, 4}));
+    ASSERT_EQ(matmul_2->get_output_shape(0), Shape({2, 4}));
+}
+
+TEST(TransformationTests, PropagateMasksSplit) {
+    Shape input_shape{1, 3, 64, 64};
+    Shape weights_shape{6, 3, 3, 3};
+    Shape weights_shape2{3, 6, 3, 3};
+    auto input = std::make_shared<opset5::Parameter>(element::f32, input_shape);
+    auto weights = create_constant_with_zeros(weights_shape, {{1, 2}, {}, {}, {}});
+    auto conv = std::make_shared<opset5::Convolution>(input, weights, Strides(2, 1),
+                                                      CoordinateDiff(2, 0), CoordinateDiff(2, 0), Strides(2, 1));
+
+    // split by the spatial dim keeps the channels pruned
+    auto split = std::make_shared<opset5::Split>(conv, opset5::Constant::create(element::i64, Shape{}, {2}), 2);
+
+    auto weights_2 = create_constant_with_zeros(weights_shape2, {{}, {}, {}, {}});
+    auto conv_2 = std::make_shared<opset5::Convolution>(split->output(0), weights_2, Strides(2, 1),
+                                                        CoordinateDiff(2, 0), CoordinateDiff(2, 0), Strides(2, 1));
+    auto weights_3 = create_constant_with_zeros(weights_shape2, {{}, {}, {}, {}});
+    auto conv_3 = std::make_shared<opset5::Convolution>(split->output(1), weights_3, Strides(2, 1),
+                                                        CoordinateDiff(2, 0), CoordinateDiff(2, 0), Strides(2, 1));
+
+    auto f = std::make_shared<Function>(NodeVector{conv_2, conv_3}, ParameterVector{input});
+
+    pass::Manager m;
+    m.register_pass<pass::InitMasks>();
+    m.register_pass<pass::PropagateMasks>();
+    m.run_passes(f);
+
+    compare_masks(*getMask(weights.get_node_shared_ptr()->output(0)), Mask({{1, 2}, {}, {}, {}}));
+    compare_masks(*getMask(conv->output(0)), Mask({{}, {1, 2}, {}, {}}));
+    compare_masks(*getMask(split->output(0)), Mask({{}, {1, 2}, {}, {}}));
+    compare_masks(*getMask(split->output(1)), Mask({{}, {1, 2}, {}, {}}));
+    compare_masks(*getMask(weights_2.get_node_shared_ptr()->output(0)), Mask({{}, {1, 2}, {}, {}}));
+    compare_masks(*getMask(weights_3.get_node_shared_ptr()->output(0)), Mask({{}, {1, 2}, {}, {}}));
+}
+
+TEST(TransformationTests, PropagateMasksSplitByChannels) {
+    Shape input_shape{1, 3, 64, 64};
+    Shape weights_shape{6, 3, 3, 3};
+    Shape weights_shape2{3, 3, 3, 3};
+    auto input = std::make_shared<opset5::Parameter>(element::f32, input_shape);
+    auto weights = create_constant_with_zeros(weights_shape, {{1, 2}, {}, {}, {}});
+    auto conv = std::make_shared<opset5::Convolution>(input, weights, Strides(2, 1),
+                                                      CoordinateDiff(2, 0), CoordinateDiff(2, 0), Strides(2, 1));
+
+    // pruning the split dim would change the split lengths
+    auto split = std::make_shared<opset5::Split>(conv, opset5::Constant::create(element::i64, Shape{}, {1}), 2);
+
+    auto weights_2 = create_constant_with_zeros(weights_shape2, {{}, {}, {}, {}});
+    auto conv_2 = std::make_shared<opset5::Convolution>(split->output(0), weights_2, Strides(2, 1),
+                                                        CoordinateDiff(2, 0), CoordinateDiff(2, 0), Strides(2, 1));
+    auto weights_3 = create_constant_with_zeros(weights_shape2, {{}, {}, {}, {}});
+    auto conv_3 = std::make_shared<opset5::Convolution>(split->output(1), weights_3, Strides(2, 1),
+                                                        CoordinateDiff(2, 0), CoordinateDiff(2, 0), Strides(2, 1));
+
+    auto f = std::make_shared<Function>(NodeVector{conv_2, conv_3}, ParameterVector{input});
+
+    pass::Manager m;
+    m.register_pass<pass::InitMasks>();
+    m.register_pass<pass::PropagateMasks>();
+    m.run_passes(f);
+
+    compare_masks(*getMask(weights.get_node_shared_ptr()->output(0)), Mask({{}, {}, {}, {}}));
+    compare_masks(*getMask(conv->output(0)), Mask({{}, {}, {}, {}}));
+    compare_masks(*getMask(split->output(0)), Mask({{}, {}, {}, {}}));
+    compare_masks(*getMask(split->output(1)), Mask({{}, {}, {}, {}}));
+}
@@ -3,6 +3,7 @@
 //
 
 #include "ie_plugin_config.hpp"
+#include "cpu/cpu_config.hpp"
 #include "behavior/config.hpp"
 
 using namespace BehaviorTestsDefinitions;
@@ -23,7 +24,14 @@ namespace {
             {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "8"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::NO}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::YES}},
-            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}}
+            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_MODEL_PRIORITY, "2"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_MODEL_PRIORITY, "-1"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_LATENCY_HISTOGRAMS, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_HUGE_PAGES, InferenceEngine::CPUConfigParams::CPU_TRANSPARENT}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_HUGE_PAGES, InferenceEngine::CPUConfigParams::CPU_EXPLICIT}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_PRUNING, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE, "0.5"}}
     };
 
     const std::vector<std::map<std::string, std::string>> MultiConfigs = {
@@ -59,7 +67,13 @@ namespace {
     const std::vector<std::map<std::string, std::string>> inconfigs = {
             {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "OFF"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, "OFF"}},
-            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}}
+            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_MODEL_PRIORITY, "HIGH"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_LATENCY_HISTOGRAMS, "ON"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_HUGE_PAGES, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_PRUNING, "ON"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE, "1.5"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE, "NAN"}}
     };
 
     const std::vector<std::map<std::string, std::string>> multiinconfigs = {
@@ -101,7 +101,31 @@ const auto testCase4D = ::testing::Combine(
 );
 
 
+/* Single signal (2D input) */
+
+const auto testCaseSingleSignal = ::testing::Combine(
+    ::testing::Values(std::vector<size_t>{16, 2}, std::vector<size_t>{17, 2}, std::vector<size_t>{97, 2}, std::vector<size_t>{120, 2}),
+    ::testing::ValuesIn(inputPrecision),
+    ::testing::Values(std::vector<int64_t>{0}),
+    ::testing::Values(std::vector<int64_t>{}, std::vector<int64_t>{17}, std::vector<int64_t>{97}),
+    ::testing::ValuesIn(opTypes),
+    ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+/* Prime lengths computed by Bluestein algorithm */
+
+const auto testCaseBluestein = ::testing::Combine(
+    ::testing::Values(std::vector<size_t>{2, 17, 97, 2}),
+    ::testing::ValuesIn(inputPrecision),
+    ::testing::Values(std::vector<int64_t>{1}, std::vector<int64_t>{2}, std::vector<int64_t>{1, 2}),
+    ::testing::Values(std::vector<int64_t>{}),
+    ::testing::ValuesIn(opTypes),
+    ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
 INSTANTIATE_TEST_SUITE_P(smoke_MKLDNN_TestsDFT_1d, DFTLayerTest, testCase1D, DFTLayerTest::getTestCaseName);
 INSTANTIATE_TEST_SUITE_P(smoke_MKLDNN_TestsDFT_2d, DFTLayerTest, testCase2D, DFTLayerTest::getTestCaseName);
 INSTANTIATE_TEST_SUITE_P(smoke_MKLDNN_TestsDFT_3d, DFTLayerTest, testCase3D, DFTLayerTest::getTestCaseName);
 INSTANTIATE_TEST_SUITE_P(smoke_MKLDNN_TestsDFT_4d, DFTLayerTest, testCase4D, DFTLayerTest::getTestCaseName);
+INSTANTIATE_TEST_SUITE_P(smoke_MKLDNN_TestsDFT_SingleSignal, DFTLayerTest, testCaseSingleSignal, DFTLayerTest::getTestCaseName);
+INSTANTIATE_TEST_SUITE_P(smoke_MKLDNN_TestsDFT_Bluestein, DFTLayerTest, testCaseBluestein, DFTLayerTest::getTestCaseName);
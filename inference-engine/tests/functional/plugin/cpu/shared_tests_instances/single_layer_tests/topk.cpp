@@ -51,4 +51,24 @@ INSTANTIATE_TEST_SUITE_P(smoke_TopK, TopKLayerTest,
                 ::testing::Values(std::vector<size_t>({10, 10, 10})),
                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
         TopKLayerTest::getTestCaseName);
+
+const std::vector<std::vector<size_t>> largeAxisShapes = {
+        {1, 50000},
+        {4, 3000},
+        {2, 5000, 3},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_TopK_LargeAxis, TopKLayerTest,
+        ::testing::Combine(
+                ::testing::Values(1, 10, 300),
+                ::testing::Values(1),
+                ::testing::ValuesIn(modes),
+                ::testing::ValuesIn(sortTypes),
+                ::testing::Values(InferenceEngine::Precision::FP32),
+                ::testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                ::testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                ::testing::Values(InferenceEngine::Layout::ANY),
+                ::testing::ValuesIn(largeAxisShapes),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+        TopKLayerTest::getTestCaseName);
 }  // namespace
@@ -93,7 +93,7 @@ protected:
         auto roialign = std::make_shared<ngraph::opset3::ROIAlign>(params[0], coords, roisIdx, pooledH, pooledW,
                                                                    samplingRatio, spatialScale, mode);
         roialign->get_rt_info() = getCPUInfo();
-        selectedType = std::string("unknown_") + inPrc.name();
+        selectedType = getPrimitiveType() + "_" + inPrc.name();
 
         threshold = 1e-2;
         const ngraph::ResultVector results{std::make_shared<ngraph::opset3::Result>(roialign)};
@@ -144,7 +144,8 @@ const std::vector<std::vector<size_t>> inputShapeVector = {
         SizeVector({ 2, 18, 20, 20 }),
         SizeVector({ 2, 4, 20, 20 }),
         SizeVector({ 2, 4, 20, 40 }),
-        SizeVector({ 10, 1, 20, 20 })
+        SizeVector({ 10, 1, 20, 20 }),
+        SizeVector({ 2, 35, 20, 20 })
 };
 
 
@@ -0,0 +1,121 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/single_layer/tile.hpp>
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace CPULayerTestsDefinitions  {
+
+typedef std::tuple<
+        LayerTestsDefinitions::TileLayerTestParamsSet,
+        CPUSpecificParams> TileLayerCPUTestParamSet;
+
+class TileLayerCPUTest : public testing::WithParamInterface<TileLayerCPUTestParamSet>,
+                         virtual public LayerTestsUtils::LayerTestsCommon, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<TileLayerCPUTestParamSet> &obj) {
+        LayerTestsDefinitions::TileLayerTestParamsSet basicParamsSet;
+        CPUSpecificParams cpuParams;
+        std::tie(basicParamsSet, cpuParams) = obj.param;
+        std::ostringstream result;
+        result << LayerTestsDefinitions::TileLayerTest::getTestCaseName(
+                testing::TestParamInfo<LayerTestsDefinitions::TileLayerTestParamsSet>(basicParamsSet, 0));
+        result << CPUTestsBase::getTestCaseName(cpuParams);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        LayerTestsDefinitions::TileLayerTestParamsSet basicParamsSet;
+        CPUSpecificParams cpuParams;
+        std::tie(basicParamsSet, cpuParams) = this->GetParam();
+        std::tie(inFmts, outFmts, priority, selectedType) = cpuParams;
+
+        LayerTestsDefinitions::TileSpecificParams tileParams;
+        std::vector<size_t> inputShape;
+        InferenceEngine::Precision netPrecision;
+        std::tie(tileParams, netPrecision, inPrc, outPrc, inLayout, outLayout, inputShape, targetDevice) = basicParamsSet;
+        inPrc = outPrc = netPrecision;
+        selectedType = std::string("ref_any_") + netPrecision.name();
+
+        auto ngPrc = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(netPrecision);
+        auto params = ngraph::builder::makeParams(ngPrc, {inputShape});
+        auto paramOuts = ngraph::helpers::convert2OutputVector(
+                ngraph::helpers::castOps2Nodes<ngraph::op::Parameter>(params));
+        auto tile = ngraph::builder::makeTile(paramOuts[0], tileParams);
+        tile->get_rt_info() = getCPUInfo();
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(tile)};
+        function = std::make_shared<ngraph::Function>(results, params, "Tile");
+    }
+};
+
+TEST_P(TileLayerCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckPluginRelatedResults(executableNetwork, "Tile");
+};
+
+namespace {
+
+const std::vector<Precision> precisions = {
+        Precision::I32,
+        Precision::FP32,
+        Precision::BF16
+};
+
+const std::vector<std::vector<int64_t>> repeats4D = {{1, 1, 3, 1}, {1, 1, 1, 2}, {2, 1, 1, 1}};
+const std::vector<std::vector<size_t>> inputShapes4D = {{2, 16, 5, 7}, {1, 32, 3, 64}};
+
+const std::vector<CPUSpecificParams> cpuParams_4D = {
+        CPUSpecificParams({nChw16c}, {nChw16c}, {}, {}),
+        CPUSpecificParams({nChw8c}, {nChw8c}, {}, {}),
+        CPUSpecificParams({nhwc}, {nhwc}, {}, {}),
+        CPUSpecificParams({nchw}, {nchw}, {}, {})
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_TileCPULayerTest_4D, TileLayerCPUTest,
+        ::testing::Combine(
+                ::testing::Combine(
+                        ::testing::ValuesIn(repeats4D),
+                        ::testing::ValuesIn(precisions),
+                        ::testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                        ::testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                        ::testing::Values(InferenceEngine::Layout::ANY),
+                        ::testing::Values(InferenceEngine::Layout::ANY),
+                        ::testing::ValuesIn(inputShapes4D),
+                        ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                ::testing::ValuesIn(cpuParams_4D)),
+        TileLayerCPUTest::getTestCaseName);
+
+const std::vector<std::vector<int64_t>> repeats5D = {{1, 1, 2, 1, 1}, {1, 1, 1, 1, 4}};
+const std::vector<std::vector<size_t>> inputShapes5D = {{2, 16, 3, 4, 5}};
+
+const std::vector<CPUSpecificParams> cpuParams_5D = {
+        CPUSpecificParams({nCdhw16c}, {nCdhw16c}, {}, {}),
+        CPUSpecificParams({nCdhw8c}, {nCdhw8c}, {}, {}),
+        CPUSpecificParams({ndhwc}, {ndhwc}, {}, {}),
+        CPUSpecificParams({ncdhw}, {ncdhw}, {}, {})
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_TileCPULayerTest_5D, TileLayerCPUTest,
+        ::testing::Combine(
+                ::testing::Combine(
+                        ::testing::ValuesIn(repeats5D),
+                        ::testing::ValuesIn(precisions),
+                        ::testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                        ::testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                        ::testing::Values(InferenceEngine::Layout::ANY),
+                        ::testing::Values(InferenceEngine::Layout::ANY),
+                        ::testing::ValuesIn(inputShapes5D),
+                        ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                ::testing::ValuesIn(cpuParams_5D)),
+        TileLayerCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace CPULayerTestsDefinitions
@@ -0,0 +1,145 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <functional>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+CNNNetwork makeTransposeNetwork(const std::vector<int64_t> &order) {
+    const auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{4, 3, 2});
+    const auto orderConst = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{order.size()}, order);
+    const auto transpose = std::make_shared<ngraph::opset1::Transpose>(param, orderConst);
+    const auto relu = std::make_shared<ngraph::opset1::Relu>(transpose);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::NodeVector{relu}, ngraph::ParameterVector{param}));
+}
+
+const std::map<std::string, std::string> dynBatchConfig = {
+    {PluginConfigParams::KEY_DYN_BATCH_ENABLED, PluginConfigParams::YES}
+};
+
+const size_t maxBatch = 4;
+
+CNNNetwork makeNetwork(const ngraph::Shape& shape,
+                       const std::function<std::shared_ptr<ngraph::Node>(const ngraph::Output<ngraph::Node>&)>& makeOp) {
+    const auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, shape);
+    const auto op = makeOp(param);
+    return CNNNetwork(std::make_shared<ngraph::Function>(op->outputs(), ngraph::ParameterVector{param}));
+}
+
+// Compares the first batches of the outputs, the batches are processed independently by the tested networks
+void compareBatches(const Blob::CPtr& expected, const Blob::CPtr& actual, size_t batch) {
+    ASSERT_EQ(expected->getTensorDesc(), actual->getTensorDesc());
+    const size_t size = expected->size() / maxBatch * batch;
+    if (expected->getTensorDesc().getPrecision() == Precision::FP32) {
+        const auto expectedData = expected->cbuffer().as<const float*>();
+        const auto actualData = actual->cbuffer().as<const float*>();
+        for (size_t i = 0; i < size; i++)
+            ASSERT_NEAR(expectedData[i], actualData[i], 1e-4f * std::max(1.f, std::fabs(expectedData[i])))
+                << "batch " << batch << ", element " << i;
+    } else {
+        ASSERT_EQ(0, std::memcmp(expected->cbuffer().as<const uint8_t*>(), actual->cbuffer().as<const uint8_t*>(),
+                                 size * expected->getTensorDesc().getPrecision().size())) << "batch " << batch;
+    }
+}
+
+// Infers the network with the changing batch and compares the outputs with the network inferred with the max batch
+void checkDynamicBatch(const CNNNetwork& network, const std::vector<size_t>& batches = {2, 2, 3, 1, maxBatch, 1}) {
+    Core ie;
+    auto referenceNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    auto dynamicNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU, dynBatchConfig);
+    auto reference = referenceNet.CreateInferRequest();
+    auto dynamic = dynamicNet.CreateInferRequest();
+
+    const auto inputName = network.getInputsInfo().begin()->first;
+    auto input = reference.GetBlob(inputName);
+    ASSERT_EQ(maxBatch, input->getTensorDesc().getDims()[0]);
+    auto data = input->buffer().as<float*>();
+    for (size_t i = 0; i < input->size(); i++)
+        data[i] = static_cast<float>(static_cast<int>(i % 23) - 11) * 0.37f;
+    reference.Infer();
+
+    auto dynamicInput = dynamic.GetBlob(inputName);
+    std::memcpy(dynamicInput->buffer().as<float*>(), data, input->byteSize());
+    for (auto batch : batches) {
+        dynamic.SetBatch(static_cast<int>(batch));
+        dynamic.Infer();
+        for (const auto& output : network.getOutputsInfo())
+            compareBatches(reference.GetBlob(output.first), dynamic.GetBlob(output.first), batch);
+    }
+}
+} // namespace
+
+TEST(DynamicBatchTransposeTest, smoke_canLoadTransposeKeepingBatch) {
+    Core ie;
+    ASSERT_NO_THROW(ie.LoadNetwork(makeTransposeNetwork({0, 2, 1}), CommonTestUtils::DEVICE_CPU, dynBatchConfig));
+}
+
+TEST(DynamicBatchTransposeTest, smoke_throwsOnTransposeMovingBatch) {
+    Core ie;
+    EXPECT_THROW(ie.LoadNetwork(makeTransposeNetwork({2, 1, 0}), CommonTestUtils::DEVICE_CPU, dynBatchConfig),
+                 Exception);
+}
+
+TEST(DynamicBatchTransposeTest, smoke_throwsOnTransposeWithEmptyOrder) {
+    Core ie;
+    EXPECT_THROW(ie.LoadNetwork(makeTransposeNetwork({}), CommonTestUtils::DEVICE_CPU, dynBatchConfig), Exception);
+}
+
+TEST(DynamicBatchTest, smoke_transpose) {
+    checkDynamicBatch(makeNetwork({maxBatch, 3, 5, 2}, [](const ngraph::Output<ngraph::Node>& input) {
+        const auto order = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{4}, {0, 2, 3, 1});
+        return std::make_shared<ngraph::opset1::Transpose>(input, order);
+    }));
+}
+
+TEST(DynamicBatchTest, smoke_shuffleChannels) {
+    checkDynamicBatch(makeNetwork({maxBatch, 8, 4, 4}, [](const ngraph::Output<ngraph::Node>& input) {
+        return std::make_shared<ngraph::opset1::ShuffleChannels>(input, 1, 2);
+    }));
+}
+
+TEST(DynamicBatchTest, smoke_depthToSpace) {
+    checkDynamicBatch(makeNetwork({maxBatch, 8, 4, 4}, [](const ngraph::Output<ngraph::Node>& input) {
+        return std::make_shared<ngraph::opset1::DepthToSpace>(input, ngraph::opset1::DepthToSpace::DepthToSpaceMode::BLOCKS_FIRST, 2);
+    }));
+}
+
+TEST(DynamicBatchTest, smoke_spaceToDepth) {
+    checkDynamicBatch(makeNetwork({maxBatch, 2, 8, 8}, [](const ngraph::Output<ngraph::Node>& input) {
+        return std::make_shared<ngraph::opset1::SpaceToDepth>(input, ngraph::opset1::SpaceToDepth::SpaceToDepthMode::DEPTH_FIRST, 2);
+    }));
+}
+
+TEST(DynamicBatchTest, smoke_convert) {
+    checkDynamicBatch(makeNetwork({maxBatch, 3, 7}, [](const ngraph::Output<ngraph::Node>& input) {
+        return std::make_shared<ngraph::opset1::Convert>(input, ngraph::element::i32);
+    }));
+}
+
+TEST(DynamicBatchTest, smoke_reorders) {
+    // the convolution works in the blocked layout, so the planar input and output are reordered, and the reorder
+    // primitives are created for every batch once and reused on the next changes of the batch
+    checkDynamicBatch(makeNetwork({maxBatch, 16, 8, 8}, [](const ngraph::Output<ngraph::Node>& input) {
+        std::vector<float> weightsData(16 * 16 * 3 * 3);
+        for (size_t i = 0; i < weightsData.size(); i++)
+            weightsData[i] = static_cast<float>(static_cast<int>(i % 7) - 3) * 0.01f;
+        const auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{16, 16, 3, 3}, weightsData);
+        const auto conv = std::make_shared<ngraph::opset1::Convolution>(input, weights, ngraph::Strides{1, 1},
+                                                                        ngraph::CoordinateDiff{1, 1}, ngraph::CoordinateDiff{1, 1},
+                                                                        ngraph::Strides{1, 1});
+        return std::make_shared<ngraph::opset1::Relu>(conv);
+    }), {1, 3, 1, 3, maxBatch, 2, maxBatch});
+}
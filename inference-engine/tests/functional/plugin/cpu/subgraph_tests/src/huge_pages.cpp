@@ -0,0 +1,84 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <cpu/cpu_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+using Statistics = std::map<std::string, uint64_t>;
+
+// the input and output blobs of 4 MB are larger than the huge page
+const ngraph::Shape shape{1, 64, 128, 128};
+
+CNNNetwork makeNetwork() {
+    const auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, shape);
+    const auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{64, 64, 1, 1},
+                                                          std::vector<float>(64 * 64, 0.02f));
+    const auto conv = std::make_shared<ngraph::opset1::Convolution>(param, weights, ngraph::Strides{1, 1},
+                                                                    ngraph::CoordinateDiff{0, 0}, ngraph::CoordinateDiff{0, 0},
+                                                                    ngraph::Strides{1, 1});
+    const auto relu = std::make_shared<ngraph::opset1::Relu>(conv);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::NodeVector{relu}, ngraph::ParameterVector{param}));
+}
+
+Blob::Ptr infer(ExecutableNetwork& execNet, const std::string& inputName, const std::string& outputName) {
+    auto request = execNet.CreateInferRequest();
+    auto input = request.GetBlob(inputName);
+    auto data = input->buffer().as<float*>();
+    for (size_t i = 0; i < input->size(); i++)
+        data[i] = static_cast<float>(static_cast<int>(i % 17) - 8) * 0.5f;
+    request.Infer();
+    return request.GetBlob(outputName);
+}
+} // namespace
+
+TEST(HugePagesTest, smoke_statisticsAreEmptyByDefault) {
+    Core ie;
+    auto execNet = ie.LoadNetwork(makeNetwork(), CommonTestUtils::DEVICE_CPU);
+    execNet.CreateInferRequest().Infer();
+    EXPECT_TRUE(execNet.GetMetric(CPU_METRIC_KEY(HUGE_PAGES_STATISTICS)).as<Statistics>().empty());
+}
+
+TEST(HugePagesTest, smoke_inferWithTransparentHugePages) {
+    Core ie;
+    const auto network = makeNetwork();
+    const std::string inputName = network.getInputsInfo().begin()->first;
+    const std::string outputName = network.getOutputsInfo().begin()->first;
+    auto referenceNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                  {{CPUConfigParams::KEY_CPU_HUGE_PAGES, CPUConfigParams::CPU_TRANSPARENT}});
+
+    const auto expected = infer(referenceNet, inputName, outputName);
+    const auto actual = infer(execNet, inputName, outputName);
+    ASSERT_EQ(expected->byteSize(), actual->byteSize());
+    EXPECT_EQ(0, std::memcmp(expected->cbuffer().as<const float*>(), actual->cbuffer().as<const float*>(),
+                             expected->byteSize()));
+
+    auto statistics = execNet.GetMetric(CPU_METRIC_KEY(HUGE_PAGES_STATISTICS)).as<Statistics>();
+    for (auto key : {"huge_page_size", "allocations", "allocated_bytes", "mapped_bytes", "explicit_huge_page_bytes",
+                     "transparent_huge_page_bytes", "small_page_bytes", "tlb_entries", "explicit_fallbacks"})
+        ASSERT_EQ(1, statistics.count(key)) << key;
+
+    // at least the input and output blobs of the request are allocated
+    EXPECT_LE(2, statistics["allocations"]);
+    EXPECT_LE(2 * actual->byteSize(), statistics["allocated_bytes"]);
+    EXPECT_EQ(0, statistics["explicit_huge_page_bytes"]);
+    EXPECT_EQ(0, statistics["explicit_fallbacks"]);
+    EXPECT_LE(statistics["transparent_huge_page_bytes"], statistics["mapped_bytes"]);
+    const auto hugePageSize = statistics["huge_page_size"];
+    if (hugePageSize != 0 && actual->byteSize() >= hugePageSize) {
+        EXPECT_LE(2 * actual->byteSize(), statistics["mapped_bytes"]);
+        EXPECT_EQ(0, statistics["mapped_bytes"] % hugePageSize);
+    }
+}
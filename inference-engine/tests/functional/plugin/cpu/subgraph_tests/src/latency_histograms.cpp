@@ -0,0 +1,72 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <cpu/cpu_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+using Percentiles = std::map<std::string, std::vector<double>>;
+
+CNNNetwork makeNetwork() {
+    const auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 16, 32, 32});
+    param->set_friendly_name("input");
+    const auto relu = std::make_shared<ngraph::opset1::Relu>(param);
+    relu->set_friendly_name("relu");
+    const auto pooling = std::make_shared<ngraph::opset1::MaxPool>(relu, ngraph::Strides{2, 2}, ngraph::Shape{0, 0},
+                                                                   ngraph::Shape{0, 0}, ngraph::Shape{2, 2});
+    pooling->set_friendly_name("pooling");
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::NodeVector{pooling}, ngraph::ParameterVector{param}));
+}
+
+Percentiles inferAndGetPercentiles(const std::map<std::string, std::string>& config, size_t inferences) {
+    Core ie;
+    auto execNet = ie.LoadNetwork(makeNetwork(), CommonTestUtils::DEVICE_CPU, config);
+    auto request = execNet.CreateInferRequest();
+    for (size_t i = 0; i < inferences; i++)
+        request.Infer();
+    return execNet.GetMetric(CPU_METRIC_KEY(LATENCY_PERCENTILES)).as<Percentiles>();
+}
+} // namespace
+
+TEST(LatencyHistogramsTest, smoke_percentilesAreEmptyByDefault) {
+    EXPECT_TRUE(inferAndGetPercentiles({}, 3).empty());
+}
+
+TEST(LatencyHistogramsTest, smoke_percentilesAreCollected) {
+    const size_t inferences = 10;
+    const auto percentiles = inferAndGetPercentiles(
+            {{CPUConfigParams::KEY_CPU_LATENCY_HISTOGRAMS, PluginConfigParams::YES}}, inferences);
+
+    // the whole inference is reported under the empty name
+    ASSERT_EQ(1, percentiles.count(""));
+    ASSERT_EQ(1, percentiles.count("pooling"));
+    for (const auto& entry : percentiles) {
+        const auto& stats = entry.second;
+        ASSERT_EQ(5, stats.size()) << entry.first;
+        // {count, p50, p90, p99, max}
+        EXPECT_EQ(static_cast<double>(inferences), stats[0]) << entry.first;
+        EXPECT_LE(stats[1], stats[2]) << entry.first;
+        EXPECT_LE(stats[2], stats[3]) << entry.first;
+        EXPECT_LE(stats[3], stats[4]) << entry.first;
+    }
+    EXPECT_GT(percentiles.at("")[4], 0.);
+    EXPECT_LE(percentiles.at("pooling")[4], percentiles.at("")[4]);
+}
+
+TEST(LatencyHistogramsTest, smoke_metricIsSupported) {
+    Core ie;
+    auto execNet = ie.LoadNetwork(makeNetwork(), CommonTestUtils::DEVICE_CPU);
+    const auto metrics = execNet.GetMetric(METRIC_KEY(SUPPORTED_METRICS)).as<std::vector<std::string>>();
+    EXPECT_NE(metrics.end(), std::find(metrics.begin(), metrics.end(), CPU_METRIC_KEY(LATENCY_PERCENTILES)));
+}
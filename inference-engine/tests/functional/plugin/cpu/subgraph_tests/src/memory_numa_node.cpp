@@ -0,0 +1,71 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cctype>
+#include <string>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/variant.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+#include "ie_system_conf.h"
+
+using namespace InferenceEngine;
+
+namespace {
+const char memoryNumaNode[] = "memoryNumaNode";
+
+CNNNetwork makeNetwork() {
+    const auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 16, 32, 32});
+    std::shared_ptr<ngraph::Node> output = param;
+    for (int i = 0; i < 4; i++) {
+        const auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{16, 16, 3, 3},
+                                                              std::vector<float>(16 * 16 * 9, 0.01f));
+        output = std::make_shared<ngraph::opset1::Convolution>(output, weights, ngraph::Strides{1, 1},
+                                                               ngraph::CoordinateDiff{1, 1}, ngraph::CoordinateDiff{1, 1},
+                                                               ngraph::Strides{1, 1});
+        output = std::make_shared<ngraph::opset1::Relu>(output);
+    }
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::NodeVector{output}, ngraph::ParameterVector{param}));
+}
+} // namespace
+
+TEST(MemoryNumaNodeTest, smoke_execGraphReportsValidNumaNodes) {
+    Core ie;
+    auto execNet = ie.LoadNetwork(makeNetwork(), CommonTestUtils::DEVICE_CPU,
+                                  {{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, PluginConfigParams::CPU_THROUGHPUT_NUMA},
+                                   {PluginConfigParams::KEY_CPU_BIND_THREAD, PluginConfigParams::NUMA}});
+    execNet.CreateInferRequest().Infer();
+
+    const auto numaNodes = getAvailableNUMANodes();
+    const auto execGraph = execNet.GetExecGraphInfo().getFunction();
+    ASSERT_NE(nullptr, execGraph);
+    size_t reported = 0;
+    for (const auto& node : execGraph->get_ops()) {
+        const auto& rtInfo = node->get_rt_info();
+        const auto it = rtInfo.find(memoryNumaNode);
+        if (it == rtInfo.end())
+            continue;
+        reported++;
+        const auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+        ASSERT_NE(nullptr, value) << node->get_friendly_name();
+        const auto& text = value->get();
+        ASSERT_FALSE(text.empty()) << node->get_friendly_name();
+        ASSERT_TRUE(std::all_of(text.begin(), text.end(), ::isdigit)) << node->get_friendly_name() << ": " << text;
+        const int numaNode = std::stoi(text);
+        EXPECT_NE(numaNodes.end(), std::find(numaNodes.begin(), numaNodes.end(), numaNode))
+            << node->get_friendly_name() << ": " << text;
+    }
+
+    // the attribute is reported only on the systems with several NUMA nodes
+    if (numaNodes.size() > 1)
+        EXPECT_NE(0, reported);
+    else
+        EXPECT_EQ(0, reported);
+}
@@ -0,0 +1,81 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <cpu/cpu_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+const size_t layers = 8;
+const ngraph::Shape shape{1, 16, 32, 32};
+const size_t tensorBytes = ngraph::shape_size(shape) * sizeof(float);
+
+// the tensors of the chain are alive by pairs, so the workspace is much smaller than the sum of the tensors
+CNNNetwork makeChainNetwork() {
+    const auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, shape);
+    std::shared_ptr<ngraph::Node> output = param;
+    for (size_t i = 0; i < layers; i++) {
+        const auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{16, 16, 3, 3},
+                                                              std::vector<float>(16 * 16 * 9, 0.01f));
+        output = std::make_shared<ngraph::opset1::Convolution>(output, weights, ngraph::Strides{1, 1},
+                                                               ngraph::CoordinateDiff{1, 1}, ngraph::CoordinateDiff{1, 1},
+                                                               ngraph::Strides{1, 1});
+        output = std::make_shared<ngraph::opset1::Relu>(output);
+    }
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::NodeVector{output}, ngraph::ParameterVector{param}));
+}
+
+// the branches are alive together until the concatenation
+CNNNetwork makeBranchesNetwork() {
+    const auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, shape);
+    ngraph::OutputVector branches;
+    for (size_t i = 0; i < 4; i++) {
+        const auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{16, 16, 1, 1},
+                                                              std::vector<float>(16 * 16, 0.1f * (i + 1)));
+        const auto conv = std::make_shared<ngraph::opset1::Convolution>(param, weights, ngraph::Strides{1, 1},
+                                                                        ngraph::CoordinateDiff{0, 0}, ngraph::CoordinateDiff{0, 0},
+                                                                        ngraph::Strides{1, 1});
+        branches.push_back(std::make_shared<ngraph::opset1::Relu>(conv));
+    }
+    const auto concat = std::make_shared<ngraph::opset1::Concat>(branches, 1);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::NodeVector{concat}, ngraph::ParameterVector{param}));
+}
+
+void checkWorkspaceMetrics(const CNNNetwork& network, uint64_t& size, uint64_t& lowerBound) {
+    Core ie;
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+
+    const auto metrics = execNet.GetMetric(METRIC_KEY(SUPPORTED_METRICS)).as<std::vector<std::string>>();
+    for (auto metric : {CPU_METRIC_KEY(MEMORY_WORKSPACE_SIZE), CPU_METRIC_KEY(MEMORY_WORKSPACE_LOWER_BOUND)})
+        ASSERT_NE(metrics.end(), std::find(metrics.begin(), metrics.end(), metric)) << metric;
+
+    size = execNet.GetMetric(CPU_METRIC_KEY(MEMORY_WORKSPACE_SIZE)).as<uint64_t>();
+    lowerBound = execNet.GetMetric(CPU_METRIC_KEY(MEMORY_WORKSPACE_LOWER_BOUND)).as<uint64_t>();
+    EXPECT_LT(0, lowerBound);
+    EXPECT_LE(lowerBound, size);
+
+    // the network infers with the planned workspace
+    ASSERT_NO_THROW(execNet.CreateInferRequest().Infer());
+}
+} // namespace
+
+TEST(MemoryWorkspaceTest, smoke_chainReusesMemory) {
+    uint64_t size = 0, lowerBound = 0;
+    checkWorkspaceMetrics(makeChainNetwork(), size, lowerBound);
+    EXPECT_LT(size, layers * tensorBytes);
+}
+
+TEST(MemoryWorkspaceTest, smoke_branchedNetwork) {
+    uint64_t size = 0, lowerBound = 0;
+    checkWorkspaceMetrics(makeBranchesNetwork(), size, lowerBound);
+}
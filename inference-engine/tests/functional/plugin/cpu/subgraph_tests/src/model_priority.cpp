@@ -0,0 +1,118 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <cpu/cpu_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+CNNNetwork makeNetwork() {
+    const auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 16, 64, 64});
+    std::shared_ptr<ngraph::Node> output = param;
+    for (int i = 0; i < 8; i++) {
+        const auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{16, 16, 3, 3},
+                                                              std::vector<float>(16 * 16 * 9, 0.01f));
+        output = std::make_shared<ngraph::opset1::Convolution>(output, weights, ngraph::Strides{1, 1},
+                                                               ngraph::CoordinateDiff{1, 1}, ngraph::CoordinateDiff{1, 1},
+                                                               ngraph::Strides{1, 1});
+        output = std::make_shared<ngraph::opset1::Relu>(output);
+    }
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::NodeVector{output}, ngraph::ParameterVector{param}));
+}
+} // namespace
+
+TEST(ModelPriorityTest, smoke_canLoadWithPriority) {
+    Core ie;
+    auto execNet = ie.LoadNetwork(makeNetwork(), CommonTestUtils::DEVICE_CPU,
+                                  {{CPUConfigParams::KEY_CPU_MODEL_PRIORITY, "3"}});
+    EXPECT_EQ("3", execNet.GetConfig(CPUConfigParams::KEY_CPU_MODEL_PRIORITY).as<std::string>());
+    ASSERT_NO_THROW(execNet.CreateInferRequest().Infer());
+}
+
+TEST(ModelPriorityTest, smoke_canChangePriorityOfLoadedNetwork) {
+    Core ie;
+    auto execNet = ie.LoadNetwork(makeNetwork(), CommonTestUtils::DEVICE_CPU);
+    EXPECT_EQ("0", execNet.GetConfig(CPUConfigParams::KEY_CPU_MODEL_PRIORITY).as<std::string>());
+    ASSERT_NO_THROW(execNet.SetConfig({{CPUConfigParams::KEY_CPU_MODEL_PRIORITY, "5"}}));
+    EXPECT_EQ("5", execNet.GetConfig(CPUConfigParams::KEY_CPU_MODEL_PRIORITY).as<std::string>());
+    ASSERT_NO_THROW(execNet.SetConfig({{CPUConfigParams::KEY_CPU_MODEL_PRIORITY, Parameter(-2)}}));
+    EXPECT_EQ("-2", execNet.GetConfig(CPUConfigParams::KEY_CPU_MODEL_PRIORITY).as<std::string>());
+}
+
+TEST(ModelPriorityTest, smoke_throwsOnWrongPriority) {
+    Core ie;
+    auto execNet = ie.LoadNetwork(makeNetwork(), CommonTestUtils::DEVICE_CPU);
+    EXPECT_THROW(execNet.SetConfig({{CPUConfigParams::KEY_CPU_MODEL_PRIORITY, "HIGH"}}), Exception);
+}
+
+TEST(ModelPriorityTest, smoke_throwsOnChangingOtherKeys) {
+    Core ie;
+    auto execNet = ie.LoadNetwork(makeNetwork(), CommonTestUtils::DEVICE_CPU);
+    EXPECT_THROW(execNet.SetConfig({{PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::YES}}), NotImplemented);
+}
+
+TEST(ModelPriorityTest, smoke_canChangePriorityWhileInferring) {
+    Core ie;
+    auto execNet = ie.LoadNetwork(makeNetwork(), CommonTestUtils::DEVICE_CPU,
+                                  {{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "2"}});
+    std::vector<InferRequest> requests;
+    for (int i = 0; i < 4; i++)
+        requests.push_back(execNet.CreateInferRequest());
+
+    for (int iteration = 0; iteration < 10; iteration++) {
+        for (auto& request : requests)
+            request.StartAsync();
+        // doesn't wait for the running requests
+        ASSERT_NO_THROW(execNet.SetConfig({{CPUConfigParams::KEY_CPU_MODEL_PRIORITY, std::to_string(iteration)}}));
+        EXPECT_EQ(std::to_string(iteration),
+                  execNet.GetConfig(CPUConfigParams::KEY_CPU_MODEL_PRIORITY).as<std::string>());
+        for (auto& request : requests)
+            ASSERT_EQ(StatusCode::OK, request.Wait(InferRequest::WaitMode::RESULT_READY));
+    }
+}
+
+TEST(ModelPriorityTest, smoke_prioritizedNetworksProduceSameResults) {
+    Core ie;
+    const auto network = makeNetwork();
+    const std::string inputName = network.getInputsInfo().begin()->first;
+    const std::string outputName = network.getOutputsInfo().begin()->first;
+    auto lowNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU, {{CPUConfigParams::KEY_CPU_MODEL_PRIORITY, "0"}});
+    auto highNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU, {{CPUConfigParams::KEY_CPU_MODEL_PRIORITY, "10"}});
+
+    std::vector<InferRequest> lowRequests;
+    for (int i = 0; i < 4; i++)
+        lowRequests.push_back(lowNet.CreateInferRequest());
+    auto highRequest = highNet.CreateInferRequest();
+    auto input = highRequest.GetBlob(inputName);
+    float* inputData = input->buffer().as<float*>();
+    for (size_t i = 0; i < input->size(); i++)
+        inputData[i] = static_cast<float>(i % 13) * 0.1f;
+    for (auto& request : lowRequests)
+        request.SetBlob(inputName, input);
+
+    // the high priority request may preempt the low priority ones between the nodes
+    for (auto& request : lowRequests)
+        request.StartAsync();
+    highRequest.StartAsync();
+    ASSERT_EQ(StatusCode::OK, highRequest.Wait(InferRequest::WaitMode::RESULT_READY));
+    for (auto& request : lowRequests)
+        ASSERT_EQ(StatusCode::OK, request.Wait(InferRequest::WaitMode::RESULT_READY));
+
+    const auto expected = highRequest.GetBlob(outputName);
+    for (auto& request : lowRequests) {
+        const auto actual = request.GetBlob(outputName);
+        ASSERT_EQ(expected->size(), actual->size());
+        EXPECT_EQ(0, std::memcmp(expected->cbuffer().as<const float*>(), actual->cbuffer().as<const float*>(),
+                                 expected->byteSize()));
+    }
+}
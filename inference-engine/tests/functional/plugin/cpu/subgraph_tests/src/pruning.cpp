@@ -0,0 +1,158 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <cpu/cpu_config.hpp>
+#include <exec_graph_info.hpp>
+#include <algorithm>
+#include <set>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+enum class PrunedLayer {
+    Convolution,
+    MatMul
+};
+
+// Relu keeps the zeroed channels zero, Sigmoid doesn't, so the channels can't be pruned
+enum class Activation {
+    Relu,
+    Sigmoid
+};
+
+typedef std::tuple<
+        PrunedLayer,
+        Activation,
+        std::string     // Device name
+> PruningParams;
+
+/* The first layer has zeroed output channels, which are removed with the corresponding input channels of the second
+   layer when CPU_PRUNING is enabled. The network outputs must match the unpruned network.
+
+        Input
+          |
+    Convolution/MatMul  (outChannels, zeroChannels of them are zeroed)
+          |
+     Relu/Sigmoid
+          |
+    Convolution/MatMul  (lastOutChannels)
+          |
+        Output
+*/
+class PruningTest : public testing::WithParamInterface<PruningParams>,
+                    virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<PruningParams> &obj) {
+        PrunedLayer layer;
+        Activation activation;
+        std::string targetName;
+        std::tie(layer, activation, targetName) = obj.param;
+        std::ostringstream results;
+
+        results << "Layer=" << (layer == PrunedLayer::Convolution ? "Convolution" : "MatMul")
+                << "_Activation=" << (activation == Activation::Relu ? "Relu" : "Sigmoid")
+                << "_targetDevice=" << targetName;
+
+        return results.str();
+    }
+
+protected:
+    const size_t inChannels = 3;
+    const size_t outChannels = 6;
+    const size_t lastOutChannels = 5;
+    const std::vector<size_t> zeroChannels = {1, 4};
+
+    PrunedLayer layer;
+    Activation activation;
+
+    std::shared_ptr<Node> makeActivation(const Output<Node>& input) const {
+        if (activation == Activation::Relu)
+            return std::make_shared<opset1::Relu>(input);
+        return std::make_shared<opset1::Sigmoid>(input);
+    }
+
+    void SetUp() override {
+        std::tie(layer, activation, targetDevice) = this->GetParam();
+        configuration.insert({CPUConfigParams::KEY_CPU_PRUNING, PluginConfigParams::YES});
+
+        std::vector<float> weights(outChannels * inChannels * 9);
+        for (size_t i = 0; i < weights.size(); i++)
+            weights[i] = static_cast<float>(i % 7) * 0.1f - 0.3f;
+        const auto isZeroChannel = [&](size_t channel) {
+            return std::find(zeroChannels.begin(), zeroChannels.end(), channel) != zeroChannels.end();
+        };
+
+        ParameterVector params;
+        std::shared_ptr<Node> first, last;
+        if (layer == PrunedLayer::Convolution) {
+            params = builder::makeParams(element::f32, {{1, inChannels, 8, 8}});
+            // OIHW layout, so each output channel is a contiguous block
+            const size_t channelSize = inChannels * 9;
+            for (size_t i = 0; i < weights.size(); i++) {
+                if (isZeroChannel(i / channelSize))
+                    weights[i] = 0.f;
+            }
+            first = builder::makeConvolution(params[0], element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                             op::PadType::EXPLICIT, outChannels, false, weights);
+            const auto act = makeActivation(first);
+            last = builder::makeConvolution(act, element::f32, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                            op::PadType::EXPLICIT, lastOutChannels, false);
+        } else {
+            const size_t inFeatures = weights.size() / outChannels;
+            params = builder::makeParams(element::f32, {{2, inFeatures}});
+            // [K, N] weights, so each output channel is a column
+            for (size_t i = 0; i < weights.size(); i++) {
+                if (isZeroChannel(i % outChannels))
+                    weights[i] = 0.f;
+            }
+            const auto weightsConst = builder::makeConstant<float>(element::f32, {inFeatures, outChannels}, weights);
+            first = std::make_shared<opset1::MatMul>(params[0], weightsConst);
+            const auto act = makeActivation(first);
+            const auto lastWeights = builder::makeConstant<float>(element::f32, {outChannels, lastOutChannels}, {}, true);
+            last = std::make_shared<opset1::MatMul>(act, lastWeights);
+        }
+
+        function = std::make_shared<Function>(ResultVector{std::make_shared<opset1::Result>(last)}, params, "Pruning");
+    }
+
+    void CheckPrunedChannels() {
+        const std::string layerType = layer == PrunedLayer::Convolution ? "Convolution" : "FullyConnected";
+        std::multiset<size_t> channels;
+        const auto execGraph = executableNetwork.GetExecGraphInfo().getFunction();
+        ASSERT_NE(nullptr, execGraph);
+        for (const auto &node : execGraph->get_ops()) {
+            const auto &rtInfo = node->get_rt_info();
+            const auto it = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+            ASSERT_NE(rtInfo.end(), it);
+            const auto type = std::dynamic_pointer_cast<VariantImpl<std::string>>(it->second);
+            ASSERT_NE(nullptr, type);
+            if (type->get() == layerType)
+                channels.insert(node->get_output_shape(0)[1]);
+        }
+
+        const size_t prunedChannels = activation == Activation::Relu ? zeroChannels.size() : 0;
+        const std::multiset<size_t> expected = {outChannels - prunedChannels, lastOutChannels};
+        ASSERT_EQ(expected, channels);
+    }
+};
+
+TEST_P(PruningTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckPrunedChannels();
+}
+
+namespace {
+INSTANTIATE_TEST_SUITE_P(smoke_Pruning, PruningTest,
+                         ::testing::Combine(
+                                 ::testing::Values(PrunedLayer::Convolution, PrunedLayer::MatMul),
+                                 ::testing::Values(Activation::Relu, Activation::Sigmoid),
+                                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                         PruningTest::getTestCaseName);
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
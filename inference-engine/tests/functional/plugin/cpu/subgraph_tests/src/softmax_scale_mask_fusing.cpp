@@ -0,0 +1,130 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+using namespace CPUTestUtils;
+
+namespace CPUSubgraphTestsDefinitions {
+typedef std::tuple<
+        Shape,          // Data shape
+        Shape,          // Mask shape
+        size_t,         // Axis
+        bool,           // With FakeQuantize on output
+        std::string     // Device name
+> SoftmaxScaleMaskFusingParams;
+
+/* Attention scores pattern. Multiply, Add and FakeQuantize are expected to be fused into Softmax node,
+   which still uses the jit implementation.
+
+    Input[data]   Constant[scale]
+          \          /
+           Multiply         Input[mask]
+                 \            /
+                  \          /
+                      Add
+                       |
+                    Softmax
+                       |
+                 [FakeQuantize]
+                       |
+                     Output
+*/
+class SoftmaxScaleMaskFusingTest : public testing::WithParamInterface<SoftmaxScaleMaskFusingParams>,
+                                   virtual public LayerTestsUtils::LayerTestsCommon,
+                                   public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<SoftmaxScaleMaskFusingParams> &obj) {
+        Shape dataShape, maskShape;
+        size_t axis;
+        bool withFQ;
+        std::string targetName;
+        std::tie(dataShape, maskShape, axis, withFQ, targetName) = obj.param;
+        std::ostringstream results;
+
+        results << "IS=" << dataShape
+                << "_MaskS=" << maskShape
+                << "_Axis=" << axis
+                << "_FQ=" << withFQ
+                << "_targetDevice=" << targetName;
+
+        return results.str();
+    }
+
+protected:
+    void SetUp() override {
+        Shape dataShape, maskShape;
+        size_t axis;
+        bool withFQ;
+        std::tie(dataShape, maskShape, axis, withFQ, targetDevice) = this->GetParam();
+
+        const auto params = builder::makeParams(element::f32, {dataShape, maskShape});
+        const auto scale = builder::makeConstant<float>(element::f32, {}, {0.125f});
+        const auto multiply = std::make_shared<opset6::Multiply>(params[0], scale);
+        const auto add = std::make_shared<opset6::Add>(multiply, params[1]);
+        std::shared_ptr<Node> output = std::make_shared<opset1::Softmax>(add, axis);
+        if (withFQ) {
+            output = builder::makeFakeQuantize(output, element::f32, 256, {}, {0.f}, {1.f}, {0.f}, {1.f});
+        }
+
+        ngraph::ResultVector results{std::make_shared<opset6::Result>(output)};
+        function = std::make_shared<ngraph::Function>(results, params, "SoftmaxScaleMaskFusing");
+
+        selectedType = getPrimitiveType() + "_" + InferenceEngine::Precision(InferenceEngine::Precision::FP32).name();
+    }
+};
+
+TEST_P(SoftmaxScaleMaskFusingTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    CheckNodeOfTypeCount(executableNetwork, "Eltwise", 0);
+    CheckNodeOfTypeCount(executableNetwork, "FakeQuantize", 0);
+    CheckPluginRelatedResults(executableNetwork, "Softmax");
+}
+
+namespace {
+INSTANTIATE_TEST_SUITE_P(smoke_SoftmaxScaleMaskFusing_4D, SoftmaxScaleMaskFusingTest,
+    ::testing::Combine(
+        ::testing::Values(Shape{2, 4, 16, 32}),
+        ::testing::Values(Shape{1, 1, 1, 32}, Shape{2, 1, 16, 32}, Shape{2, 4, 16, 32}),
+        ::testing::Values(3),
+        ::testing::Values(false, true),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+    SoftmaxScaleMaskFusingTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_SoftmaxScaleMaskFusing_3D, SoftmaxScaleMaskFusingTest,
+    ::testing::Combine(
+        ::testing::Values(Shape{4, 16, 16}),
+        ::testing::Values(Shape{16}, Shape{1, 16, 16}),
+        ::testing::Values(2),
+        ::testing::Values(false, true),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+    SoftmaxScaleMaskFusingTest::getTestCaseName);
+
+// axis length is not a multiple of the vector length
+INSTANTIATE_TEST_SUITE_P(smoke_SoftmaxScaleMaskFusing_AxisTail, SoftmaxScaleMaskFusingTest,
+    ::testing::Combine(
+        ::testing::Values(Shape{4, 3, 19}),
+        ::testing::Values(Shape{19}, Shape{4, 3, 19}, Shape{4, 3, 1}),
+        ::testing::Values(2),
+        ::testing::Values(false, true),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+    SoftmaxScaleMaskFusingTest::getTestCaseName);
+
+// softmax over channels: the kernel is vectorized over spatial dimensions
+INSTANTIATE_TEST_SUITE_P(smoke_SoftmaxScaleMaskFusing_Channels, SoftmaxScaleMaskFusingTest,
+    ::testing::Combine(
+        ::testing::Values(Shape{2, 8, 5, 7}),
+        ::testing::Values(Shape{2, 1, 5, 7}, Shape{2, 8, 5, 7}, Shape{1, 8, 1, 1}),
+        ::testing::Values(1),
+        ::testing::Values(false, true),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+    SoftmaxScaleMaskFusingTest::getTestCaseName);
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
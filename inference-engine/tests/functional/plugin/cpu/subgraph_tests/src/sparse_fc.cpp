@@ -0,0 +1,183 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <cpu/cpu_config.hpp>
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using SparseFCTestParams = std::tuple<SizeVector,       // input shape
+                                      size_t,           // output channels
+                                      float,            // fraction of zero weights
+                                      bool,             // with relu
+                                      element::Type,    // source precision (u8/i8 means quantized source and i8 weights)
+                                      std::string>;     // sparse weights decompression rate, empty for default
+
+/* The weights with the fraction of zeros not less than the decompression rate are multiplied by the sparse kernel,
+   which reports jit implementation type and doesn't fuse the following Relu. Otherwise the dense inner product
+   is used and Relu is fused.
+
+    Input[data]                        Input[data]
+        |                                  |
+        |     Constant[f32]           FakeQuantize    Constant[i8]
+        |       /                          |              |
+        |      /                           |           Convert
+        MatMul                             |              |
+          |                                |           Multiply
+        [Relu]                              \            /
+          |                                      MatMul
+        Output                                     |
+                                                 [Relu]
+                                                   |
+                                                 Output
+*/
+class SparseFCTest : public testing::WithParamInterface<SparseFCTestParams>, public CPUTestsBase,
+                     virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<SparseFCTestParams> obj) {
+        SizeVector inputShape;
+        size_t outChannels;
+        float sparsity;
+        bool withRelu;
+        element::Type srcType;
+        std::string rate;
+        std::tie(inputShape, outChannels, sparsity, withRelu, srcType, rate) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "OC=" << outChannels << "_";
+        result << "Sparsity=" << sparsity << "_";
+        result << "Relu=" << withRelu << "_";
+        result << "SrcPrc=" << srcType << "_";
+        result << "Rate=" << (rate.empty() ? "default" : rate);
+        return result.str();
+    }
+
+protected:
+    bool expectSparse = false;
+    bool withRelu = false;
+
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        SizeVector inputShape;
+        size_t outChannels;
+        float sparsity;
+        element::Type srcType;
+        std::string rate;
+        std::tie(inputShape, outChannels, sparsity, withRelu, srcType, rate) = this->GetParam();
+
+        if (!rate.empty())
+            configuration.insert({CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE, rate});
+        expectSparse = sparsity >= (rate.empty() ? 0.8f : std::stof(rate));
+
+        const size_t inChannels = inputShape.back();
+        std::vector<float> weights(outChannels * inChannels);
+        std::mt19937 gen(0);
+        std::uniform_real_distribution<float> values(-1.f, 1.f);
+        std::uniform_int_distribution<int> intValues(-127, 127);
+        // the fraction of zeros is exact to keep it on the expected side of the decompression rate
+        std::vector<size_t> order(weights.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::shuffle(order.begin(), order.end(), gen);
+        const auto zerosCount = static_cast<size_t>(sparsity * weights.size() + 0.5f);
+        for (size_t i = 0; i < order.size(); i++) {
+            float value = srcType == element::f32 ? values(gen) : static_cast<float>(intValues(gen));
+            if (value == 0.f)
+                value = 1.f;
+            weights[order[i]] = i < zerosCount ? 0.f : value;
+        }
+
+        auto params = builder::makeParams(element::f32, {inputShape});
+        std::shared_ptr<Node> matrixA = params[0];
+        std::shared_ptr<Node> matrixB;
+        if (srcType == element::f32) {
+            matrixB = builder::makeConstant<float>(element::f32, {outChannels, inChannels}, weights);
+        } else {
+            const bool isSigned = srcType == element::i8;
+            const float low = isSigned ? -1.28f : 0.f;
+            const float high = isSigned ? 1.27f : 2.55f;
+            matrixA = builder::makeFakeQuantize(matrixA, element::f32, 256, {}, {low}, {high}, {low}, {high});
+            const auto weightsConst = builder::makeConstant<float>(element::i8, {outChannels, inChannels}, weights);
+            const auto convert = std::make_shared<opset1::Convert>(weightsConst, element::f32);
+            matrixB = std::make_shared<opset1::Multiply>(convert, builder::makeConstant<float>(element::f32, {}, {0.01f}));
+        }
+        std::shared_ptr<Node> output = builder::makeMatMul(matrixA, matrixB, false, true);
+        if (withRelu)
+            output = std::make_shared<opset1::Relu>(output);
+
+        function = std::make_shared<Function>(ResultVector{std::make_shared<opset1::Result>(output)}, params, "SparseFC");
+
+        selectedType = getPrimitiveType() + "_" + (srcType == element::f32 ? "FP32" : "I8");
+    }
+};
+
+TEST_P(SparseFCTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "FullyConnected", 1);
+    if (expectSparse) {
+        CheckPluginRelatedResults(executableNetwork, "FullyConnected");
+    }
+    if (withRelu && std::get<4>(GetParam()) == element::f32) {
+        // Relu is fused into the dense inner product only
+        CheckNodeOfTypeCount(executableNetwork, "Eltwise", expectSparse ? 1 : 0);
+    }
+}
+
+namespace {
+
+const std::vector<SizeVector> inputShapes = {
+    {1, 64},
+    {3, 64},
+    {37, 100},
+    {2, 25, 64}
+};
+
+const std::vector<size_t> outChannels = {
+    16, 130
+};
+
+const std::vector<float> sparsity = {
+    0.5f, 0.9f
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Check, SparseFCTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::ValuesIn(outChannels),
+                                            ::testing::ValuesIn(sparsity),
+                                            ::testing::Values(false, true),
+                                            ::testing::Values(element::f32),
+                                            ::testing::Values("")),
+                         SparseFCTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_Check_I8, SparseFCTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::ValuesIn(outChannels),
+                                            ::testing::ValuesIn(sparsity),
+                                            ::testing::Values(false, true),
+                                            ::testing::Values(element::u8, element::i8),
+                                            ::testing::Values("")),
+                         SparseFCTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_Check_Rate, SparseFCTest,
+                         ::testing::Combine(::testing::Values(SizeVector{3, 64}),
+                                            ::testing::Values(16),
+                                            ::testing::ValuesIn(sparsity),
+                                            ::testing::Values(true),
+                                            ::testing::Values(element::f32),
+                                            ::testing::Values("0.4", "1")),
+                         SparseFCTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
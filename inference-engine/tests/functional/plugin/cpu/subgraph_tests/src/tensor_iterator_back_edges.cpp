@@ -0,0 +1,128 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <ngraph/opsets/opset5.hpp>
+
+using namespace ngraph;
+
+namespace CPUSubgraphTestsDefinitions {
+enum class BackEdgesPattern {
+    SHARED,         // one body output feeds two back edges
+    OVERLAPPED      // body outputs are placed inside a single in-place Concat buffer
+};
+
+typedef std::tuple<
+        BackEdgesPattern,
+        bool,           // Loop (true) or TensorIterator (false)
+        std::string     // Device name
+> TensorIteratorBackEdgesParams;
+
+/* Back edges which must not be executed as buffer swaps.
+
+    SHARED:                              OVERLAPPED:
+
+     H1    H2    Xi                       H1   Xi   H2
+      \    /     |                         \  /  \  /
+       Add      /                          Add    Mul
+          \    /                              \  /   \
+           Add ----> H1, H2                  Concat   \
+            |                                   |      \
+          Result                             Result    Relu
+                                        (Add -> H1, Relu -> H2)
+*/
+class TensorIteratorBackEdgesTest : public testing::WithParamInterface<TensorIteratorBackEdgesParams>,
+                                    virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<TensorIteratorBackEdgesParams> &obj) {
+        BackEdgesPattern pattern;
+        bool useLoop;
+        std::string targetName;
+        std::tie(pattern, useLoop, targetName) = obj.param;
+        std::ostringstream results;
+
+        results << "Pattern=" << (pattern == BackEdgesPattern::SHARED ? "SHARED" : "OVERLAPPED")
+                << "_Op=" << (useLoop ? "Loop" : "TensorIterator")
+                << "_targetDevice=" << targetName;
+
+        return results.str();
+    }
+
+protected:
+    void SetUp() override {
+        BackEdgesPattern pattern;
+        bool useLoop;
+        std::tie(pattern, useLoop, targetDevice) = this->GetParam();
+
+        const size_t iterations = 5;
+        const Shape stateShape{1, 16};
+        const auto params = builder::makeParams(element::f32, {{1, iterations, 16}, stateShape, stateShape});
+
+        const auto Xi = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 1, 16});
+        const auto H1 = std::make_shared<opset5::Parameter>(element::f32, stateShape);
+        const auto H2 = std::make_shared<opset5::Parameter>(element::f32, stateShape);
+        const auto squeeze = std::make_shared<opset5::Squeeze>(Xi, builder::makeConstant<int64_t>(element::i64, {1}, {1}));
+
+        std::shared_ptr<Node> H1out, H2out, Yout;
+        if (pattern == BackEdgesPattern::SHARED) {
+            const auto sum = std::make_shared<opset5::Add>(H1, H2);
+            H1out = H2out = Yout = std::make_shared<opset5::Add>(sum, squeeze);
+        } else {
+            H1out = std::make_shared<opset5::Add>(H1, squeeze);
+            const auto mul = std::make_shared<opset5::Multiply>(H2, squeeze);
+            H2out = std::make_shared<opset5::Relu>(mul);
+            Yout = std::make_shared<opset5::Concat>(OutputVector{H1out, mul}, 1);
+        }
+
+        const auto H1res = std::make_shared<opset5::Result>(H1out);
+        const auto H2res = pattern == BackEdgesPattern::SHARED ? H1res : std::make_shared<opset5::Result>(H2out);
+        const auto Yres = pattern == BackEdgesPattern::SHARED ? H1res : std::make_shared<opset5::Result>(Yout);
+        ResultVector bodyResults{H1res};
+        if (H2res != H1res)
+            bodyResults.push_back(H2res);
+        if (Yres != H1res)
+            bodyResults.push_back(Yres);
+
+        std::shared_ptr<op::util::SubGraphOp> subGraph;
+        if (useLoop) {
+            const auto condition = std::make_shared<opset5::Result>(
+                    std::make_shared<opset5::Constant>(element::boolean, Shape{1}, true));
+            bodyResults.push_back(condition);
+            const auto loop = std::make_shared<opset5::Loop>(
+                    std::make_shared<opset5::Constant>(element::i64, Shape{1}, iterations),
+                    std::make_shared<opset5::Constant>(element::boolean, Shape{1}, true));
+            loop->set_special_body_ports({-1, static_cast<int64_t>(bodyResults.size() - 1)});
+            subGraph = loop;
+        } else {
+            subGraph = std::make_shared<opset5::TensorIterator>();
+        }
+
+        subGraph->set_function(std::make_shared<Function>(bodyResults, ParameterVector{Xi, H1, H2}));
+        subGraph->set_sliced_input(Xi, params[0], 0, 1, 1, -1, 1);
+        subGraph->set_merged_input(H1, params[1], H1res);
+        subGraph->set_merged_input(H2, params[2], H2res);
+
+        ResultVector results{std::make_shared<opset5::Result>(subGraph->get_iter_value(H1res, -1)),
+                             std::make_shared<opset5::Result>(subGraph->get_iter_value(H2res, -1)),
+                             std::make_shared<opset5::Result>(subGraph->get_iter_value(Yres, -1))};
+        function = std::make_shared<Function>(results, params, "TensorIteratorBackEdges");
+    }
+};
+
+TEST_P(TensorIteratorBackEdgesTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+namespace {
+INSTANTIATE_TEST_SUITE_P(smoke_TensorIteratorBackEdges, TensorIteratorBackEdgesTest,
+                         ::testing::Combine(
+                                 ::testing::Values(BackEdgesPattern::SHARED, BackEdgesPattern::OVERLAPPED),
+                                 ::testing::Bool(),
+                                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                         TensorIteratorBackEdgesTest::getTestCaseName);
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
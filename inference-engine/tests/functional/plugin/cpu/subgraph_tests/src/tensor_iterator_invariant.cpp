@@ -0,0 +1,113 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <ngraph/opsets/opset5.hpp>
+
+using namespace ngraph;
+
+namespace CPUSubgraphTestsDefinitions {
+typedef std::tuple<
+        bool,           // Loop (true) or TensorIterator (false)
+        std::string     // Device name
+> TensorIteratorInvariantParams;
+
+/* The body part depending only on the invariant input W is computed on the first iteration only, its results must
+   stay valid for the next iterations. The output of every iteration is compared with the reference.
+
+        W (invariant)       H (merged)   Xi (sliced)
+        |     \                 \        /
+   Multiply(0.5) \                 Add
+        |         \                 |
+     Sigmoid -----------------------> Add
+        |           \                 |
+       Inv           `-------------> Multiply
+                                      |
+                                     Hout
+
+   Hout is the back edge to H and is concatenated over the iterations, Inv is taken from the last iteration.
+*/
+class TensorIteratorInvariantTest : public testing::WithParamInterface<TensorIteratorInvariantParams>,
+                                    virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<TensorIteratorInvariantParams> &obj) {
+        bool useLoop;
+        std::string targetName;
+        std::tie(useLoop, targetName) = obj.param;
+        std::ostringstream results;
+
+        results << "Op=" << (useLoop ? "Loop" : "TensorIterator")
+                << "_targetDevice=" << targetName;
+
+        return results.str();
+    }
+
+protected:
+    void SetUp() override {
+        bool useLoop;
+        std::tie(useLoop, targetDevice) = this->GetParam();
+
+        const size_t iterations = 6;
+        const Shape stateShape{1, 16};
+        const auto params = builder::makeParams(element::f32, {{1, iterations, 16}, stateShape, stateShape});
+
+        const auto Xi = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 1, 16});
+        const auto H = std::make_shared<opset5::Parameter>(element::f32, stateShape);
+        const auto W = std::make_shared<opset5::Parameter>(element::f32, stateShape);
+        const auto squeeze = std::make_shared<opset5::Squeeze>(Xi, builder::makeConstant<int64_t>(element::i64, {1}, {1}));
+
+        // the invariant part
+        const auto scaled = std::make_shared<opset5::Multiply>(W, builder::makeConstant<float>(element::f32, {1}, {0.5f}));
+        const auto inv = std::make_shared<opset5::Sigmoid>(scaled);
+
+        // the variant part uses both the invariant part and the invariant input itself
+        const auto sum = std::make_shared<opset5::Add>(H, squeeze);
+        const auto shifted = std::make_shared<opset5::Add>(sum, inv);
+        const auto Hout = std::make_shared<opset5::Multiply>(shifted, W);
+
+        const auto Hres = std::make_shared<opset5::Result>(Hout);
+        const auto Invres = std::make_shared<opset5::Result>(inv);
+        ResultVector bodyResults{Hres, Invres};
+
+        std::shared_ptr<op::util::SubGraphOp> subGraph;
+        if (useLoop) {
+            const auto condition = std::make_shared<opset5::Result>(
+                    std::make_shared<opset5::Constant>(element::boolean, Shape{1}, true));
+            bodyResults.push_back(condition);
+            const auto loop = std::make_shared<opset5::Loop>(
+                    std::make_shared<opset5::Constant>(element::i64, Shape{1}, iterations),
+                    std::make_shared<opset5::Constant>(element::boolean, Shape{1}, true));
+            loop->set_special_body_ports({-1, static_cast<int64_t>(bodyResults.size() - 1)});
+            subGraph = loop;
+        } else {
+            subGraph = std::make_shared<opset5::TensorIterator>();
+        }
+
+        subGraph->set_function(std::make_shared<Function>(bodyResults, ParameterVector{Xi, H, W}));
+        subGraph->set_sliced_input(Xi, params[0], 0, 1, 1, -1, 1);
+        subGraph->set_merged_input(H, params[1], Hres);
+        subGraph->set_invariant_input(W, params[2]);
+
+        ResultVector results{std::make_shared<opset5::Result>(subGraph->get_concatenated_slices(Hres, 0, 1, 1, -1, 0)),
+                             std::make_shared<opset5::Result>(subGraph->get_iter_value(Hres, -1)),
+                             std::make_shared<opset5::Result>(subGraph->get_iter_value(Invres, -1))};
+        function = std::make_shared<Function>(results, params, "TensorIteratorInvariant");
+    }
+};
+
+TEST_P(TensorIteratorInvariantTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+namespace {
+INSTANTIATE_TEST_SUITE_P(smoke_TensorIteratorInvariant, TensorIteratorInvariantTest,
+                         ::testing::Combine(
+                                 ::testing::Bool(),
+                                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                         TensorIteratorInvariantTest::getTestCaseName);
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,180 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/opsets/opset3.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+const size_t channels = 16;
+
+/* The state accumulates the inputs, so the output of the n-th inference is the sum of the n inputs
+   after the state reset.
+
+        Input   ReadValue(zeros)
+            \     /
+              Add ---- Assign
+               |
+           Multiply(1)
+               |
+            Output
+*/
+CNNNetwork makeNetwork() {
+    using namespace ngraph;
+    const auto input = std::make_shared<opset3::Parameter>(element::f32, Shape{1, channels});
+    input->set_friendly_name("input");
+    const auto init = opset3::Constant::create(element::f32, Shape{1, channels}, std::vector<float>(channels, 0.f));
+    const auto read = std::make_shared<opset3::ReadValue>(init, "state");
+    const auto add = std::make_shared<opset3::Add>(read, input);
+    const auto assign = std::make_shared<opset3::Assign>(add, "state");
+    const auto output = std::make_shared<opset3::Multiply>(add, opset3::Constant::create(element::f32, Shape{}, {1.f}));
+    output->set_friendly_name("output");
+
+    // WA. Limitation of ngraph. control_dependency are required.
+    assign->add_control_dependency(read);
+    output->add_control_dependency(assign);
+
+    return CNNNetwork(std::make_shared<Function>(NodeVector{output}, ParameterVector{input}));
+}
+
+ExecutableNetwork loadNetwork(Core& ie) {
+    return ie.LoadNetwork(makeNetwork(), CommonTestUtils::DEVICE_CPU,
+                          {{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "2"}});
+}
+
+void setInput(InferRequest& request, float value) {
+    auto blob = request.GetBlob("input");
+    auto data = blob->buffer().as<float*>();
+    std::fill(data, data + blob->size(), value);
+}
+
+void checkValues(const Blob::CPtr& blob, float expected, const std::string& what) {
+    ASSERT_EQ(channels, blob->size());
+    const auto data = blob->cbuffer().as<const float*>();
+    for (size_t i = 0; i < blob->size(); i++)
+        ASSERT_EQ(expected, data[i]) << what << " at " << i;
+}
+
+void checkOutput(InferRequest& request, float expected) {
+    checkValues(request.GetBlob("output"), expected, "output");
+}
+
+VariableState getState(InferRequest& request) {
+    auto states = request.QueryState();
+    IE_ASSERT(states.size() == 1);
+    return states.front();
+}
+} // namespace
+
+TEST(VariableStatesStreamsTest, smoke_requestsAccumulateOwnStates) {
+    Core ie;
+    auto execNet = loadNetwork(ie);
+    std::vector<InferRequest> requests;
+    for (int r = 0; r < 3; r++) {
+        requests.push_back(execNet.CreateInferRequest());
+        setInput(requests.back(), static_cast<float>(r + 1));
+    }
+
+    // the requests infer in turns on the graphs of both streams
+    for (int iteration = 1; iteration <= 4; iteration++) {
+        for (size_t r = 0; r < requests.size(); r++) {
+            requests[r].Infer();
+            checkOutput(requests[r], static_cast<float>(iteration * (r + 1)));
+        }
+    }
+    for (size_t r = 0; r < requests.size(); r++)
+        checkValues(getState(requests[r]).GetState(), static_cast<float>(4 * (r + 1)), "state");
+
+    // and concurrently
+    for (auto& request : requests)
+        request.StartAsync();
+    for (size_t r = 0; r < requests.size(); r++) {
+        ASSERT_EQ(StatusCode::OK, requests[r].Wait(InferRequest::WaitMode::RESULT_READY));
+        checkOutput(requests[r], static_cast<float>(5 * (r + 1)));
+    }
+}
+
+TEST(VariableStatesStreamsTest, smoke_initialStateIsZero) {
+    Core ie;
+    auto execNet = loadNetwork(ie);
+    auto first = execNet.CreateInferRequest();
+    setInput(first, 3.f);
+    first.Infer();
+    first.Infer();
+
+    // the state of a new request doesn't depend on the states of the other requests
+    auto second = execNet.CreateInferRequest();
+    checkValues(getState(second).GetState(), 0.f, "initial state");
+    setInput(second, 2.f);
+    second.Infer();
+    checkOutput(second, 2.f);
+}
+
+TEST(VariableStatesStreamsTest, smoke_resetAffectsOwnStateOnly) {
+    Core ie;
+    auto execNet = loadNetwork(ie);
+    auto first = execNet.CreateInferRequest();
+    auto second = execNet.CreateInferRequest();
+    setInput(first, 1.f);
+    setInput(second, 2.f);
+    for (int i = 0; i < 2; i++) {
+        first.Infer();
+        second.Infer();
+    }
+
+    getState(first).Reset();
+    checkValues(getState(first).GetState(), 0.f, "reset state");
+    first.Infer();
+    second.Infer();
+    checkOutput(first, 1.f);
+    checkOutput(second, 6.f);
+}
+
+TEST(VariableStatesStreamsTest, smoke_setAndGetState) {
+    Core ie;
+    auto execNet = loadNetwork(ie);
+    auto first = execNet.CreateInferRequest();
+    auto second = execNet.CreateInferRequest();
+    setInput(first, 1.f);
+    setInput(second, 1.f);
+
+    auto state = getState(first);
+    auto newState = make_shared_blob<float>(state.GetState()->getTensorDesc());
+    newState->allocate();
+    auto data = newState->buffer().as<float*>();
+    std::fill(data, data + newState->size(), 10.f);
+    state.SetState(newState);
+    checkValues(getState(first).GetState(), 10.f, "set state");
+
+    first.Infer();
+    second.Infer();
+    checkOutput(first, 11.f);
+    checkOutput(second, 1.f);
+    checkValues(getState(first).GetState(), 11.f, "state after inference");
+    checkValues(getState(second).GetState(), 1.f, "state after inference");
+}
+
+TEST(VariableStatesStreamsTest, smoke_graphDoesNotKeepStateOfDestroyedRequest) {
+    Core ie;
+    auto execNet = loadNetwork(ie);
+    {
+        auto request = execNet.CreateInferRequest();
+        setInput(request, 5.f);
+        request.Infer();
+    }
+
+    auto request = execNet.CreateInferRequest();
+    setInput(request, 1.f);
+    request.Infer();
+    request.Infer();
+    checkOutput(request, 2.f);
+}
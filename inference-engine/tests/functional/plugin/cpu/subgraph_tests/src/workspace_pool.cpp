@@ -0,0 +1,93 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <vector>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <cpu/cpu_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+const size_t streams = 4;
+const size_t requestsCount = 8;
+
+CNNNetwork makeNetwork() {
+    const auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 16, 32, 32});
+    std::shared_ptr<ngraph::Node> output = param;
+    for (int i = 0; i < 4; i++) {
+        const auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{16, 16, 3, 3},
+                                                              std::vector<float>(16 * 16 * 9, 0.01f * (i + 1)));
+        output = std::make_shared<ngraph::opset1::Convolution>(output, weights, ngraph::Strides{1, 1},
+                                                               ngraph::CoordinateDiff{1, 1}, ngraph::CoordinateDiff{1, 1},
+                                                               ngraph::Strides{1, 1});
+        output = std::make_shared<ngraph::opset1::Relu>(output);
+    }
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::NodeVector{output}, ngraph::ParameterVector{param}));
+}
+
+void fillInput(InferRequest& request, const std::string& inputName, size_t seed) {
+    auto input = request.GetBlob(inputName);
+    auto data = input->buffer().as<float*>();
+    for (size_t i = 0; i < input->size(); i++)
+        data[i] = static_cast<float>(static_cast<int>((i + seed) % 13) - 6) * 0.25f;
+}
+
+void checkWorkspacePool(const std::string& poolSize) {
+    Core ie;
+    const auto network = makeNetwork();
+    const std::string inputName = network.getInputsInfo().begin()->first;
+    const std::string outputName = network.getOutputsInfo().begin()->first;
+    auto referenceNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                  {{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(streams)},
+                                   {CPUConfigParams::KEY_CPU_WORKSPACE_POOL_SIZE, poolSize}});
+    ASSERT_EQ(poolSize, execNet.GetConfig(CPUConfigParams::KEY_CPU_WORKSPACE_POOL_SIZE).as<std::string>());
+
+    // more requests than the pooled graphs run at once, so the streams wait for the leased graphs
+    std::vector<InferRequest> requests;
+    for (size_t r = 0; r < requestsCount; r++) {
+        requests.push_back(execNet.CreateInferRequest());
+        fillInput(requests.back(), inputName, r);
+    }
+    for (int iteration = 0; iteration < 3; iteration++) {
+        for (auto& request : requests)
+            request.StartAsync();
+        for (auto& request : requests)
+            ASSERT_EQ(StatusCode::OK, request.Wait(InferRequest::WaitMode::RESULT_READY));
+    }
+
+    auto referenceRequest = referenceNet.CreateInferRequest();
+    for (size_t r = 0; r < requestsCount; r++) {
+        fillInput(referenceRequest, inputName, r);
+        referenceRequest.Infer();
+        const auto expected = referenceRequest.GetBlob(outputName);
+        const auto actual = requests[r].GetBlob(outputName);
+        ASSERT_EQ(expected->byteSize(), actual->byteSize());
+        EXPECT_EQ(0, std::memcmp(expected->cbuffer().as<const float*>(), actual->cbuffer().as<const float*>(),
+                                 expected->byteSize())) << "request " << r;
+    }
+}
+} // namespace
+
+TEST(WorkspacePoolTest, smoke_singleGraphForSeveralStreams) {
+    checkWorkspacePool("1");
+}
+
+TEST(WorkspacePoolTest, smoke_fewerGraphsThanStreams) {
+    checkWorkspacePool("2");
+}
+
+TEST(WorkspacePoolTest, wrongPoolSizeThrows) {
+    Core ie;
+    ASSERT_THROW(ie.LoadNetwork(makeNetwork(), CommonTestUtils::DEVICE_CPU,
+                                {{CPUConfigParams::KEY_CPU_WORKSPACE_POOL_SIZE, "-1"}}), Exception);
+}
@@ -12,6 +12,7 @@
 #include <file_utils.h>
 #include <ngraph_functions/subgraph_builders.hpp>
 #include <functional_test_utils/blob_utils.hpp>
+#include <common_test_utils/common_utils.hpp>
 #include <common_test_utils/file_utils.hpp>
 #include <common_test_utils/test_assertions.hpp>
 #include <common_test_utils/test_constants.hpp>
@@ -197,6 +198,12 @@ public:
         modelClass = std::get<3>(GetParam());
     }
 
+    void TearDown() override {
+        for (size_t i = 0; i < modelPaths.size(); i++) {
+            CommonTestUtils::removeIRFiles(modelPaths[i], weightsPaths[i]);
+        }
+    }
+
     static std::string getTestCaseName(testing::TestParamInfo<CoreThreadingParams > obj) {
         unsigned int numThreads, numIterations;
         std::string deviceName;
@@ -221,6 +228,8 @@ public:
     unsigned int numThreads;
 
     std::vector<InferenceEngine::CNNNetwork> networks;
+    // IR files written by the test, they are removed in TearDown even if the test fails
+    std::vector<std::string> modelPaths, weightsPaths;
     void SetupNetworks() {
         if (modelClass == ModelClass::ConvPoolRelu) {
             for (unsigned i = 0; i < numThreads; i++) {
@@ -316,3 +325,44 @@ TEST_P(CoreThreadingTestsWithIterations, smoke_LoadNetwork_MultipleIECores) {
         (void)ie.LoadNetwork(networks[value % networks.size()], deviceName);
     }, numIterations, numThreads);
 }
+
+// tested function: LoadNetworks
+TEST_P(CoreThreadingTestsWithIterations, smoke_LoadNetworks) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    InferenceEngine::Core ie;
+
+    SetupNetworks();
+
+    const std::string testPrefix = "CoreThreadingTests_LoadNetworks_" + CommonTestUtils::GetTimestamp() + "_";
+    for (size_t i = 0; i < networks.size(); i++) {
+        const std::string prefix = testPrefix + std::to_string(i);
+        modelPaths.push_back(prefix + ".xml");
+        weightsPaths.push_back(prefix + ".bin");
+        networks[i].serialize(modelPaths.back(), weightsPaths.back());
+    }
+
+    ie.SetConfig(config, deviceName);
+    for (unsigned int i = 0; i < numIterations; i++) {
+        auto execNetworks = ie.LoadNetworks(modelPaths, deviceName, {}, numThreads);
+        ASSERT_EQ(networks.size(), execNetworks.size());
+        for (size_t j = 0; j < networks.size(); j++) {
+            ASSERT_EQ(networks[j].getOutputsInfo().size(), execNetworks[j].GetOutputsInfo().size());
+        }
+
+        // the network loaded from the IR infers as the one loaded directly
+        const size_t j = i % networks.size();
+        auto request = execNetworks[j].CreateInferRequest();
+        auto refRequest = ie.LoadNetwork(networks[j], deviceName).CreateInferRequest();
+        for (const auto& input : execNetworks[j].GetInputsInfo()) {
+            auto blob = FuncTestUtils::createAndFillBlob(input.second->getTensorDesc());
+            request.SetBlob(input.first, blob);
+            refRequest.SetBlob(input.first, blob);
+        }
+        request.Infer();
+        refRequest.Infer();
+        for (const auto& output : execNetworks[j].GetOutputsInfo()) {
+            FuncTestUtils::compareBlobs(request.GetBlob(output.first), refRequest.GetBlob(output.first));
+        }
+    }
+}
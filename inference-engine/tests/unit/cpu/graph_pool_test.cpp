@@ -0,0 +1,130 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <gtest/gtest.h>
+
+#include "utils/graph_pool.hpp"
+
+using MKLDNNPlugin::leaseGraph;
+
+namespace {
+struct FakeGraph {
+    std::mutex _mutex;
+    bool created = false;
+    int numaNodeId = -1;
+
+    struct Lock : public std::unique_lock<std::mutex> {
+        explicit Lock(FakeGraph& graph) : std::unique_lock<std::mutex>(graph._mutex), _graph(graph) {}
+        Lock(FakeGraph& graph, std::try_to_lock_t) : std::unique_lock<std::mutex>(graph._mutex, std::try_to_lock), _graph(graph) {}
+        FakeGraph& _graph;
+    };
+
+    bool IsCreated() const { return created; }
+    int getNumaNodeId() const { return numaNodeId; }
+};
+
+class GraphPoolTest : public ::testing::Test {
+protected:
+    std::deque<FakeGraph> graphs;
+
+    void createPool(const std::vector<int>& numaNodes) {
+        graphs.resize(numaNodes.size());
+        for (size_t i = 0; i < numaNodes.size(); i++) {
+            graphs[i].created = numaNodes[i] >= 0;
+            graphs[i].numaNodeId = numaNodes[i];
+        }
+    }
+
+    size_t indexOf(const FakeGraph::Lock& lock) const {
+        return static_cast<size_t>(&lock._graph - &graphs[0]);
+    }
+};
+} // namespace
+
+TEST_F(GraphPoolTest, takesOwnIdleGraph) {
+    createPool({0, 0});
+    auto lock = leaseGraph(graphs, 1, 0);
+    ASSERT_TRUE(lock.owns_lock());
+    EXPECT_EQ(1, indexOf(lock));
+}
+
+TEST_F(GraphPoolTest, takesOwnGraphToCreate) {
+    createPool({0, -1});
+    auto lock = leaseGraph(graphs, 1, 1);
+    ASSERT_TRUE(lock.owns_lock());
+    EXPECT_EQ(1, indexOf(lock));
+}
+
+TEST_F(GraphPoolTest, prefersIdleGraphOnSameNode) {
+    createPool({1, 0, 1, 0});
+    std::unique_lock<std::mutex> busy(graphs[0]._mutex);
+    auto lock = leaseGraph(graphs, 0, 0);
+    ASSERT_TRUE(lock.owns_lock());
+    EXPECT_EQ(1, indexOf(lock));
+}
+
+TEST_F(GraphPoolTest, prefersSameNodeOverRemoteIdleGraph) {
+    createPool({0, 1, 0});
+    std::unique_lock<std::mutex> busy(graphs[0]._mutex);
+    auto lock = leaseGraph(graphs, 0, 0);
+    ASSERT_TRUE(lock.owns_lock());
+    EXPECT_EQ(2, indexOf(lock));
+    // the remote graph is released as it is not selected
+    EXPECT_TRUE(std::unique_lock<std::mutex>(graphs[1]._mutex, std::try_to_lock).owns_lock());
+}
+
+TEST_F(GraphPoolTest, takesRemoteIdleGraphIfNoLocalOneIsIdle) {
+    createPool({0, 1, 0});
+    std::unique_lock<std::mutex> busy0(graphs[0]._mutex);
+    std::unique_lock<std::mutex> busy2(graphs[2]._mutex);
+    auto lock = leaseGraph(graphs, 0, 0);
+    ASSERT_TRUE(lock.owns_lock());
+    EXPECT_EQ(1, indexOf(lock));
+}
+
+TEST_F(GraphPoolTest, doesNotTakeOtherGraphToCreate) {
+    createPool({0, -1});
+    // declared before the locks to be destroyed after them if an assertion fails
+    std::future<size_t> leased;
+    std::unique_lock<std::mutex> busy(graphs[0]._mutex);
+    leased = std::async(std::launch::async, [&] {
+        return indexOf(leaseGraph(graphs, 0, 0));
+    });
+    ASSERT_EQ(std::future_status::timeout, leased.wait_for(std::chrono::milliseconds(100)));
+    busy.unlock();
+    EXPECT_EQ(0, leased.get());
+}
+
+TEST_F(GraphPoolTest, waitsForBusyGraphOnSameNode) {
+    // own graph is bound to another NUMA node, so the stream must wait for the local one
+    createPool({1, 0});
+    std::future<size_t> leased;
+    std::unique_lock<std::mutex> busy0(graphs[0]._mutex);
+    std::unique_lock<std::mutex> busy1(graphs[1]._mutex);
+    leased = std::async(std::launch::async, [&] {
+        return indexOf(leaseGraph(graphs, 0, 0));
+    });
+    ASSERT_EQ(std::future_status::timeout, leased.wait_for(std::chrono::milliseconds(100)));
+    busy1.unlock();
+    ASSERT_EQ(std::future_status::ready, leased.wait_for(std::chrono::seconds(10)));
+    EXPECT_EQ(1, leased.get());
+}
+
+TEST_F(GraphPoolTest, waitsForOwnGraphIfNoGraphOnSameNode) {
+    createPool({1, 1});
+    std::future<size_t> leased;
+    std::unique_lock<std::mutex> busy0(graphs[0]._mutex);
+    std::unique_lock<std::mutex> busy1(graphs[1]._mutex);
+    leased = std::async(std::launch::async, [&] {
+        return indexOf(leaseGraph(graphs, 1, 0));
+    });
+    ASSERT_EQ(std::future_status::timeout, leased.wait_for(std::chrono::milliseconds(100)));
+    busy1.unlock();
+    ASSERT_EQ(std::future_status::ready, leased.wait_for(std::chrono::seconds(10)));
+    EXPECT_EQ(1, leased.get());
+}
@@ -0,0 +1,139 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <set>
+#include <string>
+#include <gtest/gtest.h>
+
+#include "utils/huge_pages_allocator.h"
+
+using MKLDNNPlugin::HugePagesAllocator;
+
+namespace {
+size_t roundUp(size_t size, size_t alignment) {
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+// number of the free pages in the hugetlbfs pool, -1 if unknown
+long long freeExplicitHugePages() {
+    std::ifstream meminfo("/proc/meminfo");
+    std::string line;
+    const std::string field = "HugePages_Free:";
+    while (std::getline(meminfo, line)) {
+        if (line.compare(0, field.size(), field) == 0)
+            return std::stoll(line.substr(field.size()));
+    }
+    return -1;
+}
+
+#define SKIP_IF_NO_HUGE_PAGES()                                                   \
+    if (HugePagesAllocator::hugePageSize() == 0)                                  \
+        GTEST_SKIP() << "the system doesn't support huge pages"
+} // namespace
+
+TEST(HugePagesAllocatorTest, statisticsHaveAllKeys) {
+    HugePagesAllocator allocator(HugePagesAllocator::Mode::Transparent);
+    std::set<std::string> keys;
+    for (auto& entry : allocator.getStatistics()) {
+        keys.insert(entry.first);
+        EXPECT_EQ(0, entry.second) << entry.first;
+    }
+    const std::set<std::string> expected = {"allocations", "allocated_bytes", "mapped_bytes", "explicit_huge_page_bytes",
+                                            "transparent_huge_page_bytes", "small_page_bytes", "tlb_entries",
+                                            "explicit_fallbacks"};
+    EXPECT_EQ(expected, keys);
+}
+
+TEST(HugePagesAllocatorTest, smallAllocationsGoToHeap) {
+    SKIP_IF_NO_HUGE_PAGES();
+    HugePagesAllocator allocator(HugePagesAllocator::Mode::Transparent);
+    const size_t size = HugePagesAllocator::hugePageSize() - 1;
+    auto ptr = static_cast<uint8_t*>(allocator.alloc(size));
+    ASSERT_NE(nullptr, ptr);
+    std::memset(ptr, 1, size);
+
+    auto statistics = allocator.getStatistics();
+    EXPECT_EQ(1, statistics["allocations"]);
+    EXPECT_EQ(size, statistics["allocated_bytes"]);
+    EXPECT_EQ(0, statistics["mapped_bytes"]);
+    EXPECT_EQ(0, statistics["transparent_huge_page_bytes"]);
+    EXPECT_EQ(size, statistics["small_page_bytes"]);
+
+    EXPECT_TRUE(allocator.free(ptr));
+    EXPECT_EQ(0, allocator.getStatistics()["allocations"]);
+}
+
+TEST(HugePagesAllocatorTest, largeAllocationsAreAlignedAndFreed) {
+    SKIP_IF_NO_HUGE_PAGES();
+    const size_t hugePage = HugePagesAllocator::hugePageSize();
+    HugePagesAllocator allocator(HugePagesAllocator::Mode::Transparent);
+    const size_t sizes[] = {hugePage, 2 * hugePage + 123};
+    void* ptrs[2] = {};
+    for (int i = 0; i < 2; i++) {
+        ptrs[i] = allocator.alloc(sizes[i]);
+        ASSERT_NE(nullptr, ptrs[i]);
+        EXPECT_EQ(0, reinterpret_cast<uintptr_t>(ptrs[i]) % hugePage);
+        EXPECT_EQ(ptrs[i], allocator.lock(ptrs[i]));
+        auto bytes = static_cast<uint8_t*>(ptrs[i]);
+        std::memset(bytes, 0x5A, sizes[i]);
+        EXPECT_EQ(0x5A, bytes[sizes[i] - 1]);
+    }
+
+    auto statistics = allocator.getStatistics();
+    EXPECT_EQ(2, statistics["allocations"]);
+    EXPECT_EQ(sizes[0] + sizes[1], statistics["allocated_bytes"]);
+    EXPECT_EQ(roundUp(sizes[0], hugePage) + roundUp(sizes[1], hugePage), statistics["mapped_bytes"]);
+    EXPECT_EQ(0, statistics["explicit_huge_page_bytes"]);
+    EXPECT_EQ(0, statistics["explicit_fallbacks"]);
+    // the kernel may back the memory with the small pages if THP are disabled
+    EXPECT_LE(statistics["transparent_huge_page_bytes"], statistics["mapped_bytes"]);
+    EXPECT_EQ(statistics["allocated_bytes"],
+              statistics["small_page_bytes"] + std::min(statistics["transparent_huge_page_bytes"], statistics["allocated_bytes"]));
+
+    EXPECT_TRUE(allocator.free(ptrs[0]));
+    statistics = allocator.getStatistics();
+    EXPECT_EQ(1, statistics["allocations"]);
+    EXPECT_EQ(sizes[1], statistics["allocated_bytes"]);
+    EXPECT_EQ(roundUp(sizes[1], hugePage), statistics["mapped_bytes"]);
+
+    EXPECT_TRUE(allocator.free(ptrs[1]));
+    EXPECT_FALSE(allocator.free(ptrs[1]));
+    for (auto& entry : allocator.getStatistics())
+        EXPECT_EQ(0, entry.second) << entry.first;
+}
+
+TEST(HugePagesAllocatorTest, explicitModeFallsBackToTransparentPages) {
+    SKIP_IF_NO_HUGE_PAGES();
+    if (freeExplicitHugePages() != 0)
+        GTEST_SKIP() << "the hugetlbfs pool is not empty";
+    const size_t hugePage = HugePagesAllocator::hugePageSize();
+    HugePagesAllocator allocator(HugePagesAllocator::Mode::Explicit);
+    const size_t size = 2 * hugePage;
+    auto ptr = static_cast<uint8_t*>(allocator.alloc(size));
+    ASSERT_NE(nullptr, ptr);
+    EXPECT_EQ(0, reinterpret_cast<uintptr_t>(ptr) % hugePage);
+    std::memset(ptr, 1, size);
+
+    auto statistics = allocator.getStatistics();
+    EXPECT_EQ(1, statistics["explicit_fallbacks"]);
+    EXPECT_EQ(0, statistics["explicit_huge_page_bytes"]);
+    EXPECT_EQ(size, statistics["mapped_bytes"]);
+    EXPECT_TRUE(allocator.free(ptr));
+    // the number of the fallbacks is kept after the memory is freed
+    EXPECT_EQ(1, allocator.getStatistics()["explicit_fallbacks"]);
+}
+
+TEST(HugePagesAllocatorTest, destructorReleasesLeftMemory) {
+    SKIP_IF_NO_HUGE_PAGES();
+    auto allocator = std::make_shared<HugePagesAllocator>(HugePagesAllocator::Mode::Transparent);
+    ASSERT_NE(nullptr, allocator->alloc(HugePagesAllocator::hugePageSize()));
+    ASSERT_NE(nullptr, allocator->alloc(16));
+    EXPECT_EQ(2, allocator->getStatistics()["allocations"]);
+    allocator.reset();
+}
@@ -0,0 +1,99 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "latency_histogram.h"
+
+using MKLDNNPlugin::LatencyHistogram;
+
+namespace {
+std::vector<double> statistics(const LatencyHistogram& histogram) {
+    std::vector<uint64_t> merged(LatencyHistogram::bucketsNum);
+    uint64_t max = 0;
+    histogram.accumulate(merged, max);
+    return LatencyHistogram::percentiles(merged, max);
+}
+
+// nearest-rank percentile in microseconds
+double exactPercentile(std::vector<uint64_t> values, int p) {
+    std::sort(values.begin(), values.end());
+    const size_t rank = (values.size() * p + 99) / 100;
+    return static_cast<double>(values[rank - 1]) / 1000.;
+}
+} // namespace
+
+TEST(LatencyHistogramTest, emptyHistogram) {
+    LatencyHistogram histogram;
+    EXPECT_EQ(std::vector<double>({0., 0., 0., 0., 0.}), statistics(histogram));
+}
+
+TEST(LatencyHistogramTest, smallValuesAreExact) {
+    LatencyHistogram histogram;
+    for (uint64_t value = 0; value < 32; value++)
+        histogram.add(value);
+    // ranks are 16, 29 and 32 of the values 0..31
+    EXPECT_EQ(std::vector<double>({32., 0.015, 0.028, 0.031, 0.031}), statistics(histogram));
+}
+
+TEST(LatencyHistogramTest, singleValueIsReportedExactly) {
+    for (uint64_t value : {33ull, 1000ull, 123456ull, 987654321ull}) {
+        LatencyHistogram histogram;
+        histogram.add(value);
+        const double us = static_cast<double>(value) / 1000.;
+        // the bucket bound is clamped by the maximum
+        EXPECT_EQ(std::vector<double>({1., us, us, us, us}), statistics(histogram)) << value;
+    }
+}
+
+TEST(LatencyHistogramTest, percentilesRelativeErrorIsBounded) {
+    std::mt19937_64 gen(0);
+    std::lognormal_distribution<double> distribution(12., 2.);
+    std::vector<uint64_t> values(10000);
+    LatencyHistogram histogram;
+    for (auto& value : values) {
+        value = static_cast<uint64_t>(distribution(gen));
+        histogram.add(value);
+    }
+
+    const auto stats = statistics(histogram);
+    ASSERT_EQ(5, stats.size());
+    EXPECT_EQ(values.size(), stats[0]);
+    const int ps[] = {50, 90, 99};
+    for (int i = 0; i < 3; i++) {
+        const double exact = exactPercentile(values, ps[i]);
+        EXPECT_GE(stats[i + 1], exact) << "p" << ps[i];
+        EXPECT_LE(stats[i + 1], exact * 17. / 16.) << "p" << ps[i];
+    }
+    EXPECT_EQ(static_cast<double>(*std::max_element(values.begin(), values.end())) / 1000., stats[4]);
+}
+
+TEST(LatencyHistogramTest, hugeValuesAreCountedByLastBucket) {
+    LatencyHistogram histogram;
+    const uint64_t huge = 1ull << 50;
+    histogram.add(10);
+    histogram.add(huge);
+    histogram.add(huge + 1);
+    const auto stats = statistics(histogram);
+    EXPECT_EQ(3., stats[0]);
+    EXPECT_EQ(static_cast<double>(huge + 1) / 1000., stats[3]);
+    EXPECT_EQ(static_cast<double>(huge + 1) / 1000., stats[4]);
+}
+
+TEST(LatencyHistogramTest, canMergeHistograms) {
+    LatencyHistogram first, second;
+    for (uint64_t value = 0; value < 10; value++)
+        first.add(value);
+    for (uint64_t value = 10; value < 20; value++)
+        second.add(value);
+
+    std::vector<uint64_t> merged(LatencyHistogram::bucketsNum);
+    uint64_t max = 0;
+    first.accumulate(merged, max);
+    second.accumulate(merged, max);
+    EXPECT_EQ(std::vector<double>({20., 0.009, 0.017, 0.019, 0.019}), LatencyHistogram::percentiles(merged, max));
+}
@@ -114,7 +114,7 @@ TEST(MemSolverTest, LinearWithEmptyExecIndexes) {
     EXPECT_EQ(ms.maxTopDepth(), 2);
 }
 
-TEST(MemSolverTest, DISABLED_Unefficiency) {
+TEST(MemSolverTest, Unefficiency) {
     std::vector<Box> boxes{    //  |            __________
             {6, 7, 3},         //  |   ____    |_3________|
             {2, 5, 2},         //  |  |_4__|_____ |    |
@@ -123,7 +123,7 @@ TEST(MemSolverTest, DISABLED_Unefficiency) {
     };
 
     MKLDNNPlugin::MemorySolver ms(boxes);
-    EXPECT_EQ(ms.solve(), 5);  // currently we have answer 6
+    EXPECT_EQ(ms.solve(), 5);
     EXPECT_EQ(ms.maxDepth(), 5);
     EXPECT_EQ(ms.maxTopDepth(), 2);
 }
@@ -233,9 +233,7 @@ TEST(MemSolverTest, NoOverlapping) {
     };
 
     MKLDNNPlugin::MemorySolver ms(boxes);
-    ms.solve();
-    // TODO: Current algorithm doesn't solve that case. Uncomment check to see inefficiency
-    // EXPECT_EQ(ms.solve(), 5);
+    EXPECT_EQ(ms.solve(), 5);
 
     auto no_overlap = [&](Box box1, Box box2) -> bool {
         int off1 = ms.getOffset(box1.id);
@@ -273,3 +271,30 @@ TEST(MemSolverTest, BestSolution1) {
             ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
 }
 
+
+TEST(MemSolverTest, BranchedTopologyNoOverlapping) {
+    // Two parallel branches with different tensor sizes joined by concatenation
+    std::vector<Box> boxes;
+    int n = 0;
+    for (int i = 0; i < 64; i++) {
+        boxes.push_back({i, i + 1 + (i % 3), 1 + (i * 7) % 13, n++});
+        boxes.push_back({i, i + 2, 1 + (i * 5) % 11, n++});
+    }
+
+    MKLDNNPlugin::MemorySolver ms(boxes);
+    const int64_t required = ms.solve();
+    EXPECT_GE(required, ms.maxDepth());
+
+    auto no_overlap = [&](Box box1, Box box2) -> bool {
+        int64_t off1 = ms.getOffset(box1.id);
+        int64_t off2 = ms.getOffset(box2.id);
+        return box1.finish < box2.start || box1.start > box2.finish ||
+               off1 + box1.size <= off2 || off1 >= off2 + box2.size;
+    };
+
+    for (int i = 0; i < n; i++) {
+        EXPECT_LE(ms.getOffset(boxes[i].id) + boxes[i].size, required);
+        for (int j = i + 1; j < n; j++)
+            ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
+    }
+}
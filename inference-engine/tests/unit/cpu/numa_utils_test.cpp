@@ -0,0 +1,110 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <ie_system_conf.h>
+
+#include "utils/numa_utils.h"
+
+using MKLDNNPlugin::NumaAllocator;
+using MKLDNNPlugin::canPlaceOnNumaNode;
+using MKLDNNPlugin::getNumaNodeOf;
+using MKLDNNPlugin::placeOnNumaNode;
+
+namespace {
+bool hasSeveralNumaNodes() {
+    return InferenceEngine::getAvailableNUMANodes().size() > 1;
+}
+} // namespace
+
+TEST(NumaUtilsTest, nothingIsPlacedOnNegativeNode) {
+    NumaAllocator allocator(0);
+    auto ptr = allocator.alloc(4 * NumaAllocator::minPlacedSize());
+    ASSERT_NE(nullptr, ptr);
+    EXPECT_FALSE(canPlaceOnNumaNode(-1));
+    EXPECT_FALSE(placeOnNumaNode(ptr, 4 * NumaAllocator::minPlacedSize(), -1));
+    EXPECT_TRUE(allocator.free(ptr));
+}
+
+TEST(NumaUtilsTest, nullMemoryIsNotPlaced) {
+    EXPECT_FALSE(placeOnNumaNode(nullptr, NumaAllocator::minPlacedSize(), 0));
+    EXPECT_EQ(-1, getNumaNodeOf(nullptr));
+}
+
+TEST(NumaUtilsTest, subPageRangesAreNotPlaced) {
+    const size_t pageSize = NumaAllocator::minPlacedSize();
+    NumaAllocator allocator(0);
+    auto ptr = static_cast<uint8_t*>(allocator.alloc(2 * pageSize));
+    ASSERT_NE(nullptr, ptr);
+    // neither range covers a whole page
+    EXPECT_FALSE(placeOnNumaNode(ptr, pageSize - 1, 0));
+    EXPECT_FALSE(placeOnNumaNode(ptr + 1, pageSize, 0));
+    EXPECT_FALSE(placeOnNumaNode(ptr, 0, 0));
+    EXPECT_TRUE(allocator.free(ptr));
+}
+
+TEST(NumaUtilsTest, nothingIsPlacedOnSingleNodeSystem) {
+    if (hasSeveralNumaNodes())
+        GTEST_SKIP() << "the system has several NUMA nodes";
+    const size_t size = 4 * NumaAllocator::minPlacedSize();
+    NumaAllocator allocator(0);
+    auto ptr = allocator.alloc(size);
+    ASSERT_NE(nullptr, ptr);
+    std::memset(ptr, 1, size);
+    EXPECT_FALSE(canPlaceOnNumaNode(0));
+    EXPECT_FALSE(placeOnNumaNode(ptr, size, 0));
+    EXPECT_EQ(-1, getNumaNodeOf(ptr));
+    EXPECT_TRUE(allocator.free(ptr));
+}
+
+TEST(NumaUtilsTest, allocatedMemoryIsOnNode) {
+    if (!hasSeveralNumaNodes())
+        GTEST_SKIP() << "the system has a single NUMA node";
+    const size_t size = 4 * NumaAllocator::minPlacedSize();
+    for (auto node : InferenceEngine::getAvailableNUMANodes()) {
+        NumaAllocator allocator(node);
+        auto ptr = static_cast<uint8_t*>(allocator.alloc(size));
+        ASSERT_NE(nullptr, ptr);
+        std::memset(ptr, 1, size);
+        EXPECT_EQ(node, getNumaNodeOf(ptr));
+        EXPECT_EQ(node, getNumaNodeOf(ptr + size - 1));
+        EXPECT_TRUE(allocator.free(ptr));
+    }
+}
+
+TEST(NumaUtilsTest, allocatorMemoryIsWritableAndFreed) {
+    NumaAllocator allocator(0);
+    for (size_t size : {size_t(1), NumaAllocator::minPlacedSize() - 1, NumaAllocator::minPlacedSize(),
+                        3 * NumaAllocator::minPlacedSize() + 5}) {
+        auto ptr = static_cast<uint8_t*>(allocator.alloc(size));
+        ASSERT_NE(nullptr, ptr) << size;
+        EXPECT_EQ(ptr, allocator.lock(ptr));
+        std::memset(ptr, 0xAB, size);
+        EXPECT_EQ(0xAB, ptr[size - 1]);
+        EXPECT_TRUE(allocator.free(ptr)) << size;
+        EXPECT_FALSE(allocator.free(ptr)) << size;
+    }
+}
+
+TEST(NumaUtilsTest, allocatorKeepsSeveralAllocations) {
+    const size_t size = 2 * NumaAllocator::minPlacedSize();
+    NumaAllocator allocator(0);
+    std::vector<uint8_t*> ptrs;
+    for (int i = 0; i < 8; i++) {
+        ptrs.push_back(static_cast<uint8_t*>(allocator.alloc(size)));
+        ASSERT_NE(nullptr, ptrs.back());
+        std::memset(ptrs.back(), i, size);
+    }
+    for (int i = 0; i < 8; i++) {
+        EXPECT_EQ(i, ptrs[i][0]);
+        EXPECT_EQ(i, ptrs[i][size - 1]);
+    }
+    // the remaining allocations are released by the destructor
+    for (int i = 0; i < 4; i++)
+        EXPECT_TRUE(allocator.free(ptrs[i]));
+}
@@ -10,6 +10,7 @@
 
 #include "compilation_context.hpp"
 #include "ngraph/function.hpp"
+#include "ngraph/graph_util.hpp"
 #include "ngraph/ops.hpp"
 #include "ngraph/variant.hpp"
 #include "ngraph/opsets/opset6.hpp"
@@ -349,6 +350,49 @@ TEST(NetworkContext_CNNNetwork, HashWithDifferentMeanValues) {
               NetworkCompilationContext::computeHash(net3, {}));
 }
 
+TEST(NetworkContext_CNNNetwork, HashWithDifferentWeights) {
+    auto net1 = createNetwork();
+    auto net2 = createNetwork();
+    auto net3 = createNetwork();
+    auto replaceConstant = [](CNNNetwork& cnnNet, int8_t value) {
+        for (const auto& op : cnnNet.getFunction()->get_ops()) {
+            if (op->get_friendly_name() == "add_constant") {
+                auto constant = ngraph::opset6::Constant::create(ngraph::element::i8, ngraph::Shape{1}, {value});
+                constant->set_friendly_name("add_constant");
+                ngraph::replace_node(op, constant);
+            }
+        }
+    };
+    replaceConstant(net2, 5);
+    replaceConstant(net3, 5);
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net2, {}),
+              NetworkCompilationContext::computeHash(net3, {}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashOfLargeWeights) {
+    // Larger than the chunk hashed by one thread
+    const size_t size = 3 * (1 << 20) + 7;
+    auto createLargeNetwork = [&](int8_t lastValue) {
+        std::vector<int8_t> values(size, 1);
+        values.back() = lastValue;
+        auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::i8, ngraph::Shape{size});
+        auto constant = ngraph::opset6::Constant::create(ngraph::element::i8, ngraph::Shape{size}, values);
+        auto add = std::make_shared<ngraph::opset6::Add>(data, constant);
+        auto res = std::make_shared<ngraph::opset6::Result>(add);
+        return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{res}, ngraph::ParameterVector{data}));
+    };
+    auto net1 = createLargeNetwork(1);
+    auto net2 = createLargeNetwork(1);
+    auto net3 = createLargeNetwork(2);
+    auto hash1 = NetworkCompilationContext::computeHash(net1, {});
+    ASSERT_EQ(hash1, NetworkCompilationContext::computeHash(net2, {}));
+    ASSERT_NE(hash1, NetworkCompilationContext::computeHash(net3, {}));
+    // Memoized hash of the same buffer
+    ASSERT_EQ(hash1, NetworkCompilationContext::computeHash(net1, {}));
+}
+
 // Verify all internal hash calculations are thread-safe (like ngraph::function serialization)
 TEST(NetworkContext_CNNNetwork, HashOfSameMultiThreading) {
     auto net1 = createNetwork();
@@ -0,0 +1,103 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "common_test_utils/test_common.hpp"
+
+#include "mapped_file_allocator.hpp"
+
+using namespace InferenceEngine;
+
+class MappedFileAllocatorTests : public CommonTestUtils::TestsCommon {
+protected:
+    const std::string fileName = "MappedFileAllocatorTests.bin";
+    std::vector<int32_t> data;
+
+    void SetUp() override {
+        CommonTestUtils::TestsCommon::SetUp();
+        data.resize(10000);
+        for (size_t i = 0; i < data.size(); i++)
+            data[i] = static_cast<int32_t>(i);
+        std::ofstream file(fileName, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(int32_t));
+    }
+
+    void TearDown() override {
+        std::remove(fileName.c_str());
+        CommonTestUtils::TestsCommon::TearDown();
+    }
+
+    std::vector<int32_t> readFile() const {
+        std::vector<int32_t> content(data.size());
+        std::ifstream file(fileName, std::ios::binary);
+        file.read(reinterpret_cast<char*>(content.data()), content.size() * sizeof(int32_t));
+        return content;
+    }
+};
+
+#ifndef _WIN32
+
+TEST_F(MappedFileAllocatorTests, canMapFile) {
+    MappedFileAllocator allocator(fileName);
+    const size_t size = data.size() * sizeof(int32_t);
+    void* handle = allocator.alloc(size);
+    ASSERT_NE(nullptr, handle);
+    auto ptr = static_cast<const int32_t*>(allocator.lock(handle, LOCK_FOR_READ));
+    for (size_t i = 0; i < data.size(); i++)
+        ASSERT_EQ(data[i], ptr[i]);
+    allocator.unlock(handle);
+    EXPECT_TRUE(allocator.free(handle));
+}
+
+TEST_F(MappedFileAllocatorTests, writesAreNotPropagatedToFile) {
+    MappedFileAllocator allocator(fileName);
+    void* handle = allocator.alloc(data.size() * sizeof(int32_t));
+    ASSERT_NE(nullptr, handle);
+    static_cast<int32_t*>(allocator.lock(handle))[5] = -1;
+    allocator.unlock(handle);
+    EXPECT_TRUE(allocator.free(handle));
+    EXPECT_EQ(data, readFile());
+}
+
+TEST_F(MappedFileAllocatorTests, canMapPartOfFile) {
+    MappedFileAllocator allocator(fileName);
+    void* handle = allocator.alloc(sizeof(int32_t) * 10);
+    ASSERT_NE(nullptr, handle);
+    EXPECT_EQ(data[9], static_cast<const int32_t*>(handle)[9]);
+    EXPECT_TRUE(allocator.free(handle));
+}
+
+TEST_F(MappedFileAllocatorTests, mappingsAreReleasedByDestructor) {
+    std::unique_ptr<MappedFileAllocator> allocator(new MappedFileAllocator(fileName));
+    ASSERT_NE(nullptr, allocator->alloc(data.size() * sizeof(int32_t)));
+    ASSERT_NO_FATAL_FAILURE(allocator.reset());
+}
+
+#endif
+
+TEST_F(MappedFileAllocatorTests, cannotMapMoreThanFileSize) {
+    MappedFileAllocator allocator(fileName);
+    EXPECT_EQ(nullptr, allocator.alloc(data.size() * sizeof(int32_t) + 1));
+}
+
+TEST_F(MappedFileAllocatorTests, cannotMapMissingFile) {
+    MappedFileAllocator allocator("MappedFileAllocatorTests_missing.bin");
+    EXPECT_EQ(nullptr, allocator.alloc(16));
+}
+
+TEST_F(MappedFileAllocatorTests, cannotMapEmptySize) {
+    MappedFileAllocator allocator(fileName);
+    EXPECT_EQ(nullptr, allocator.alloc(0));
+}
+
+TEST_F(MappedFileAllocatorTests, cannotFreeUnknownHandle) {
+    MappedFileAllocator allocator(fileName);
+    int32_t value = 0;
+    EXPECT_FALSE(allocator.free(&value));
+}
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cmath>
 #include <cstring>
 
@@ -66,7 +67,6 @@ namespace ngraph
                     {
                         write_values(values);
                     }
-                    m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
                 }
 
                 /// \brief Create uninitialized constant
@@ -84,6 +84,7 @@ namespace ngraph
                 {
                     fill_data(type, value);
                     m_all_elements_bitwise_identical = true;
+                    m_all_elements_bitwise_identical_checked = true;
                 }
 
                 template <typename T>
@@ -328,10 +329,9 @@ namespace ngraph
                         get_data_ptr());
                 }
 
-                bool get_all_data_elements_bitwise_identical() const
-                {
-                    return m_all_elements_bitwise_identical;
-                }
+                /// \brief Checks the data on the first call, so the constants wrapping the
+                /// external memory (e.g. the mapped weights file) don't touch it until it's used
+                bool get_all_data_elements_bitwise_identical() const;
                 std::string convert_value_to_string(size_t index) const;
 
                 /**
@@ -687,7 +687,8 @@ namespace ngraph
                 element::Type m_element_type;
                 Shape m_shape{};
                 std::shared_ptr<runtime::AlignedBuffer> m_data;
-                bool m_all_elements_bitwise_identical;
+                mutable std::atomic<bool> m_all_elements_bitwise_identical{false};
+                mutable std::atomic<bool> m_all_elements_bitwise_identical_checked{false};
                 bool m_alloc_buffer_on_visit_attributes = true;
             };
         } // namespace v0
@@ -44,7 +44,6 @@ op::Constant::Constant(const shared_ptr<runtime::Tensor>& tensor)
     : Constant(tensor->get_element_type(), tensor->get_shape())
 {
     tensor->read(get_data_ptr_nc(), tensor->get_size_in_bytes());
-    m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
 }
 
 op::Constant::Constant(const element::Type& type,
@@ -89,6 +88,7 @@ op::Constant::Constant(const element::Type& type,
         case Type_t::dynamic: throw std::runtime_error("deserialize unsupported type dynamic");
         }
         m_all_elements_bitwise_identical = true;
+        m_all_elements_bitwise_identical_checked = true;
     }
     else
     {
@@ -113,7 +113,6 @@ op::Constant::Constant(const element::Type& type,
         case Type_t::undefined: throw std::runtime_error("deserialize unsupported type undefined");
         case Type_t::dynamic: throw std::runtime_error("deserialize unsupported type dynamic");
         }
-        m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
     }
 }
 
@@ -136,7 +135,6 @@ op::Constant::Constant(const element::Type& type, const Shape& shape, const void
 {
     size_t size = ceil(shape_size(m_shape) * m_element_type.bitwidth() / 8.f);
     std::memcpy(get_data_ptr_nc(), data, size);
-    m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
 }
 
 op::Constant::Constant(const Constant& other)
@@ -144,7 +142,8 @@ op::Constant::Constant(const Constant& other)
     m_element_type = other.m_element_type;
     m_shape = other.m_shape;
     m_data = other.m_data;
-    m_all_elements_bitwise_identical = other.m_all_elements_bitwise_identical;
+    m_all_elements_bitwise_identical = other.m_all_elements_bitwise_identical.load();
+    m_all_elements_bitwise_identical_checked = other.m_all_elements_bitwise_identical_checked.load();
     constructor_validate_and_infer_types();
 }
 
@@ -405,6 +404,17 @@ static bool test_bitwise_identical(const T* data, const size_t size)
     return data_is_constant;
 }
 
+bool op::Constant::get_all_data_elements_bitwise_identical() const
+{
+    // concurrent callers may check the data twice, the result is the same
+    if (!m_all_elements_bitwise_identical_checked)
+    {
+        m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
+        m_all_elements_bitwise_identical_checked = true;
+    }
+    return m_all_elements_bitwise_identical;
+}
+
 bool op::Constant::are_all_data_elements_bitwise_identical() const
 {
     bool rc = false;
@@ -471,7 +481,7 @@ bool op::v0::Constant::visit_attributes(AttributeVisitor& visitor)
         allocate_buffer();
     }
     visitor.on_attribute("value", m_data);
-    m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
+    m_all_elements_bitwise_identical_checked = false;
     return true;
 }
 
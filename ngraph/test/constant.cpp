@@ -1811,3 +1811,75 @@ TEST(constant, bad_get_data_ptr)
         EXPECT_HAS_SUBSTRING(error.what(), std::string("get_data_ptr"));
     }
 }
+
+TEST(constant, bitwise_identical_shared_buffer)
+{
+    shared_ptr<void> owner;
+    vector<float> identical(16, 2.0f);
+    vector<float> different(16, 2.0f);
+    different[7] = 3.0f;
+    auto identical_buffer = make_shared<runtime::SharedBuffer<shared_ptr<void>>>(
+        reinterpret_cast<char*>(identical.data()), identical.size() * sizeof(float), owner);
+    auto different_buffer = make_shared<runtime::SharedBuffer<shared_ptr<void>>>(
+        reinterpret_cast<char*>(different.data()), different.size() * sizeof(float), owner);
+
+    op::Constant c_identical(element::f32, Shape{16}, identical_buffer);
+    op::Constant c_different(element::f32, Shape{16}, different_buffer);
+    EXPECT_TRUE(c_identical.get_all_data_elements_bitwise_identical());
+    EXPECT_FALSE(c_different.get_all_data_elements_bitwise_identical());
+
+    op::Constant c_copy(c_different);
+    EXPECT_FALSE(c_copy.get_all_data_elements_bitwise_identical());
+}
+
+TEST(constant, bitwise_identical_checked_on_first_call)
+{
+    shared_ptr<void> owner;
+    vector<float> data(16, 2.0f);
+    auto buffer = make_shared<runtime::SharedBuffer<shared_ptr<void>>>(
+        reinterpret_cast<char*>(data.data()), data.size() * sizeof(float), owner);
+    op::Constant c(element::f32, Shape{16}, buffer);
+    // the data isn't checked on construction, so the change of the shared memory is visible
+    data[3] = 1.0f;
+    EXPECT_FALSE(c.get_all_data_elements_bitwise_identical());
+    // the result is cached after the first call
+    data[3] = 2.0f;
+    EXPECT_FALSE(c.get_all_data_elements_bitwise_identical());
+}
+
+namespace
+{
+    class ConstantValueWriter : public AttributeVisitor
+    {
+    public:
+        using AttributeVisitor::on_adapter;
+
+        explicit ConstantValueWriter(float value)
+            : m_value(value)
+        {
+        }
+
+        void on_adapter(const std::string& name, ValueAccessor<void>& adapter) override
+        {
+            using BufferAdapter = AttributeAdapter<shared_ptr<runtime::AlignedBuffer>>;
+            if (auto a = as_type<BufferAdapter>(&adapter))
+            {
+                static_cast<float*>(a->get()->get_ptr())[0] = m_value;
+            }
+        }
+
+    private:
+        float m_value;
+    };
+}
+
+TEST(constant, bitwise_identical_reset_on_visit_attributes)
+{
+    op::Constant c(element::f32, Shape{4}, vector<float>{1.0f, 1.0f, 1.0f, 1.0f});
+    EXPECT_TRUE(c.get_all_data_elements_bitwise_identical());
+
+    ConstantValueWriter writer(5.0f);
+    c.visit_attributes(writer);
+    EXPECT_FALSE(c.get_all_data_elements_bitwise_identical());
+    EXPECT_EQ(5.0f, c.get_vector<float>()[0]);
+}